@@ -0,0 +1,118 @@
+#include "./rb_bench.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static void rb_printUsage(const char* program) {
+    printf(
+        "Usage: %s [options]\n"
+        "  --out <path>          JSON output path (default: razor_bench.json)\n"
+        "  --threads <list>      Comma-separated thread counts (default: 1,2,4,8)\n"
+        "  --filter <text>       Only run benchmarks whose name contains <text>\n"
+        "  --repetitions <n>     Samples per benchmark, median reported (default: 5)\n"
+        "  --min-time-ms <n>     Minimum duration of a sample (default: 50)\n"
+        "  --vulkan              Also run the graphics benchmarks\n"
+        "  --help                Show this message\n"
+        "\n"
+        "For repeatable graphics numbers, run them on a software ICD by pointing\n"
+        "the Vulkan loader at it, e.g. VK_DRIVER_FILES=<path>/lvp_icd.x86_64.json\n"
+        "(VK_ICD_FILENAMES on loaders older than 1.3.234).\n",
+        program
+    );
+}
+
+static bool rb_parseThreadCounts(const char* list, rb_Options* options) {
+    options->thread_count_count = 0;
+
+    while (*list != '\0') {
+        char* end = NULL;
+        const unsigned long thread_count = strtoul(list, &end, 10);
+
+        if (end == list || thread_count == 0 || thread_count > RB_MAX_THREADS) {
+            return false;
+        }
+
+        if (options->thread_count_count == RB_MAX_THREAD_COUNTS) {
+            return false;
+        }
+
+        if (*end != ',' && *end != '\0') {
+            return false;
+        }
+
+        options->thread_counts[options->thread_count_count++] = (uint32_t)thread_count;
+        list = *end == ',' ? end + 1 : end;
+    }
+
+    return options->thread_count_count > 0;
+}
+
+int main(int argc, char** argv) {
+    rb_Options options = {0};
+    options.output_path = "razor_bench.json";
+    options.thread_counts[0] = 1u;
+    options.thread_counts[1] = 2u;
+    options.thread_counts[2] = 4u;
+    options.thread_counts[3] = 8u;
+    options.thread_count_count = 4u;
+    options.repetitions = 5u;
+    options.min_sample_ns = 50ull * 1000000ull;
+
+    for (int idx = 1; idx < argc; ++idx) {
+        const char* arg = argv[idx];
+        const char* value = idx + 1 < argc ? argv[idx + 1] : NULL;
+        bool is_valid = true;
+
+        if (strcmp(arg, "--help") == 0) {
+            rb_printUsage(argv[0]);
+            return 0;
+        }
+        else if (strcmp(arg, "--vulkan") == 0) {
+            options.run_vulkan = true;
+            continue;
+        }
+        else if (value == NULL) {
+            is_valid = false;
+        }
+        else if (strcmp(arg, "--out") == 0) {
+            options.output_path = value;
+        }
+        else if (strcmp(arg, "--filter") == 0) {
+            options.filter = value;
+        }
+        else if (strcmp(arg, "--threads") == 0) {
+            is_valid = rb_parseThreadCounts(value, &options);
+        }
+        else if (strcmp(arg, "--repetitions") == 0) {
+            options.repetitions = (uint32_t)strtoul(value, NULL, 10);
+            is_valid = options.repetitions > 0 && options.repetitions <= RB_MAX_REPETITIONS;
+        }
+        else if (strcmp(arg, "--min-time-ms") == 0) {
+            options.min_sample_ns = strtoull(value, NULL, 10) * 1000000ull;
+        }
+        else {
+            is_valid = false;
+        }
+
+        if (!is_valid) {
+            fprintf(stderr, "Invalid argument: %s\n", arg);
+            rb_printUsage(argv[0]);
+
+            return 1;
+        }
+
+        ++idx;
+    }
+
+    // ? The engine benchmarks go first since they initialize the modules the
+    // ? rest rely on.
+    rb_addEngineBenchmarks(&options);
+    rb_addMemoryBenchmarks();
+    rb_addStringBenchmarks();
+    rb_addLoggingBenchmarks();
+    rb_addContainerBenchmarks();
+    rb_addJobBenchmarks();
+
+    return rb_runBenchmarks(&options) ? 0 : 1;
+}
\ No newline at end of file
@@ -0,0 +1,398 @@
+#include "./rb_bench.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdatomic.h>
+
+#if RE_PLATFORM == RE_PLATFORM_WINDOWS
+    #include <windows.h>
+#else
+    #include <pthread.h>
+    #include <sched.h>
+#endif
+
+#define RB_MAX_ITERATIONS (1ull << 40)
+#define RB_MAX_CALIBRATION_SCALE 100.0
+
+#ifdef _MSC_VER
+volatile const void* rb_sink = NULL;
+#endif
+
+typedef struct rb_Result {
+    const char* name;
+    uint32_t thread_count;
+    uint64_t iterations;
+    uint32_t sample_count;
+
+    double ns_per_op_median;
+    double ns_per_op_min;
+    double ns_per_op_max;
+
+    double ops_per_sec;
+    double bytes_per_sec;
+} rb_Result;
+
+typedef struct rb_Sample {
+    const rb_Benchmark* benchmark;
+    void* state;
+    uint64_t iterations;
+
+    atomic_uint ready_count;
+    atomic_uint done_count;
+    atomic_bool is_started;
+} rb_Sample;
+
+typedef struct rb_Worker {
+    rb_Sample* sample;
+    uint32_t thread_idx;
+} rb_Worker;
+
+static rb_Benchmark rb_benchmarks[RB_MAX_BENCHMARKS];
+static uint32_t rb_benchmark_count = 0;
+
+// *=================================================
+// *
+// * Threads
+// *
+// *=================================================
+
+#if RE_PLATFORM == RE_PLATFORM_WINDOWS
+typedef HANDLE rb_Thread;
+#else
+typedef pthread_t rb_Thread;
+#endif
+
+static void rb_yieldThread() {
+    #if RE_PLATFORM == RE_PLATFORM_WINDOWS
+    SwitchToThread();
+    #else
+    sched_yield();
+    #endif
+}
+
+static void rb_runWorker(rb_Worker* worker) {
+    rb_Sample* sample = worker->sample;
+
+    atomic_fetch_add_explicit(&sample->ready_count, 1u, memory_order_release);
+
+    while (!atomic_load_explicit(&sample->is_started, memory_order_acquire)) {
+        rb_yieldThread();
+    }
+
+    sample->benchmark->run(sample->benchmark, sample->state, worker->thread_idx, sample->iterations);
+
+    atomic_fetch_add_explicit(&sample->done_count, 1u, memory_order_release);
+}
+
+#if RE_PLATFORM == RE_PLATFORM_WINDOWS
+
+static DWORD WINAPI rb_workerMain(LPVOID worker) {
+    rb_runWorker((rb_Worker*)worker);
+    return 0;
+}
+
+static rb_Thread rb_startThread(rb_Worker* worker) {
+    return CreateThread(NULL, 0, rb_workerMain, worker, 0, NULL);
+}
+
+static void rb_joinThread(rb_Thread thread) {
+    WaitForSingleObject(thread, INFINITE);
+    CloseHandle(thread);
+}
+
+#else
+
+static void* rb_workerMain(void* worker) {
+    rb_runWorker((rb_Worker*)worker);
+    return NULL;
+}
+
+static rb_Thread rb_startThread(rb_Worker* worker) {
+    rb_Thread thread;
+    pthread_create(&thread, NULL, rb_workerMain, worker);
+
+    return thread;
+}
+
+static void rb_joinThread(rb_Thread thread) {
+    pthread_join(thread, NULL);
+}
+
+#endif
+
+// *=================================================
+// *
+// * rb_addBenchmark
+// *
+// *=================================================
+
+void rb_addBenchmark(const rb_Benchmark* benchmark) {
+    if (rb_benchmark_count == RB_MAX_BENCHMARKS) {
+        fprintf(stderr, "Too many benchmarks, dropping: %s\n", benchmark->name);
+        return;
+    }
+
+    rb_benchmarks[rb_benchmark_count++] = *benchmark;
+}
+
+// *=================================================
+// *
+// * rb_takeSample
+// *
+// *=================================================
+
+static uint64_t rb_takeSample(
+    const rb_Benchmark* benchmark,
+    void* state,
+    const uint32_t thread_count,
+    const uint64_t iterations
+) {
+    rb_Sample sample = {0};
+    sample.benchmark = benchmark;
+    sample.state = state;
+    sample.iterations = iterations;
+
+    rb_Worker workers[RB_MAX_THREADS];
+    rb_Thread threads[RB_MAX_THREADS];
+
+    // ? The calling thread is thread 0; the others are started (untimed) and
+    // ? held back until the clock starts.
+    for (uint32_t thread_idx = 1; thread_idx < thread_count; ++thread_idx) {
+        workers[thread_idx].sample = &sample;
+        workers[thread_idx].thread_idx = thread_idx;
+
+        threads[thread_idx] = rb_startThread(&workers[thread_idx]);
+    }
+
+    while (atomic_load_explicit(&sample.ready_count, memory_order_acquire) < thread_count - 1u) {
+        rb_yieldThread();
+    }
+
+    const uint64_t start_ns = re_getProfileTime();
+    atomic_store_explicit(&sample.is_started, true, memory_order_release);
+
+    benchmark->run(benchmark, state, 0, iterations);
+
+    while (atomic_load_explicit(&sample.done_count, memory_order_acquire) < thread_count - 1u) {
+        rb_yieldThread();
+    }
+
+    if (benchmark->finish != NULL) {
+        benchmark->finish(state);
+    }
+
+    const uint64_t end_ns = re_getProfileTime();
+
+    for (uint32_t thread_idx = 1; thread_idx < thread_count; ++thread_idx) {
+        rb_joinThread(threads[thread_idx]);
+    }
+
+    return end_ns - start_ns;
+}
+
+// *=================================================
+// *
+// * rb_calibrateIterations
+// *
+// *=================================================
+
+static uint64_t rb_calibrateIterations(
+    const rb_Benchmark* benchmark,
+    void* state,
+    const uint32_t thread_count,
+    const uint64_t min_sample_ns
+) {
+    if (benchmark->is_one_shot) {
+        return 1;
+    }
+
+    if (benchmark->fixed_iterations > 0) {
+        return benchmark->fixed_iterations;
+    }
+
+    // ? Calibration doubles as the warm-up (caches, allocator pools, the
+    // ? logger's writer thread).
+    uint64_t iterations = 1;
+
+    for (;;) {
+        const uint64_t elapsed_ns = rb_takeSample(benchmark, state, thread_count, iterations);
+
+        if (elapsed_ns >= min_sample_ns || iterations >= RB_MAX_ITERATIONS) {
+            return iterations;
+        }
+
+        // ? Aim past the target so that the measured samples land above it.
+        double scale = elapsed_ns > 0 ? (double)min_sample_ns * 1.2 / (double)elapsed_ns : RB_MAX_CALIBRATION_SCALE;
+        scale = scale < RB_MAX_CALIBRATION_SCALE ? scale : RB_MAX_CALIBRATION_SCALE;
+
+        const uint64_t next_iterations = (uint64_t)((double)iterations * scale);
+        iterations = next_iterations > iterations ? next_iterations : iterations * 2u;
+    }
+}
+
+// *=================================================
+// *
+// * rb_compareDoubles
+// *
+// *=================================================
+
+static int rb_compareDoubles(const void* a, const void* b) {
+    const double value_a = *(const double*)a;
+    const double value_b = *(const double*)b;
+
+    return (value_a > value_b) - (value_a < value_b);
+}
+
+// *=================================================
+// *
+// * rb_measureBenchmark
+// *
+// *=================================================
+
+static rb_Result rb_measureBenchmark(
+    const rb_Benchmark* benchmark,
+    const uint32_t thread_count,
+    const rb_Options* options
+) {
+    void* state = benchmark->setup != NULL ? benchmark->setup(benchmark, thread_count) : NULL;
+
+    rb_Result result = {0};
+    result.name = benchmark->name;
+    result.thread_count = thread_count;
+    result.iterations = rb_calibrateIterations(benchmark, state, thread_count, options->min_sample_ns);
+    result.sample_count = benchmark->is_one_shot ? 1u : options->repetitions;
+
+    double ns_per_op[RB_MAX_REPETITIONS];
+
+    for (uint32_t idx = 0; idx < result.sample_count; ++idx) {
+        const uint64_t elapsed_ns = rb_takeSample(benchmark, state, thread_count, result.iterations);
+        ns_per_op[idx] = (double)elapsed_ns / (double)result.iterations;
+    }
+
+    if (benchmark->teardown != NULL) {
+        benchmark->teardown(state);
+    }
+
+    qsort(ns_per_op, result.sample_count, sizeof(double), rb_compareDoubles);
+
+    result.ns_per_op_median = ns_per_op[result.sample_count / 2u];
+    result.ns_per_op_min = ns_per_op[0];
+    result.ns_per_op_max = ns_per_op[result.sample_count - 1u];
+
+    // ? ns/op is the latency of one thread's operation; throughput counts
+    // ? the operations of every thread.
+    result.ops_per_sec = result.ns_per_op_median > 0.0 ? (double)thread_count * 1e9 / result.ns_per_op_median : 0.0;
+    result.bytes_per_sec = benchmark->reports_bytes ? result.ops_per_sec * (double)benchmark->size : 0.0;
+
+    return result;
+}
+
+// *=================================================
+// *
+// * rb_writeResults
+// *
+// *=================================================
+
+static bool rb_writeResults(const rb_Result* results, const uint32_t result_count, const rb_Options* options) {
+    FILE* file = NULL;
+
+    #if RE_PLATFORM == RE_PLATFORM_WINDOWS
+    fopen_s(&file, options->output_path, "w");
+    #else
+    file = fopen(options->output_path, "w");
+    #endif
+
+    if (file == NULL) {
+        fprintf(stderr, "Failed to open benchmark output file: %s\n", options->output_path);
+        return false;
+    }
+
+    fprintf(
+        file,
+        "{\n  \"suite\": \"RazorBench\",\n  \"engine_version\": \"%d.%d.%d\",\n"
+        "  \"repetitions\": %u,\n  \"min_sample_ns\": %llu,\n  \"results\": [",
+        RE_ENGINE_MAJOR_VER,
+        RE_ENGINE_MINOR_VER,
+        RE_ENGINE_PATCH_VER,
+        options->repetitions,
+        (unsigned long long)options->min_sample_ns
+    );
+
+    for (uint32_t idx = 0; idx < result_count; ++idx) {
+        const rb_Result* result = &results[idx];
+
+        fprintf(
+            file,
+            "%s\n    {\"name\": \"%s\", \"threads\": %u, \"iterations\": %llu, \"samples\": %u, "
+            "\"ns_per_op\": %.3f, \"ns_per_op_min\": %.3f, \"ns_per_op_max\": %.3f, "
+            "\"ops_per_sec\": %.1f, \"bytes_per_sec\": %.1f}",
+            idx == 0 ? "" : ",",
+            result->name,
+            result->thread_count,
+            (unsigned long long)result->iterations,
+            result->sample_count,
+            result->ns_per_op_median,
+            result->ns_per_op_min,
+            result->ns_per_op_max,
+            result->ops_per_sec,
+            result->bytes_per_sec
+        );
+    }
+
+    fputs("\n  ]\n}\n", file);
+    fclose(file);
+
+    return true;
+}
+
+// *=================================================
+// *
+// * rb_runBenchmarks
+// *
+// *=================================================
+
+bool rb_runBenchmarks(const rb_Options* options) {
+    rb_Result* results = (rb_Result*)calloc(RB_MAX_BENCHMARKS * RB_MAX_THREAD_COUNTS, sizeof(rb_Result));
+    uint32_t result_count = 0;
+
+    for (uint32_t idx = 0; idx < rb_benchmark_count; ++idx) {
+        const rb_Benchmark* benchmark = &rb_benchmarks[idx];
+
+        // ? Filtered one-shot benchmarks still run (untimed side effects such
+        // ? as module init are what the later benchmarks rely on).
+        const bool is_filtered = options->filter != NULL && strstr(benchmark->name, options->filter) == NULL;
+
+        if (is_filtered && benchmark->is_one_shot) {
+            benchmark->run(benchmark, NULL, 0, 1);
+            continue;
+        }
+
+        if (is_filtered) {
+            continue;
+        }
+
+        const uint32_t thread_count_count = benchmark->is_multithreaded ? options->thread_count_count : 1u;
+
+        for (uint32_t jdx = 0; jdx < thread_count_count; ++jdx) {
+            const uint32_t thread_count = benchmark->is_multithreaded ? options->thread_counts[jdx] : 1u;
+            const rb_Result result = rb_measureBenchmark(benchmark, thread_count, options);
+
+            results[result_count++] = result;
+
+            printf(
+                "%-40s threads=%-3u %14.2f ns/op %16.0f ops/s\n",
+                result.name,
+                result.thread_count,
+                result.ns_per_op_median,
+                result.ops_per_sec
+            );
+            fflush(stdout);
+        }
+    }
+
+    const bool is_written = rb_writeResults(results, result_count, options);
+    free(results);
+
+    return is_written;
+}
\ No newline at end of file
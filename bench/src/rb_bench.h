@@ -0,0 +1,95 @@
+#ifndef __RAZOR_BENCH_HEADER_FILE
+#define __RAZOR_BENCH_HEADER_FILE
+
+#include <razor.h>
+
+#define RB_MAX_BENCHMARKS 128u
+#define RB_MAX_THREADS 64u
+#define RB_MAX_THREAD_COUNTS 8u
+#define RB_MAX_REPETITIONS 64u
+
+// ? Keeps a value the benchmark computes from being optimized away.
+#ifdef _MSC_VER
+    #include <intrin.h>
+    extern volatile const void* rb_sink;
+    #define rb_clobber(ptr) do { rb_sink = (const void*)(ptr); _ReadWriteBarrier(); } while (0)
+#else
+    #define rb_clobber(ptr) __asm__ __volatile__("" : : "r"(ptr) : "memory")
+#endif
+
+typedef struct rb_Benchmark rb_Benchmark;
+
+typedef void* (*rb_SetupFn)(const rb_Benchmark* benchmark, const uint32_t thread_count);
+typedef void (*rb_RunFn)(const rb_Benchmark* benchmark, void* state, const uint32_t thread_idx, const uint64_t iterations);
+typedef void (*rb_FinishFn)(void* state);
+typedef void (*rb_TeardownFn)(void* state);
+
+struct rb_Benchmark {
+    const char* name;
+
+    // ? The working size handed to the benchmark (e.g. the bytes copied per
+    // ? operation); throughput is reported in bytes when reports_bytes is set.
+    size_t size;
+    bool reports_bytes;
+
+    // ? Single-threaded benchmarks only run at the first thread count, and
+    // ? one-shot benchmarks (e.g. cold module init) take exactly one sample of
+    // ? one iteration. A fixed iteration count skips calibration.
+    bool is_multithreaded;
+    bool is_one_shot;
+    uint64_t fixed_iterations;
+
+    // ? Benchmark-specific constant data (e.g. the implementation under test
+    // ? when several share one run function).
+    const void* user_data;
+
+    // ? Only run is required. Setup and teardown are untimed; finish runs
+    // ? inside the timed region once every thread is done (e.g. a flush).
+    rb_SetupFn setup;
+    rb_RunFn run;
+    rb_FinishFn finish;
+    rb_TeardownFn teardown;
+};
+
+typedef struct rb_Options {
+    const char* output_path;
+    const char* filter;
+
+    uint32_t thread_counts[RB_MAX_THREAD_COUNTS];
+    uint32_t thread_count_count;
+
+    uint32_t repetitions;
+    uint64_t min_sample_ns;
+
+    bool run_vulkan;
+} rb_Options;
+
+/// @brief Queue a benchmark (run in the order added).
+/// @param benchmark The benchmark to copy into the suite.
+void rb_addBenchmark(const rb_Benchmark* benchmark);
+
+/// @brief Run every queued benchmark and write the results as JSON.
+/// @param options The suite options.
+/// @return A flag determining if the results could be written.
+bool rb_runBenchmarks(const rb_Options* options);
+
+/// @brief Queue the module init and graphics benchmarks (these must run first).
+/// @param options The suite options.
+void rb_addEngineBenchmarks(const rb_Options* options);
+
+/// @brief Queue the allocation and memory operation benchmarks.
+void rb_addMemoryBenchmarks();
+
+/// @brief Queue the string utility benchmarks.
+void rb_addStringBenchmarks();
+
+/// @brief Queue the logger benchmarks.
+void rb_addLoggingBenchmarks();
+
+/// @brief Queue the container benchmarks.
+void rb_addContainerBenchmarks();
+
+/// @brief Queue the job system benchmarks.
+void rb_addJobBenchmarks();
+
+#endif
\ No newline at end of file
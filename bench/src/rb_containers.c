@@ -0,0 +1,367 @@
+#include "./rb_bench.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#define RB_SMALL_MAP_SIZE 4096u
+#define RB_LARGE_MAP_SIZE (1u << 20)
+
+#define RB_MAX_MAP_VARIANTS 16u
+#define RB_MAX_MAP_VARIANT_NAME 64u
+
+typedef void* (*rb_MapCreateFn)(const uint32_t capacity);
+typedef void (*rb_MapDestroyFn)(void* map);
+typedef void (*rb_MapInsertFn)(void* map, const uint64_t key, const uint64_t value);
+typedef uint64_t* (*rb_MapFindFn)(void* map, const uint64_t key);
+typedef void (*rb_MapClearFn)(void* map);
+
+typedef struct rb_MapImpl {
+    const char* name;
+
+    rb_MapCreateFn create;
+    rb_MapDestroyFn destroy;
+    rb_MapInsertFn insert;
+    rb_MapFindFn find;
+    rb_MapClearFn clear;
+} rb_MapImpl;
+
+typedef struct rb_MapVariant {
+    char name[RB_MAX_MAP_VARIANT_NAME];
+    const rb_MapImpl* impl;
+} rb_MapVariant;
+
+// ? Keys are inserted (and looked up as hits) while misses never are. Lookups
+// ? visit both in an order unrelated to insertion.
+typedef struct rb_MapState {
+    const rb_MapImpl* impl;
+    void* map;
+
+    uint64_t* keys;
+    uint64_t* misses;
+    uint32_t key_count;
+    uint32_t inserted_count;
+} rb_MapState;
+
+static rb_MapVariant rb_map_variants[RB_MAX_MAP_VARIANTS];
+static uint32_t rb_map_variant_count = 0;
+
+// *=================================================
+// *
+// * Chained Map (Baseline)
+// *
+// *=================================================
+
+// ? A bucket array of singly linked, individually allocated nodes: the usual
+// ? hand-rolled C map. It hashes with re_hashStr too, so only the layout differs.
+
+typedef struct rb_ChainedNode {
+    struct rb_ChainedNode* next;
+    uint64_t key;
+    uint64_t value;
+} rb_ChainedNode;
+
+typedef struct rb_ChainedMap {
+    rb_ChainedNode** buckets;
+    uint32_t bucket_mask;
+} rb_ChainedMap;
+
+static void* rb_createChainedMap(const uint32_t capacity) {
+    uint32_t bucket_count = 16u;
+    while (bucket_count < capacity) {
+        bucket_count *= 2u;
+    }
+
+    rb_ChainedMap* map = (rb_ChainedMap*)malloc(sizeof(rb_ChainedMap));
+    map->buckets = (rb_ChainedNode**)calloc(bucket_count, sizeof(rb_ChainedNode*));
+    map->bucket_mask = bucket_count - 1u;
+
+    return map;
+}
+
+static void rb_clearChainedMap(void* map) {
+    rb_ChainedMap* chained = (rb_ChainedMap*)map;
+
+    for (uint32_t idx = 0; idx <= chained->bucket_mask; ++idx) {
+        rb_ChainedNode* node = chained->buckets[idx];
+
+        while (node != NULL) {
+            rb_ChainedNode* next = node->next;
+            free(node);
+            node = next;
+        }
+
+        chained->buckets[idx] = NULL;
+    }
+}
+
+static void rb_destroyChainedMap(void* map) {
+    rb_ChainedMap* chained = (rb_ChainedMap*)map;
+
+    rb_clearChainedMap(chained);
+    free(chained->buckets);
+    free(chained);
+}
+
+static rb_ChainedNode** rb_getChainedBucket(rb_ChainedMap* map, const uint64_t key) {
+    return &map->buckets[re_hashStr((const char*)&key, sizeof(key)) & map->bucket_mask];
+}
+
+static void rb_insertChainedMap(void* map, const uint64_t key, const uint64_t value) {
+    rb_ChainedNode** bucket = rb_getChainedBucket((rb_ChainedMap*)map, key);
+
+    for (rb_ChainedNode* node = *bucket; node != NULL; node = node->next) {
+        if (node->key == key) {
+            node->value = value;
+            return;
+        }
+    }
+
+    rb_ChainedNode* node = (rb_ChainedNode*)malloc(sizeof(rb_ChainedNode));
+    node->key = key;
+    node->value = value;
+    node->next = *bucket;
+    *bucket = node;
+}
+
+static uint64_t* rb_findChainedMap(void* map, const uint64_t key) {
+    for (rb_ChainedNode* node = *rb_getChainedBucket((rb_ChainedMap*)map, key); node != NULL; node = node->next) {
+        if (node->key == key) {
+            return &node->value;
+        }
+    }
+
+    return NULL;
+}
+
+// *=================================================
+// *
+// * re_HashMap
+// *
+// *=================================================
+
+static void* rb_createHashMap(const uint32_t capacity) {
+    (void)capacity;
+
+    // ? Grows on demand like the engine's caches will, rather than being
+    // ? presized (the chained map's buckets are its only fixed cost).
+    re_HashMapCreateInfo create_info = {0};
+    create_info.key_size = sizeof(uint64_t);
+    create_info.value_size = sizeof(uint64_t);
+
+    return re_createHashMap(&create_info);
+}
+
+static void rb_destroyHashMap(void* map) {
+    re_HashMap hash_map = (re_HashMap)map;
+    re_destroyHashMap(&hash_map);
+}
+
+static void rb_insertHashMap(void* map, const uint64_t key, const uint64_t value) {
+    re_hashMapInsert((re_HashMap)map, &key, &value);
+}
+
+static uint64_t* rb_findHashMap(void* map, const uint64_t key) {
+    return (uint64_t*)re_hashMapFind((re_HashMap)map, &key);
+}
+
+static void rb_clearHashMap(void* map) {
+    re_clearHashMap((re_HashMap)map);
+}
+
+// *=================================================
+// *
+// * Setup
+// *
+// *=================================================
+
+static uint64_t rb_nextRandom(uint64_t* seed) {
+    // ? splitmix64, so the key sets are the same on every run.
+    uint64_t value = (*seed += 0x9e3779b97f4a7c15ull);
+    value = (value ^ (value >> 30)) * 0xbf58476d1ce4e5b9ull;
+    value = (value ^ (value >> 27)) * 0x94d049bb133111ebull;
+
+    return value ^ (value >> 31);
+}
+
+static void rb_shuffleKeys(uint64_t* keys, const uint32_t count, uint64_t* seed) {
+    for (uint32_t idx = count - 1u; idx > 0; --idx) {
+        const uint32_t jdx = (uint32_t)(rb_nextRandom(seed) % (idx + 1u));
+        const uint64_t key = keys[idx];
+
+        keys[idx] = keys[jdx];
+        keys[jdx] = key;
+    }
+}
+
+static void* rb_setupMap(const rb_Benchmark* benchmark, const bool prefill) {
+    const rb_MapVariant* variant = (const rb_MapVariant*)benchmark->user_data;
+    const uint32_t key_count = (uint32_t)benchmark->size;
+
+    rb_MapState* state = (rb_MapState*)calloc(1, sizeof(rb_MapState));
+    state->impl = variant->impl;
+    state->map = variant->impl->create(key_count);
+    state->keys = (uint64_t*)malloc(key_count * sizeof(uint64_t));
+    state->misses = (uint64_t*)malloc(key_count * sizeof(uint64_t));
+    state->key_count = key_count;
+
+    // ? The low bit splits hits from misses, so the two sets never overlap.
+    uint64_t seed = 0x5eedu;
+    for (uint32_t idx = 0; idx < key_count; ++idx) {
+        state->keys[idx] = rb_nextRandom(&seed) & ~1ull;
+        state->misses[idx] = rb_nextRandom(&seed) | 1ull;
+    }
+
+    if (prefill) {
+        for (uint32_t idx = 0; idx < key_count; ++idx) {
+            state->impl->insert(state->map, state->keys[idx], idx);
+        }
+
+        state->inserted_count = key_count;
+        rb_shuffleKeys(state->keys, key_count, &seed);
+    }
+
+    return state;
+}
+
+static void* rb_setupEmptyMap(const rb_Benchmark* benchmark, const uint32_t thread_count) {
+    (void)thread_count;
+
+    return rb_setupMap(benchmark, false);
+}
+
+static void* rb_setupFilledMap(const rb_Benchmark* benchmark, const uint32_t thread_count) {
+    (void)thread_count;
+
+    return rb_setupMap(benchmark, true);
+}
+
+static void rb_teardownMap(void* state) {
+    rb_MapState* map_state = (rb_MapState*)state;
+
+    // ? Untimed sanity check: a fast map that loses keys is not a result.
+    for (uint32_t idx = 0; idx < map_state->inserted_count; ++idx) {
+        re_assert(map_state->impl->find(map_state->map, map_state->keys[idx]) != NULL, "%s lost an inserted key!", map_state->impl->name);
+    }
+
+    for (uint32_t idx = 0; idx < map_state->key_count; ++idx) {
+        re_assert(map_state->impl->find(map_state->map, map_state->misses[idx]) == NULL, "%s found a key it never had!", map_state->impl->name);
+    }
+
+    map_state->impl->destroy(map_state->map);
+    free(map_state->keys);
+    free(map_state->misses);
+    free(map_state);
+}
+
+// *=================================================
+// *
+// * Runs
+// *
+// *=================================================
+
+// ? Inserts fill the map to the benchmark's size and then clear it. Cleared
+// ? maps keep their storage, so past the first fill this measures inserting
+// ? into warm memory (plus, for the chained map, a node allocation and free).
+static void rb_runMapInsert(const rb_Benchmark* benchmark, void* state, const uint32_t thread_idx, const uint64_t iterations) {
+    (void)benchmark;
+    (void)thread_idx;
+
+    rb_MapState* map_state = (rb_MapState*)state;
+
+    for (uint64_t idx = 0; idx < iterations; ++idx) {
+        if (map_state->inserted_count == map_state->key_count) {
+            map_state->impl->clear(map_state->map);
+            map_state->inserted_count = 0;
+        }
+
+        map_state->impl->insert(map_state->map, map_state->keys[map_state->inserted_count], idx);
+        ++map_state->inserted_count;
+    }
+}
+
+static void rb_runMapFindHit(const rb_Benchmark* benchmark, void* state, const uint32_t thread_idx, const uint64_t iterations) {
+    (void)benchmark;
+    (void)thread_idx;
+
+    const rb_MapState* map_state = (const rb_MapState*)state;
+    uint64_t sum = 0;
+    uint32_t key_idx = 0;
+
+    for (uint64_t idx = 0; idx < iterations; ++idx) {
+        sum += *map_state->impl->find(map_state->map, map_state->keys[key_idx]);
+        key_idx = key_idx + 1u < map_state->key_count ? key_idx + 1u : 0;
+    }
+
+    rb_clobber(&sum);
+}
+
+static void rb_runMapFindMiss(const rb_Benchmark* benchmark, void* state, const uint32_t thread_idx, const uint64_t iterations) {
+    (void)benchmark;
+    (void)thread_idx;
+
+    const rb_MapState* map_state = (const rb_MapState*)state;
+    uint64_t found_count = 0;
+    uint32_t key_idx = 0;
+
+    for (uint64_t idx = 0; idx < iterations; ++idx) {
+        found_count += map_state->impl->find(map_state->map, map_state->misses[key_idx]) != NULL;
+        key_idx = key_idx + 1u < map_state->key_count ? key_idx + 1u : 0;
+    }
+
+    rb_clobber(&found_count);
+}
+
+// *=================================================
+// *
+// * rb_addMapBenchmark
+// *
+// *=================================================
+
+static void rb_addMapBenchmark(
+    const char* operation,
+    const char* input,
+    const rb_MapImpl* impl,
+    const size_t size,
+    const rb_SetupFn setup,
+    const rb_RunFn run
+) {
+    rb_MapVariant* variant = &rb_map_variants[rb_map_variant_count++];
+    snprintf(variant->name, RB_MAX_MAP_VARIANT_NAME, "containers/hash_map/%s/%s/%s", operation, input, impl->name);
+    variant->impl = impl;
+
+    rb_Benchmark benchmark = {0};
+    benchmark.name = variant->name;
+    benchmark.size = size;
+    benchmark.user_data = variant;
+    benchmark.setup = setup;
+    benchmark.run = run;
+    benchmark.teardown = rb_teardownMap;
+
+    rb_addBenchmark(&benchmark);
+}
+
+// *=================================================
+// *
+// * rb_addContainerBenchmarks
+// *
+// *=================================================
+
+void rb_addContainerBenchmarks() {
+    static const rb_MapImpl map_impls[] = {
+        { "re_HashMap", rb_createHashMap, rb_destroyHashMap, rb_insertHashMap, rb_findHashMap, rb_clearHashMap },
+        { "chained", rb_createChainedMap, rb_destroyChainedMap, rb_insertChainedMap, rb_findChainedMap, rb_clearChainedMap },
+    };
+
+    static const struct { const char* name; size_t size; } inputs[] = {
+        { "small", RB_SMALL_MAP_SIZE },
+        { "large", RB_LARGE_MAP_SIZE },
+    };
+
+    for (uint32_t idx = 0; idx < sizeof(inputs) / sizeof(inputs[0]); ++idx) {
+        for (uint32_t jdx = 0; jdx < sizeof(map_impls) / sizeof(map_impls[0]); ++jdx) {
+            rb_addMapBenchmark("insert", inputs[idx].name, &map_impls[jdx], inputs[idx].size, rb_setupEmptyMap, rb_runMapInsert);
+            rb_addMapBenchmark("find_hit", inputs[idx].name, &map_impls[jdx], inputs[idx].size, rb_setupFilledMap, rb_runMapFindHit);
+            rb_addMapBenchmark("find_miss", inputs[idx].name, &map_impls[jdx], inputs[idx].size, rb_setupFilledMap, rb_runMapFindMiss);
+        }
+    }
+}
\ No newline at end of file
@@ -0,0 +1,132 @@
+#include "./rb_bench.h"
+
+#include <stdio.h>
+
+// ? Module init is only cold once per process, so the cold runs are one-shot
+// ? samples; repeated calls then measure the already-initialized guard.
+
+// ? Designated so fields added to re_CoreInitParams start zeroed (e.g. one
+// ? job worker per core) instead of breaking the initializer.
+static re_CoreInitParams rb_core_init_params = {
+    .app_name = "RazorBench",
+    .app_major_version = RE_ENGINE_MAJOR_VER,
+    .app_minor_version = RE_ENGINE_MINOR_VER,
+    .app_patch_version = RE_ENGINE_PATCH_VER
+};
+
+static void rb_runDebugInit(const rb_Benchmark* benchmark, void* state, const uint32_t thread_idx, const uint64_t iterations) {
+    (void)benchmark;
+    (void)state;
+    (void)thread_idx;
+
+    for (uint64_t idx = 0; idx < iterations; ++idx) {
+        re_debugInit();
+    }
+}
+
+static void rb_runCoreInit(const rb_Benchmark* benchmark, void* state, const uint32_t thread_idx, const uint64_t iterations) {
+    (void)benchmark;
+    (void)state;
+    (void)thread_idx;
+
+    for (uint64_t idx = 0; idx < iterations; ++idx) {
+        re_coreInit(&rb_core_init_params);
+    }
+}
+
+#if RE_PLATFORM == RE_PLATFORM_WINDOWS
+
+// ? The graphics instance needs a window to present to; the engine only has
+// ? a window implementation on Windows. Point the Vulkan loader at a software
+// ? ICD (e.g. lavapipe) through VK_DRIVER_FILES to keep the GPU out of it.
+
+static void rb_runGraphicsInit(const rb_Benchmark* benchmark, void* state, const uint32_t thread_idx, const uint64_t iterations) {
+    (void)benchmark;
+    (void)state;
+    (void)thread_idx;
+    (void)iterations;
+
+    re_graphicsInit();
+}
+
+static void* rb_setupGraphicsInstance(const rb_Benchmark* benchmark, const uint32_t thread_count) {
+    (void)benchmark;
+    (void)thread_count;
+
+    re_WindowCreateInfo window_create_info = {0};
+    window_create_info.title = "RazorBench";
+    window_create_info.width = 640;
+    window_create_info.height = 360;
+    window_create_info.flags = RE_WINDOW_HIDDEN;
+
+    return re_createWindow(&window_create_info);
+}
+
+static void rb_teardownGraphicsInstance(void* state) {
+    re_Window window = (re_Window)state;
+    re_destroyWindow(&window);
+}
+
+static void rb_runGraphicsInstance(const rb_Benchmark* benchmark, void* state, const uint32_t thread_idx, const uint64_t iterations) {
+    (void)benchmark;
+    (void)thread_idx;
+
+    re_GraphicsInstanceCreateInfo create_info = {0};
+    create_info.window = (re_Window)state;
+    create_info.profile = RE_RENDERER_STANDARD;
+
+    for (uint64_t idx = 0; idx < iterations; ++idx) {
+        re_GraphicsInstance instance = re_createGraphicsInstance(&create_info);
+        re_destroyGraphicsInstance(&instance);
+    }
+}
+
+#endif
+
+// *=================================================
+// *
+// * rb_addEngineBenchmarks
+// *
+// *=================================================
+
+void rb_addEngineBenchmarks(const rb_Options* options) {
+    rb_Benchmark benchmark = {0};
+
+    benchmark.name = "engine/debug_init/cold";
+    benchmark.is_one_shot = true;
+    benchmark.run = rb_runDebugInit;
+    rb_addBenchmark(&benchmark);
+
+    benchmark.name = "engine/core_init/cold";
+    benchmark.run = rb_runCoreInit;
+    rb_addBenchmark(&benchmark);
+
+    benchmark.name = "engine/core_init/initialized";
+    benchmark.is_one_shot = false;
+    benchmark.is_multithreaded = true;
+    rb_addBenchmark(&benchmark);
+
+    if (!options->run_vulkan) {
+        return;
+    }
+
+    #if RE_PLATFORM == RE_PLATFORM_WINDOWS
+    rb_Benchmark graphics_init = {0};
+    graphics_init.name = "engine/graphics_init/cold";
+    graphics_init.is_one_shot = true;
+    graphics_init.run = rb_runGraphicsInit;
+    rb_addBenchmark(&graphics_init);
+
+    // ? A single create/destroy per sample: each one is tens of milliseconds
+    // ? and the repetitions already give the spread.
+    rb_Benchmark graphics_instance = {0};
+    graphics_instance.name = "engine/graphics_instance/create_destroy";
+    graphics_instance.fixed_iterations = 1;
+    graphics_instance.setup = rb_setupGraphicsInstance;
+    graphics_instance.run = rb_runGraphicsInstance;
+    graphics_instance.teardown = rb_teardownGraphicsInstance;
+    rb_addBenchmark(&graphics_instance);
+    #else
+    fprintf(stderr, "The Vulkan benchmarks need a window, which this platform does not implement yet.\n");
+    #endif
+}
\ No newline at end of file
@@ -0,0 +1,196 @@
+#include "./rb_bench.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#define RB_JOB_WORK_ROUNDS 256u
+#define RB_JOB_CHAIN_LENGTH 64u
+
+#define RB_MAX_JOB_VARIANTS 8u
+#define RB_MAX_JOB_VARIANT_NAME 64u
+
+// ? Each job owns a cache line of results: its work value, then how many
+// ? times it ran, which teardown checks against the operations timed.
+typedef struct rb_JobState {
+    re_JobDecl* jobs;
+    uint64_t* results;
+    size_t job_count;
+    uint64_t expected_run_count;
+    re_JobCounter counters[RB_JOB_CHAIN_LENGTH];
+} rb_JobState;
+
+static char rb_job_variant_names[RB_MAX_JOB_VARIANTS][RB_MAX_JOB_VARIANT_NAME];
+static uint32_t rb_job_variant_count = 0;
+
+// *=================================================
+// *
+// * Setup and Teardown
+// *
+// *=================================================
+
+// ? Every job does the same fixed amount of work on its own cache line, so
+// ? the runs only differ in how the work is spread across threads.
+static void rb_runJobWork(void* user_data) {
+    uint64_t* result = (uint64_t*)user_data;
+    uint64_t value = result[0] | 1u;
+
+    for (uint32_t idx = 0; idx < RB_JOB_WORK_ROUNDS; ++idx) {
+        value ^= value << 13;
+        value ^= value >> 7;
+        value ^= value << 17;
+    }
+
+    result[0] = value;
+    ++result[1];
+}
+
+static void* rb_setupJobs(const rb_Benchmark* benchmark, const uint32_t thread_count) {
+    (void)thread_count;
+
+    rb_JobState* job_state = (rb_JobState*)calloc(1, sizeof(rb_JobState));
+    job_state->jobs = (re_JobDecl*)calloc(benchmark->size, sizeof(re_JobDecl));
+    job_state->results = (uint64_t*)calloc(benchmark->size * 8u, sizeof(uint64_t));
+    job_state->job_count = benchmark->size;
+
+    for (size_t idx = 0; idx < benchmark->size; ++idx) {
+        job_state->results[idx * 8u] = idx;
+        job_state->jobs[idx].job_fn = rb_runJobWork;
+        job_state->jobs[idx].user_data = &job_state->results[idx * 8u];
+    }
+
+    for (uint32_t idx = 0; idx < RB_JOB_CHAIN_LENGTH; ++idx) {
+        job_state->counters[idx] = re_createJobCounter();
+    }
+
+    return job_state;
+}
+
+static void rb_teardownJobs(void* state) {
+    rb_JobState* job_state = (rb_JobState*)state;
+
+    // ? Checked outside the timed region: one run per timed operation.
+    uint64_t run_count = 0;
+    for (size_t idx = 0; idx < job_state->job_count; ++idx) {
+        run_count += job_state->results[idx * 8u + 1u];
+    }
+
+    re_assert(run_count == job_state->expected_run_count, "Jobs ran %llu times, expected %llu!", (unsigned long long)run_count, (unsigned long long)job_state->expected_run_count);
+
+    for (uint32_t idx = 0; idx < RB_JOB_CHAIN_LENGTH; ++idx) {
+        re_destroyJobCounter(&job_state->counters[idx]);
+    }
+
+    free(job_state->jobs);
+    free(job_state->results);
+    free(job_state);
+}
+
+// *=================================================
+// *
+// * Runs
+// *
+// *=================================================
+
+// ? One operation is one job. Jobs go out in batches of the benchmark's size
+// ? and each batch is waited on before the next.
+static void rb_runJobsInline(const rb_Benchmark* benchmark, void* state, const uint32_t thread_idx, const uint64_t iterations) {
+    (void)thread_idx;
+
+    rb_JobState* job_state = (rb_JobState*)state;
+    job_state->expected_run_count += iterations;
+
+    for (uint64_t idx = 0; idx < iterations; ++idx) {
+        const re_JobDecl* job = &job_state->jobs[idx % benchmark->size];
+        job->job_fn(job->user_data);
+    }
+
+    rb_clobber(job_state->results);
+}
+
+static void rb_runJobsFanOut(const rb_Benchmark* benchmark, void* state, const uint32_t thread_idx, const uint64_t iterations) {
+    (void)thread_idx;
+
+    rb_JobState* job_state = (rb_JobState*)state;
+    job_state->expected_run_count += iterations;
+
+    uint64_t remaining = iterations;
+
+    while (remaining > 0) {
+        const uint32_t job_count = remaining < benchmark->size ? (uint32_t)remaining : (uint32_t)benchmark->size;
+
+        re_runJobs(job_state->jobs, job_count, job_state->counters[0]);
+        re_waitForJobCounter(job_state->counters[0]);
+
+        remaining -= job_count;
+    }
+
+    rb_clobber(job_state->results);
+}
+
+// ? Each batch depends on the one before it, so this measures the hand-off
+// ? between dependent batches rather than throughput.
+static void rb_runJobsChain(const rb_Benchmark* benchmark, void* state, const uint32_t thread_idx, const uint64_t iterations) {
+    (void)thread_idx;
+
+    rb_JobState* job_state = (rb_JobState*)state;
+    job_state->expected_run_count += iterations;
+
+    uint64_t remaining = iterations;
+
+    while (remaining > 0) {
+        uint32_t link_count = 0;
+
+        for (; link_count < RB_JOB_CHAIN_LENGTH && remaining > 0; ++link_count) {
+            const uint32_t job_count = remaining < benchmark->size ? (uint32_t)remaining : (uint32_t)benchmark->size;
+
+            if (link_count == 0) {
+                re_runJobs(job_state->jobs, job_count, job_state->counters[0]);
+            }
+            else {
+                re_runJobsAfter(job_state->jobs, job_count, job_state->counters[link_count - 1u], job_state->counters[link_count]);
+            }
+
+            remaining -= job_count;
+        }
+
+        re_waitForJobCounter(job_state->counters[link_count - 1u]);
+    }
+
+    rb_clobber(job_state->results);
+}
+
+// *=================================================
+// *
+// * rb_addJobBenchmark
+// *
+// *=================================================
+
+static void rb_addJobBenchmark(const char* operation, const size_t size, const char* variant, const rb_RunFn run) {
+    char* name = rb_job_variant_names[rb_job_variant_count++];
+    snprintf(name, RB_MAX_JOB_VARIANT_NAME, "jobs/%s/%zu/%s", operation, size, variant);
+
+    rb_Benchmark benchmark = {0};
+    benchmark.name = name;
+    benchmark.size = size;
+    benchmark.setup = rb_setupJobs;
+    benchmark.run = run;
+    benchmark.teardown = rb_teardownJobs;
+
+    rb_addBenchmark(&benchmark);
+}
+
+// *=================================================
+// *
+// * rb_addJobBenchmarks
+// *
+// *=================================================
+
+void rb_addJobBenchmarks() {
+    static const size_t batch_sizes[] = { 16u, 1024u };
+
+    for (uint32_t idx = 0; idx < sizeof(batch_sizes) / sizeof(batch_sizes[0]); ++idx) {
+        rb_addJobBenchmark("fan_out", batch_sizes[idx], "inline", rb_runJobsInline);
+        rb_addJobBenchmark("fan_out", batch_sizes[idx], "re_runJobs", rb_runJobsFanOut);
+        rb_addJobBenchmark("chain", batch_sizes[idx], "re_runJobsAfter", rb_runJobsChain);
+    }
+}
\ No newline at end of file
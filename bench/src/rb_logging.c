@@ -0,0 +1,70 @@
+#include "./rb_bench.h"
+
+#define RB_LOG_FILE_PATH "razor_bench.log"
+
+// ? Console output is bounded to a fixed count rather than calibrated, so the
+// ? benchmark does not bury the results under millions of lines.
+#define RB_CONSOLE_LOG_ITERATIONS 4096u
+
+static void* rb_setupFileLog(const rb_Benchmark* benchmark, const uint32_t thread_count) {
+    (void)benchmark;
+    (void)thread_count;
+
+    re_setLogFile(RB_LOG_FILE_PATH);
+
+    return RE_NULL_HANDLE;
+}
+
+static void* rb_setupConsoleLog(const rb_Benchmark* benchmark, const uint32_t thread_count) {
+    (void)benchmark;
+    (void)thread_count;
+
+    re_closeLogFile();
+
+    return RE_NULL_HANDLE;
+}
+
+static void rb_runLog(const rb_Benchmark* benchmark, void* state, const uint32_t thread_idx, const uint64_t iterations) {
+    (void)benchmark;
+    (void)state;
+
+    for (uint64_t idx = 0; idx < iterations; ++idx) {
+        re_logInfo("bench thread %u iteration %llu value %f", thread_idx, (unsigned long long)idx, (double)idx * 0.5);
+    }
+}
+
+// ? Timed: the cost of a log call includes draining it to its output.
+static void rb_finishLog(void* state) {
+    (void)state;
+    re_flushLog();
+}
+
+static void rb_teardownLog(void* state) {
+    (void)state;
+
+    re_flushLog();
+    re_closeLogFile();
+}
+
+// *=================================================
+// *
+// * rb_addLoggingBenchmarks
+// *
+// *=================================================
+
+void rb_addLoggingBenchmarks() {
+    rb_Benchmark benchmark = {0};
+    benchmark.is_multithreaded = true;
+    benchmark.run = rb_runLog;
+    benchmark.finish = rb_finishLog;
+    benchmark.teardown = rb_teardownLog;
+
+    benchmark.name = "logging/info/file";
+    benchmark.setup = rb_setupFileLog;
+    rb_addBenchmark(&benchmark);
+
+    benchmark.name = "logging/info/console";
+    benchmark.setup = rb_setupConsoleLog;
+    benchmark.fixed_iterations = RB_CONSOLE_LOG_ITERATIONS;
+    rb_addBenchmark(&benchmark);
+}
\ No newline at end of file
@@ -0,0 +1,187 @@
+#include "./rb_bench.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#define RB_BUFFER_ALIGNMENT 64u
+
+typedef struct rb_BufferState {
+    void* src[RB_MAX_THREADS];
+    void* dst[RB_MAX_THREADS];
+    uint32_t thread_count;
+} rb_BufferState;
+
+// *=================================================
+// *
+// * Allocation
+// *
+// *=================================================
+
+static void rb_runMalloc(const rb_Benchmark* benchmark, void* state, const uint32_t thread_idx, const uint64_t iterations) {
+    (void)state;
+    (void)thread_idx;
+
+    for (uint64_t idx = 0; idx < iterations; ++idx) {
+        void* ptr = re_malloc(benchmark->size);
+        rb_clobber(ptr);
+        re_free(ptr);
+    }
+}
+
+static void rb_runMallocAlign(const rb_Benchmark* benchmark, void* state, const uint32_t thread_idx, const uint64_t iterations) {
+    (void)state;
+    (void)thread_idx;
+
+    for (uint64_t idx = 0; idx < iterations; ++idx) {
+        void* ptr = re_mallocAlign(benchmark->size, RB_BUFFER_ALIGNMENT);
+        rb_clobber(ptr);
+        re_freeAlign(ptr);
+    }
+}
+
+// *=================================================
+// *
+// * Memory Operations
+// *
+// *=================================================
+
+static void* rb_setupBuffers(const rb_Benchmark* benchmark, const uint32_t thread_count) {
+    rb_BufferState* state = (rb_BufferState*)calloc(1, sizeof(rb_BufferState));
+    state->thread_count = thread_count;
+
+    // ? Every thread gets its own buffers so that the threads only share the
+    // ? memory bus, not cache lines.
+    for (uint32_t idx = 0; idx < thread_count; ++idx) {
+        state->src[idx] = re_mallocAlign(benchmark->size, RB_BUFFER_ALIGNMENT);
+        state->dst[idx] = re_mallocAlign(benchmark->size, RB_BUFFER_ALIGNMENT);
+
+        re_memset(state->src[idx], 0x5a, benchmark->size);
+        re_memset(state->dst[idx], 0, benchmark->size);
+    }
+
+    return state;
+}
+
+static void rb_teardownBuffers(void* state) {
+    rb_BufferState* buffers = (rb_BufferState*)state;
+
+    for (uint32_t idx = 0; idx < buffers->thread_count; ++idx) {
+        re_freeAlign(buffers->src[idx]);
+        re_freeAlign(buffers->dst[idx]);
+    }
+
+    free(buffers);
+}
+
+static void rb_runMemcpy(const rb_Benchmark* benchmark, void* state, const uint32_t thread_idx, const uint64_t iterations) {
+    rb_BufferState* buffers = (rb_BufferState*)state;
+    void* dst = buffers->dst[thread_idx];
+    const void* src = buffers->src[thread_idx];
+
+    for (uint64_t idx = 0; idx < iterations; ++idx) {
+        re_memcpy(dst, src, benchmark->size);
+        rb_clobber(dst);
+    }
+}
+
+static void rb_runMemcpyLibc(const rb_Benchmark* benchmark, void* state, const uint32_t thread_idx, const uint64_t iterations) {
+    rb_BufferState* buffers = (rb_BufferState*)state;
+    void* dst = buffers->dst[thread_idx];
+    const void* src = buffers->src[thread_idx];
+
+    for (uint64_t idx = 0; idx < iterations; ++idx) {
+        memcpy(dst, src, benchmark->size);
+        rb_clobber(dst);
+    }
+}
+
+static void rb_runMemset(const rb_Benchmark* benchmark, void* state, const uint32_t thread_idx, const uint64_t iterations) {
+    rb_BufferState* buffers = (rb_BufferState*)state;
+    void* dst = buffers->dst[thread_idx];
+
+    for (uint64_t idx = 0; idx < iterations; ++idx) {
+        re_memset(dst, (int)(idx & 0xff), benchmark->size);
+        rb_clobber(dst);
+    }
+}
+
+static void rb_runMemsetLibc(const rb_Benchmark* benchmark, void* state, const uint32_t thread_idx, const uint64_t iterations) {
+    rb_BufferState* buffers = (rb_BufferState*)state;
+    void* dst = buffers->dst[thread_idx];
+
+    for (uint64_t idx = 0; idx < iterations; ++idx) {
+        memset(dst, (int)(idx & 0xff), benchmark->size);
+        rb_clobber(dst);
+    }
+}
+
+// *=================================================
+// *
+// * rb_addMemoryBenchmarks
+// *
+// *=================================================
+
+void rb_addMemoryBenchmarks() {
+    static const struct { const char* name; size_t size; } allocations[] = {
+        { "memory/malloc_free/16", 16u },
+        { "memory/malloc_free/256", 256u },
+        { "memory/malloc_free/4096", 4096u },
+    };
+
+    for (uint32_t idx = 0; idx < sizeof(allocations) / sizeof(allocations[0]); ++idx) {
+        rb_Benchmark benchmark = {0};
+        benchmark.name = allocations[idx].name;
+        benchmark.size = allocations[idx].size;
+        benchmark.is_multithreaded = true;
+        benchmark.run = rb_runMalloc;
+
+        rb_addBenchmark(&benchmark);
+    }
+
+    rb_Benchmark aligned = {0};
+    aligned.name = "memory/malloc_align_free/256";
+    aligned.size = 256u;
+    aligned.is_multithreaded = true;
+    aligned.run = rb_runMallocAlign;
+
+    rb_addBenchmark(&aligned);
+
+    // ? libc runs alongside each size as the baseline; the sizes past the
+    // ? default 4 MiB streaming threshold are where re_memcpy/re_memset switch
+    // ? to non-temporal stores.
+    static const struct { const char* name; size_t size; rb_RunFn run; } operations[] = {
+        { "memory/memcpy/64/re_memcpy", 64u, rb_runMemcpy },
+        { "memory/memcpy/64/memcpy", 64u, rb_runMemcpyLibc },
+        { "memory/memset/64/re_memset", 64u, rb_runMemset },
+        { "memory/memset/64/memset", 64u, rb_runMemsetLibc },
+        { "memory/memcpy/4096/re_memcpy", 4096u, rb_runMemcpy },
+        { "memory/memcpy/4096/memcpy", 4096u, rb_runMemcpyLibc },
+        { "memory/memset/4096/re_memset", 4096u, rb_runMemset },
+        { "memory/memset/4096/memset", 4096u, rb_runMemsetLibc },
+        { "memory/memcpy/1048576/re_memcpy", 1048576u, rb_runMemcpy },
+        { "memory/memcpy/1048576/memcpy", 1048576u, rb_runMemcpyLibc },
+        { "memory/memset/1048576/re_memset", 1048576u, rb_runMemset },
+        { "memory/memset/1048576/memset", 1048576u, rb_runMemsetLibc },
+        { "memory/memcpy/8388608/re_memcpy", 8388608u, rb_runMemcpy },
+        { "memory/memcpy/8388608/memcpy", 8388608u, rb_runMemcpyLibc },
+        { "memory/memset/8388608/re_memset", 8388608u, rb_runMemset },
+        { "memory/memset/8388608/memset", 8388608u, rb_runMemsetLibc },
+        { "memory/memcpy/33554432/re_memcpy", 33554432u, rb_runMemcpy },
+        { "memory/memcpy/33554432/memcpy", 33554432u, rb_runMemcpyLibc },
+        { "memory/memset/33554432/re_memset", 33554432u, rb_runMemset },
+        { "memory/memset/33554432/memset", 33554432u, rb_runMemsetLibc },
+    };
+
+    for (uint32_t idx = 0; idx < sizeof(operations) / sizeof(operations[0]); ++idx) {
+        rb_Benchmark benchmark = {0};
+        benchmark.name = operations[idx].name;
+        benchmark.size = operations[idx].size;
+        benchmark.reports_bytes = true;
+        benchmark.is_multithreaded = true;
+        benchmark.setup = rb_setupBuffers;
+        benchmark.run = operations[idx].run;
+        benchmark.teardown = rb_teardownBuffers;
+
+        rb_addBenchmark(&benchmark);
+    }
+}
\ No newline at end of file
@@ -0,0 +1,285 @@
+#include "./rb_bench.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define RB_SHORT_STRING_LENGTH 16u
+#define RB_LONG_STRING_LENGTH 1024u
+
+#define RB_MAX_STRING_VARIANTS 32u
+#define RB_MAX_STRING_VARIANT_NAME 64u
+
+typedef bool (*rb_StrEqualFn)(const char* str_a, const char* str_b);
+typedef size_t (*rb_StrLengthFn)(const char* str);
+typedef uint64_t (*rb_StrHashFn)(const char* data, const size_t length);
+
+// ? One implementation on one input; exactly one of the functions is set.
+typedef struct rb_StringVariant {
+    char name[RB_MAX_STRING_VARIANT_NAME];
+    bool differ_early;
+
+    rb_StrEqualFn equal_fn;
+    rb_StrLengthFn length_fn;
+    rb_StrHashFn hash_fn;
+} rb_StringVariant;
+
+typedef struct rb_StringState {
+    const rb_StringVariant* variant;
+    char* str_a;
+    char* str_b;
+} rb_StringState;
+
+static rb_StringVariant rb_string_variants[RB_MAX_STRING_VARIANTS];
+static uint32_t rb_string_variant_count = 0;
+
+// *=================================================
+// *
+// * Baselines
+// *
+// *=================================================
+
+// ? The byte loop re_isStrEqual used to be, kept as the reference point.
+static bool rb_isStrEqualScalar(const char* str_a, const char* str_b) {
+    while (*str_a != '\0' && *str_b != '\0') {
+        if (*str_a != *str_b) {
+            return false;
+        }
+
+        ++str_a;
+        ++str_b;
+    }
+
+    return *str_a == *str_b;
+}
+
+static bool rb_isStrEqualLibc(const char* str_a, const char* str_b) {
+    return strcmp(str_a, str_b) == 0;
+}
+
+static size_t rb_getStrLengthScalar(const char* str) {
+    const char* end = str;
+    while (*end != '\0') {
+        ++end;
+    }
+
+    return (size_t)(end - str);
+}
+
+static size_t rb_getStrLengthLibc(const char* str) {
+    return strlen(str);
+}
+
+// ? 64-bit FNV-1a, the usual "simple" string hash.
+static uint64_t rb_hashStrFnv(const char* data, const size_t length) {
+    uint64_t hash = 14695981039346656037ull;
+
+    for (size_t idx = 0; idx < length; ++idx) {
+        hash ^= (uint8_t)data[idx];
+        hash *= 1099511628211ull;
+    }
+
+    return hash;
+}
+
+// *=================================================
+// *
+// * Setup
+// *
+// *=================================================
+
+// ? The two strings are separate allocations so that a compare can never
+// ? short-circuit on pointer equality.
+static void* rb_setupStrings(const rb_Benchmark* benchmark, const uint32_t thread_count) {
+    (void)thread_count;
+
+    const size_t length = benchmark->size;
+
+    rb_StringState* state = (rb_StringState*)malloc(sizeof(rb_StringState));
+    state->variant = (const rb_StringVariant*)benchmark->user_data;
+    state->str_a = (char*)malloc(length + 1u);
+    state->str_b = (char*)malloc(length + 1u);
+
+    for (size_t idx = 0; idx < length; ++idx) {
+        state->str_a[idx] = (char)('a' + idx % 26u);
+    }
+
+    state->str_a[length] = '\0';
+    memcpy(state->str_b, state->str_a, length + 1u);
+
+    if (state->variant->differ_early) {
+        state->str_b[0] = '#';
+    }
+
+    return state;
+}
+
+static void rb_teardownStrings(void* state) {
+    rb_StringState* strings = (rb_StringState*)state;
+
+    free(strings->str_a);
+    free(strings->str_b);
+    free(strings);
+}
+
+// *=================================================
+// *
+// * Runs
+// *
+// *=================================================
+
+// ? Calls go through the variant's function pointer (the clobber keeps it
+// ? opaque), so libc calls cannot be specialized or hoisted out of the loop.
+
+static void rb_runStrEqual(const rb_Benchmark* benchmark, void* state, const uint32_t thread_idx, const uint64_t iterations) {
+    (void)benchmark;
+    (void)thread_idx;
+
+    const rb_StringState* strings = (const rb_StringState*)state;
+    rb_StrEqualFn equal_fn = strings->variant->equal_fn;
+    uint64_t match_count = 0;
+
+    for (uint64_t idx = 0; idx < iterations; ++idx) {
+        rb_clobber(equal_fn);
+        rb_clobber(strings->str_a);
+        match_count += equal_fn(strings->str_a, strings->str_b);
+    }
+
+    rb_clobber(&match_count);
+}
+
+static void rb_runStrLength(const rb_Benchmark* benchmark, void* state, const uint32_t thread_idx, const uint64_t iterations) {
+    (void)benchmark;
+    (void)thread_idx;
+
+    const rb_StringState* strings = (const rb_StringState*)state;
+    rb_StrLengthFn length_fn = strings->variant->length_fn;
+    size_t total_length = 0;
+
+    for (uint64_t idx = 0; idx < iterations; ++idx) {
+        rb_clobber(length_fn);
+        rb_clobber(strings->str_a);
+        total_length += length_fn(strings->str_a);
+    }
+
+    rb_clobber(&total_length);
+}
+
+static void rb_runStrHash(const rb_Benchmark* benchmark, void* state, const uint32_t thread_idx, const uint64_t iterations) {
+    (void)thread_idx;
+
+    const rb_StringState* strings = (const rb_StringState*)state;
+    rb_StrHashFn hash_fn = strings->variant->hash_fn;
+    uint64_t hash = 0;
+
+    for (uint64_t idx = 0; idx < iterations; ++idx) {
+        rb_clobber(hash_fn);
+        rb_clobber(strings->str_a);
+        hash ^= hash_fn(strings->str_a, benchmark->size);
+    }
+
+    rb_clobber(&hash);
+}
+
+// *=================================================
+// *
+// * rb_addStringBenchmark
+// *
+// *=================================================
+
+static rb_StringVariant* rb_addStringBenchmark(
+    const char* group,
+    const char* input,
+    const char* impl,
+    const size_t size,
+    const bool differ_early,
+    const rb_RunFn run
+) {
+    rb_StringVariant* variant = &rb_string_variants[rb_string_variant_count++];
+    snprintf(variant->name, RB_MAX_STRING_VARIANT_NAME, "strings/%s/%s/%s", group, input, impl);
+    variant->differ_early = differ_early;
+
+    rb_Benchmark benchmark = {0};
+    benchmark.name = variant->name;
+    benchmark.size = size;
+    // ? Differing at the first byte compares one byte, so bytes/s would be meaningless.
+    benchmark.reports_bytes = !differ_early;
+    benchmark.user_data = variant;
+    benchmark.setup = rb_setupStrings;
+    benchmark.run = run;
+    benchmark.teardown = rb_teardownStrings;
+
+    rb_addBenchmark(&benchmark);
+
+    return variant;
+}
+
+// *=================================================
+// *
+// * rb_addStringBenchmarks
+// *
+// *=================================================
+
+void rb_addStringBenchmarks() {
+    static const struct { const char* name; rb_StrEqualFn fn; } equal_impls[] = {
+        { "re_isStrEqual", re_isStrEqual },
+        { "scalar", rb_isStrEqualScalar },
+        { "strcmp", rb_isStrEqualLibc },
+    };
+
+    static const struct { const char* name; rb_StrLengthFn fn; } length_impls[] = {
+        { "re_getStrLength", re_getStrLength },
+        { "scalar", rb_getStrLengthScalar },
+        { "strlen", rb_getStrLengthLibc },
+    };
+
+    static const struct { const char* name; rb_StrHashFn fn; } hash_impls[] = {
+        { "re_hashStr", re_hashStr },
+        { "fnv1a", rb_hashStrFnv },
+    };
+
+    static const struct { const char* name; size_t size; bool differ_early; } inputs[] = {
+        { "short", RB_SHORT_STRING_LENGTH, false },
+        { "long", RB_LONG_STRING_LENGTH, false },
+        { "differ_early", RB_LONG_STRING_LENGTH, true },
+    };
+
+    for (uint32_t idx = 0; idx < sizeof(inputs) / sizeof(inputs[0]); ++idx) {
+        for (uint32_t jdx = 0; jdx < sizeof(equal_impls) / sizeof(equal_impls[0]); ++jdx) {
+            rb_addStringBenchmark(
+                "equal",
+                inputs[idx].name,
+                equal_impls[jdx].name,
+                inputs[idx].size,
+                inputs[idx].differ_early,
+                rb_runStrEqual
+            )->equal_fn = equal_impls[jdx].fn;
+        }
+
+        if (inputs[idx].differ_early) {
+            continue;
+        }
+
+        for (uint32_t jdx = 0; jdx < sizeof(length_impls) / sizeof(length_impls[0]); ++jdx) {
+            rb_addStringBenchmark(
+                "length",
+                inputs[idx].name,
+                length_impls[jdx].name,
+                inputs[idx].size,
+                false,
+                rb_runStrLength
+            )->length_fn = length_impls[jdx].fn;
+        }
+
+        for (uint32_t jdx = 0; jdx < sizeof(hash_impls) / sizeof(hash_impls[0]); ++jdx) {
+            rb_addStringBenchmark(
+                "hash",
+                inputs[idx].name,
+                hash_impls[jdx].name,
+                inputs[idx].size,
+                false,
+                rb_runStrHash
+            )->hash_fn = hash_impls[jdx].fn;
+        }
+    }
+}
\ No newline at end of file
@@ -32,6 +32,9 @@ int main(void) {
 
     re_GraphicsInstance graphics_instance = re_createGraphicsInstance(&graphics_instance_create_info);
 
+    // ? Startup breakdown: every engine init phase is a profiler scope.
+    re_logProfileReport();
+
     is_running = true;
     while (is_running) {
         re_pollEvents(window);
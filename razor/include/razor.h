@@ -4,6 +4,8 @@
 #include "./re_core.h"
 #include "./re_debug.h"
 #include "./re_utils.h"
+#include "./re_containers.h"
+#include "./re_profile.h"
 #include "./re_graphics.h"
 
 #ifdef __cplusplus
@@ -0,0 +1,363 @@
+#ifndef __RAZOR_CONTAINERS_HEADER_FILE
+#define __RAZOR_CONTAINERS_HEADER_FILE
+
+#ifdef __cplusplus
+    extern "C" {
+#endif
+
+#include "./re_core.h"
+
+// ? Container storage is aligned to (at least) a cache line by default, which
+// ? also covers every SIMD load width the engine targets.
+#define RE_CONTAINER_DEFAULT_ALIGNMENT 64u
+
+// *=================================================
+// *
+// * Dynamic Arrays
+// *
+// *=================================================
+
+// ? Elements are stored contiguously. The storage is allocated in whole
+// ? multiples of the alignment, so a SIMD loop over the data may read past the
+// ? last element up to the next aligned boundary.
+typedef struct re_Array_T re_Array_T;
+typedef re_Array_T* re_Array;
+
+typedef struct re_ArrayCreateInfo {
+    size_t element_size;
+    size_t alignment;
+    uint32_t capacity;
+
+    const re_Allocator* allocator;
+} re_ArrayCreateInfo;
+
+/// @brief Create a new dynamic array.
+/// @param create_info The array's creation parameters (an alignment of 0 uses RE_CONTAINER_DEFAULT_ALIGNMENT, a NULL allocator uses the heap).
+/// @return A new dynamic array.
+RE_API re_Array re_createArray(const re_ArrayCreateInfo* create_info);
+
+/// @brief Destroy a dynamic array, returning its memory to its allocator.
+/// @param array A pointer to the array to destroy.
+RE_API void re_destroyArray(re_Array* array);
+
+/// @brief Get the (aligned) start of an array's elements. Pushing past the capacity may move them.
+/// @param array The array.
+/// @return A pointer to the first element.
+RE_API void* re_getArrayData(const re_Array array);
+
+/// @brief Get a pointer to one element of an array.
+/// @param array The array.
+/// @param index The element's index.
+/// @return A pointer to the element.
+RE_API void* re_getArrayElement(const re_Array array, const uint32_t index);
+
+/// @brief Get the number of elements in an array.
+/// @param array The array.
+/// @return The element count.
+RE_API uint32_t re_getArrayCount(const re_Array array);
+
+/// @brief Get the number of elements an array can hold before it has to grow.
+/// @param array The array.
+/// @return The element capacity.
+RE_API uint32_t re_getArrayCapacity(const re_Array array);
+
+/// @brief Make sure an array can hold some number of elements without growing.
+/// @param array The array.
+/// @param capacity The element count to make room for.
+/// @return A flag determining if the array could make room.
+RE_API bool re_reserveArray(re_Array array, const uint32_t capacity);
+
+/// @brief Resize an array, zeroing any new elements.
+/// @param array The array.
+/// @param count The new element count.
+/// @return A flag determining if the array could grow to the new count.
+RE_API bool re_resizeArray(re_Array array, const uint32_t count);
+
+/// @brief Append an element to an array.
+/// @param array The array.
+/// @param element A pointer to the element to copy in (NULL appends a zeroed element).
+/// @return A pointer to the new element, or NULL if the array could not grow.
+RE_API void* re_arrayPush(re_Array array, const void* element);
+
+/// @brief Append several elements to an array.
+/// @param array The array.
+/// @param elements The elements to copy in (NULL appends zeroed elements).
+/// @param count The number of elements to append.
+/// @return A pointer to the first new element, or NULL if the array could not grow.
+RE_API void* re_arrayPushMany(re_Array array, const void* elements, const uint32_t count);
+
+/// @brief Remove the last element of an array.
+/// @param array The array (must not be empty).
+/// @param element A pointer to copy the removed element to (may be NULL).
+RE_API void re_arrayPop(re_Array array, void* element);
+
+/// @brief Remove an element, shifting every later element down by one.
+/// @param array The array.
+/// @param index The index of the element to remove.
+RE_API void re_arrayRemove(re_Array array, const uint32_t index);
+
+/// @brief Remove an element by moving the last element into its place (does not keep the order).
+/// @param array The array.
+/// @param index The index of the element to remove.
+RE_API void re_arrayRemoveSwap(re_Array array, const uint32_t index);
+
+/// @brief Remove every element from an array, keeping its storage.
+/// @param array The array.
+RE_API void re_clearArray(re_Array array);
+
+// *=================================================
+// *
+// * Structure-of-Arrays Columns
+// *
+// *=================================================
+
+#define RE_SOA_MAX_COLUMNS 16u
+
+// ? Rows are split into columns that each live in their own contiguous, aligned
+// ? run of one shared block, so a pass touching one field streams through just
+// ? that column. Rows are only ever removed by swapping the last row in.
+typedef struct re_Soa_T re_Soa_T;
+typedef re_Soa_T* re_Soa;
+
+typedef struct re_SoaCreateInfo {
+    const size_t* column_sizes;
+    uint32_t column_count;
+
+    size_t alignment;
+    uint32_t capacity;
+
+    const re_Allocator* allocator;
+} re_SoaCreateInfo;
+
+/// @brief Create a new structure-of-arrays container.
+/// @param create_info The container's creation parameters (an alignment of 0 uses RE_CONTAINER_DEFAULT_ALIGNMENT, a NULL allocator uses the heap).
+/// @return A new structure-of-arrays container.
+RE_API re_Soa re_createSoa(const re_SoaCreateInfo* create_info);
+
+/// @brief Destroy a structure-of-arrays container, returning its memory to its allocator.
+/// @param soa A pointer to the container to destroy.
+RE_API void re_destroySoa(re_Soa* soa);
+
+/// @brief Get the (aligned) start of one column. Pushing past the capacity may move it.
+/// @param soa The container.
+/// @param column The column's index.
+/// @return A pointer to the column's first value.
+RE_API void* re_getSoaColumn(const re_Soa soa, const uint32_t column);
+
+/// @brief Get a pointer to one value of a column.
+/// @param soa The container.
+/// @param column The column's index.
+/// @param row The row's index.
+/// @return A pointer to the value.
+RE_API void* re_getSoaElement(const re_Soa soa, const uint32_t column, const uint32_t row);
+
+/// @brief Get the number of rows in a structure-of-arrays container.
+/// @param soa The container.
+/// @return The row count.
+RE_API uint32_t re_getSoaCount(const re_Soa soa);
+
+/// @brief Get the number of rows a structure-of-arrays container can hold before it has to grow.
+/// @param soa The container.
+/// @return The row capacity.
+RE_API uint32_t re_getSoaCapacity(const re_Soa soa);
+
+/// @brief Make sure a structure-of-arrays container can hold some number of rows without growing.
+/// @param soa The container.
+/// @param capacity The row count to make room for.
+/// @return A flag determining if the container could make room.
+RE_API bool re_reserveSoa(re_Soa soa, const uint32_t capacity);
+
+/// @brief Resize a structure-of-arrays container, zeroing any new rows.
+/// @param soa The container.
+/// @param count The new row count.
+/// @return A flag determining if the container could grow to the new count.
+RE_API bool re_resizeSoa(re_Soa soa, const uint32_t count);
+
+/// @brief Append a zeroed row to a structure-of-arrays container.
+/// @param soa The container.
+/// @return The new row's index, or UINT32_MAX if the container could not grow.
+RE_API uint32_t re_soaPush(re_Soa soa);
+
+/// @brief Remove a row by moving the last row into its place.
+/// @param soa The container.
+/// @param row The index of the row to remove.
+RE_API void re_soaRemoveSwap(re_Soa soa, const uint32_t row);
+
+/// @brief Remove every row from a structure-of-arrays container, keeping its storage.
+/// @param soa The container.
+RE_API void re_clearSoa(re_Soa soa);
+
+// *=================================================
+// *
+// * Hash Maps
+// *
+// *=================================================
+
+// ? An open-addressed map of fixed-size keys to fixed-size values. Each slot
+// ? has a control byte holding 7 bits of its key's hash, and lookups compare a
+// ? whole group of 16 control bytes at once, so keys are only compared on a
+// ? likely match. Only inserts (and reserves) move entries: one that runs out
+// ? of room rehashes every key and value. Removing never moves any.
+typedef struct re_HashMap_T re_HashMap_T;
+typedef re_HashMap_T* re_HashMap;
+
+typedef uint64_t(*re_HashMapHashFn)(const void* key, const size_t key_size);
+typedef bool(*re_HashMapEqualFn)(const void* key_a, const void* key_b, const size_t key_size);
+
+typedef struct re_HashMapCreateInfo {
+    size_t key_size;
+    size_t value_size;
+    uint32_t capacity;
+
+    re_HashMapHashFn hash_fn;
+    re_HashMapEqualFn equal_fn;
+
+    const re_Allocator* allocator;
+} re_HashMapCreateInfo;
+
+/// @brief Create a new hash map.
+/// @param create_info The map's creation parameters (NULL functions hash and compare the key's bytes, a value size of 0 makes a set, a NULL allocator uses the heap).
+/// @return A new hash map.
+RE_API re_HashMap re_createHashMap(const re_HashMapCreateInfo* create_info);
+
+/// @brief Destroy a hash map, returning its memory to its allocator.
+/// @param map A pointer to the map to destroy.
+RE_API void re_destroyHashMap(re_HashMap* map);
+
+/// @brief Get the number of entries in a hash map.
+/// @param map The map.
+/// @return The entry count.
+RE_API uint32_t re_getHashMapCount(const re_HashMap map);
+
+/// @brief Make sure a hash map can hold some number of entries without growing.
+/// @param map The map.
+/// @param count The entry count to make room for.
+/// @return A flag determining if the map could make room.
+RE_API bool re_reserveHashMap(re_HashMap map, const uint32_t count);
+
+/// @brief Look up a key.
+/// @param map The map.
+/// @param key A pointer to the key.
+/// @return A pointer to the key's value (or to the stored key for a set), or NULL if the key is absent.
+RE_API void* re_hashMapFind(const re_HashMap map, const void* key);
+
+/// @brief Look up a key, adding it with a zeroed value if it is absent.
+/// @param map The map.
+/// @param key A pointer to the key.
+/// @param is_new A pointer to store whether the key was added (may be NULL).
+/// @return A pointer to the key's value (or to the stored key for a set), or NULL if the map could not grow.
+RE_API void* re_hashMapFindOrInsert(re_HashMap map, const void* key, bool* is_new);
+
+/// @brief Add a key or replace its value.
+/// @param map The map.
+/// @param key A pointer to the key.
+/// @param value A pointer to the value to copy in (ignored for a set).
+/// @return A pointer to the key's value (or to the stored key for a set), or NULL if the map could not grow.
+RE_API void* re_hashMapInsert(re_HashMap map, const void* key, const void* value);
+
+/// @brief Remove a key.
+/// @param map The map.
+/// @param key A pointer to the key.
+/// @return A flag indicating if the key was present.
+RE_API bool re_hashMapRemove(re_HashMap map, const void* key);
+
+/// @brief Step through a hash map's entries (in no particular order).
+/// @param map The map (must not be changed while iterating).
+/// @param iterator A cursor that must start at 0.
+/// @param key A pointer to store the entry's key pointer in (may be NULL).
+/// @param value A pointer to store the entry's value pointer in (may be NULL).
+/// @return A flag indicating if an entry was found; false once every entry has been visited.
+RE_API bool re_hashMapNext(const re_HashMap map, uint32_t* iterator, const void** key, void** value);
+
+/// @brief Remove every entry from a hash map, keeping its storage.
+/// @param map The map.
+RE_API void re_clearHashMap(re_HashMap map);
+
+// *=================================================
+// *
+// * Generational Slot Maps
+// *
+// *=================================================
+
+// ? A handle packs a slot index (low 32 bits) with the slot's generation
+// ? (high 32 bits). Removing a value bumps its slot's generation, so a stale
+// ? handle fails a single compare instead of reaching reused memory.
+typedef uint64_t re_Handle;
+
+#define RE_HANDLE_NULL 0ull
+
+#define RE_HANDLE_INDEX(handle) ((uint32_t)((handle) & 0xffffffffull))
+#define RE_HANDLE_GENERATION(handle) ((uint32_t)((handle) >> 32))
+
+// ? Values are kept densely packed (removal moves the last value into the
+// ? hole), so iterating over the data pointer touches live values only.
+// ? Handles stay valid across moves; pointers to values do not.
+typedef struct re_SlotMap_T re_SlotMap_T;
+typedef re_SlotMap_T* re_SlotMap;
+
+typedef struct re_SlotMapCreateInfo {
+    size_t value_size;
+    size_t alignment;
+    uint32_t capacity;
+
+    const re_Allocator* allocator;
+} re_SlotMapCreateInfo;
+
+/// @brief Create a new generational slot map.
+/// @param create_info The slot map's creation parameters (an alignment of 0 uses RE_CONTAINER_DEFAULT_ALIGNMENT, a NULL allocator uses the heap).
+/// @return A new slot map.
+RE_API re_SlotMap re_createSlotMap(const re_SlotMapCreateInfo* create_info);
+
+/// @brief Destroy a slot map, returning its memory to its allocator.
+/// @param map A pointer to the slot map to destroy.
+RE_API void re_destroySlotMap(re_SlotMap* map);
+
+/// @brief Add a value to a slot map.
+/// @param map The slot map.
+/// @param value A pointer to the value to copy in (NULL adds a zeroed value).
+/// @return The value's handle, or RE_HANDLE_NULL if the slot map could not grow.
+RE_API re_Handle re_slotMapInsert(re_SlotMap map, const void* value);
+
+/// @brief Remove a value from a slot map, invalidating its handle.
+/// @param map The slot map.
+/// @param handle The value's handle.
+/// @return A flag indicating if the handle was valid.
+RE_API bool re_slotMapRemove(re_SlotMap map, const re_Handle handle);
+
+/// @brief Determine if a handle still refers to a value in a slot map.
+/// @param map The slot map.
+/// @param handle Some handle.
+/// @return A flag indicating if the handle is valid.
+RE_API bool re_isSlotMapHandleValid(const re_SlotMap map, const re_Handle handle);
+
+/// @brief Get the value a handle refers to.
+/// @param map The slot map.
+/// @param handle The value's handle.
+/// @return A pointer to the value (valid until the slot map is next changed), or NULL for a stale handle.
+RE_API void* re_slotMapGet(const re_SlotMap map, const re_Handle handle);
+
+/// @brief Get the (aligned) start of a slot map's densely packed values.
+/// @param map The slot map.
+/// @return A pointer to the first value.
+RE_API void* re_getSlotMapData(const re_SlotMap map);
+
+/// @brief Get the number of values in a slot map.
+/// @param map The slot map.
+/// @return The value count.
+RE_API uint32_t re_getSlotMapCount(const re_SlotMap map);
+
+/// @brief Get the handle of a value by its position in the dense data.
+/// @param map The slot map.
+/// @param index The value's index into the data (below the count).
+/// @return The value's handle.
+RE_API re_Handle re_getSlotMapHandle(const re_SlotMap map, const uint32_t index);
+
+/// @brief Remove every value from a slot map, invalidating every handle but keeping its storage.
+/// @param map The slot map.
+RE_API void re_clearSlotMap(re_SlotMap map);
+
+#ifdef __cplusplus
+    }
+#endif
+
+#endif
\ No newline at end of file
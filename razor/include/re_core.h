@@ -7,6 +7,7 @@
     #include <stdbool.h>
 #endif
 
+#include <stddef.h>
 #include <stdint.h>
 
 // *=================================================
@@ -124,6 +125,13 @@ typedef struct re_CoreInitParams {
     uint8_t app_major_version;
     uint8_t app_minor_version;
     uint8_t app_patch_version;
+
+    // ? 0 starts one job worker per detected core. The initializing thread
+    // ? counts as a worker; it runs jobs while it waits on a job counter.
+    // ? At least one other worker is always started, so jobs queued without
+    // ? a counter still run when the initializing thread never waits.
+    uint32_t job_worker_count;
+    bool pin_job_workers;
 } re_CoreInitParams;
 
 /// @brief Initialize the core engine module.
@@ -158,19 +166,27 @@ RE_API void* re_realloc(void* src, const size_t new_size);
 /// @param src A pointer to the heap memory.
 RE_API void re_free(void* src);
 
-/// @brief Set a chunk of memory to some value.
+/// @brief Set a chunk of memory to some value. Sets at or above the streaming threshold bypass the CPU cache.
 /// @param src The pointer to the chunk of memory to set.
 /// @param value The value to set the memory to.
 /// @param size The amount of memory allocated at src.
 /// @return A pointer to the chunk of memory (should match src).
 RE_API void* re_memset(void* src, const int value, const size_t size);
 
-/// @brief Copies a chunk of memory from one location to another.
+/// @brief Copies a chunk of memory from one location to another. Copies at or above the streaming threshold bypass the CPU cache.
 /// @param dst The destination to copy the memory to.
 /// @param src The source of the memory to be copied.
 /// @param size The amount of memory being copied.
 RE_API void* re_memcpy(void* dst, const void* src, const size_t size);
 
+/// @brief Set the size at which re_memcpy and re_memset switch to non-temporal (streaming) stores.
+/// @param threshold The size in bytes (SIZE_MAX disables streaming stores).
+RE_API void re_setMemoryStreamingThreshold(const size_t threshold);
+
+/// @brief Get the size at which re_memcpy and re_memset switch to non-temporal (streaming) stores.
+/// @return The threshold in bytes.
+RE_API size_t re_getMemoryStreamingThreshold();
+
 /// @brief Allocate a chunk of aligned memory on the heap.
 /// @param size The number of bytes to allocate.
 /// @param alignment The byte count to align by.
@@ -188,6 +204,234 @@ RE_API void* re_callocAlign(const size_t element_count, const size_t element_siz
 /// @param src A pointer to the heap memory.
 RE_API void re_freeAlign(void* src);
 
+// *=================================================
+// *
+// * Linear Arena Allocation
+// *
+// *=================================================
+
+typedef struct re_Arena_T re_Arena_T;
+typedef re_Arena_T* re_Arena;
+
+typedef size_t re_ArenaMark;
+
+/// @brief Create a linear arena backed by a single reserved block of memory.
+/// @param capacity The number of bytes the arena can hand out before it is full.
+/// @return A new linear arena.
+RE_API re_Arena re_createArena(const size_t capacity);
+
+/// @brief Destroy a linear arena, releasing its backing block.
+/// @param arena A pointer to the arena to destroy.
+RE_API void re_destroyArena(re_Arena* arena);
+
+/// @brief Push a chunk of memory onto an arena.
+/// @param arena The arena to allocate from.
+/// @param size The number of bytes to allocate.
+/// @param alignment The byte count to align by.
+/// @return A pointer to the new memory, or NULL if the arena is full.
+RE_API void* re_arenaPush(re_Arena arena, const size_t size, const size_t alignment);
+
+/// @brief Push a zeroed chunk of memory onto an arena.
+/// @param arena The arena to allocate from.
+/// @param size The number of bytes to allocate.
+/// @param alignment The byte count to align by.
+/// @return A pointer to the new memory, or NULL if the arena is full.
+RE_API void* re_arenaPushZero(re_Arena arena, const size_t size, const size_t alignment);
+
+/// @brief Get the current top of an arena so it can be rewound to later.
+/// @param arena The arena to mark.
+/// @return A mark describing the arena's current top.
+RE_API re_ArenaMark re_getArenaMark(const re_Arena arena);
+
+/// @brief Rewind an arena, releasing everything pushed since the mark was taken.
+/// @param arena The arena to rewind.
+/// @param mark A mark previously returned by re_getArenaMark.
+RE_API void re_rewindArena(re_Arena arena, const re_ArenaMark mark);
+
+/// @brief Release everything pushed onto an arena (e.g. once per frame).
+/// @param arena The arena to reset.
+RE_API void re_resetArena(re_Arena arena);
+
+// *=================================================
+// *
+// * Virtual Memory Buffers
+// *
+// *=================================================
+
+typedef struct re_VirtualBuffer_T re_VirtualBuffer_T;
+typedef re_VirtualBuffer_T* re_VirtualBuffer;
+
+/// @brief Create a growable buffer that reserves its whole address range up front and commits pages on demand.
+/// Growing never moves the data, so pointers into the buffer stay valid until it is destroyed.
+/// @param max_size The largest size in bytes the buffer can ever grow to.
+/// @return A handle to the new virtual buffer.
+RE_API re_VirtualBuffer re_createVirtualBuffer(const size_t max_size);
+
+/// @brief Destroy a virtual buffer, releasing its whole address range.
+/// @param buffer A pointer to the virtual buffer to destroy.
+RE_API void re_destroyVirtualBuffer(re_VirtualBuffer* buffer);
+
+/// @brief Get the (stable) start of a virtual buffer's data.
+/// @param buffer The virtual buffer.
+/// @return A pointer to the buffer's first byte.
+RE_API void* re_getVirtualBufferData(const re_VirtualBuffer buffer);
+
+/// @brief Get the number of bytes currently in use in a virtual buffer.
+/// @param buffer The virtual buffer.
+/// @return The buffer's size in bytes.
+RE_API size_t re_getVirtualBufferSize(const re_VirtualBuffer buffer);
+
+/// @brief Get the largest size a virtual buffer can grow to.
+/// @param buffer The virtual buffer.
+/// @return The buffer's reserved size in bytes.
+RE_API size_t re_getVirtualBufferCapacity(const re_VirtualBuffer buffer);
+
+/// @brief Resize a virtual buffer in place, committing pages as needed. Shrinking keeps pages committed.
+/// @param buffer The virtual buffer to resize.
+/// @param size The new size in bytes.
+/// @return A flag determining if the resize succeeded (false if past the reserved size or out of memory).
+RE_API bool re_resizeVirtualBuffer(re_VirtualBuffer buffer, const size_t size);
+
+/// @brief Grow a virtual buffer by some number of bytes.
+/// @param buffer The virtual buffer to grow.
+/// @param size The number of bytes to append.
+/// @return A pointer to the appended bytes, or NULL if the buffer could not grow.
+RE_API void* re_virtualBufferPush(re_VirtualBuffer buffer, const size_t size);
+
+/// @brief Return the pages past a virtual buffer's current size to the platform.
+/// @param buffer The virtual buffer to trim.
+RE_API void re_trimVirtualBuffer(re_VirtualBuffer buffer);
+
+// *=================================================
+// *
+// * Fixed-Size Object Pools
+// *
+// *=================================================
+
+typedef struct re_Pool_T re_Pool_T;
+typedef re_Pool_T* re_Pool;
+
+typedef enum re_PoolFlagBits {
+    RE_POOL_THREAD_CACHE = 1 << 0
+} re_PoolFlagBits;
+typedef uint32_t re_PoolFlag;
+
+typedef struct re_PoolCreateInfo {
+    size_t slot_size;
+    uint32_t slots_per_block;
+
+    re_PoolFlag flags;
+} re_PoolCreateInfo;
+
+/// @brief Create a new pool of fixed-size, cache-line aligned slots.
+/// @param create_info The pool's creation parameters.
+/// @return A new object pool.
+RE_API re_Pool re_createPool(const re_PoolCreateInfo* create_info);
+
+/// @brief Destroy an object pool, releasing every slot it ever handed out.
+/// @param pool A pointer to the pool to destroy.
+RE_API void re_destroyPool(re_Pool* pool);
+
+/// @brief Take a slot from an object pool.
+/// @param pool The pool to allocate from.
+/// @return A pointer to the slot's memory, or NULL if the pool could not grow.
+RE_API void* re_poolAlloc(re_Pool pool);
+
+/// @brief Take a zeroed slot from an object pool.
+/// @param pool The pool to allocate from.
+/// @return A pointer to the slot's memory.
+RE_API void* re_poolCalloc(re_Pool pool);
+
+/// @brief Return a slot to the object pool it came from.
+/// @param pool The pool the slot was taken from.
+/// @param src A pointer to the slot's memory.
+RE_API void re_poolFree(re_Pool pool, void* src);
+
+// *=================================================
+// *
+// * Allocator Interface
+// *
+// *=================================================
+
+typedef void*(*re_AllocatorAllocFn)(void* user_data, const size_t size, const size_t alignment);
+typedef void(*re_AllocatorFreeFn)(void* user_data, void* src);
+
+// ? Lets a container draw its memory from the heap, an arena or a pool.
+// ? Arena allocators ignore frees; their memory comes back when the arena is
+// ? rewound or reset. A failed alloc (a full arena, a request that doesn't
+// ? fit a pool slot) returns NULL.
+typedef struct re_Allocator {
+    re_AllocatorAllocFn alloc;
+    re_AllocatorFreeFn free;
+    void* user_data;
+} re_Allocator;
+
+/// @brief Get an allocator backed by the aligned heap methods.
+/// @return The heap allocator.
+RE_API re_Allocator re_getHeapAllocator();
+
+/// @brief Get an allocator that pushes onto an arena.
+/// @param arena The arena to allocate from (must outlive everything allocated from it).
+/// @return The arena allocator.
+RE_API re_Allocator re_getArenaAllocator(re_Arena arena);
+
+/// @brief Get an allocator that takes slots from a pool. Allocations that don't fit in one slot fail (return NULL).
+/// @param pool The pool to allocate from (must outlive everything allocated from it).
+/// @return The pool allocator.
+RE_API re_Allocator re_getPoolAllocator(re_Pool pool);
+
+// *=================================================
+// *
+// * Job System
+// *
+// *=================================================
+
+#define RE_MAX_JOB_WORKERS 64u
+
+typedef void(*re_JobFn)(void* user_data);
+
+typedef struct re_JobDecl {
+    re_JobFn job_fn;
+    void* user_data;
+} re_JobDecl;
+
+typedef struct re_JobCounter_T re_JobCounter_T;
+typedef re_JobCounter_T* re_JobCounter;
+
+/// @brief Get the number of threads running jobs, including the thread that initialized the core module.
+/// @return The job worker count (0 before the core module is initialized).
+RE_API uint32_t re_getJobWorkerCount();
+
+/// @brief Create a job counter. A counter tracks how many of the jobs run against it are yet to finish.
+/// @return A new job counter.
+RE_API re_JobCounter re_createJobCounter();
+
+/// @brief Destroy a job counter. Every job run against it must have finished.
+/// @param counter A pointer to the counter to destroy.
+RE_API void re_destroyJobCounter(re_JobCounter* counter);
+
+/// @brief Queue jobs to run on the job workers.
+/// @param jobs The jobs to run (copied, so the array may be reused right away).
+/// @param job_count The number of jobs to run.
+/// @param counter The counter to track the jobs with (may be NULL).
+RE_API void re_runJobs(const re_JobDecl* jobs, const uint32_t job_count, re_JobCounter counter);
+
+/// @brief Queue jobs to run once every job tracked by another counter has finished.
+/// @param jobs The jobs to run (copied, so the array may be reused right away).
+/// @param job_count The number of jobs to run.
+/// @param dependency The counter whose jobs must finish first.
+/// @param counter The counter to track the jobs with (may be NULL). It counts them from this call on.
+RE_API void re_runJobsAfter(const re_JobDecl* jobs, const uint32_t job_count, re_JobCounter dependency, re_JobCounter counter);
+
+/// @brief Determine if every job tracked by a counter has finished.
+/// @param counter The counter to check.
+/// @return A flag determining if the counter's jobs have finished.
+RE_API bool re_isJobCounterDone(const re_JobCounter counter);
+
+/// @brief Wait for every job tracked by a counter to finish, running queued jobs in the meantime.
+/// @param counter The counter to wait on.
+RE_API void re_waitForJobCounter(re_JobCounter counter);
+
 // *=================================================
 // *
 // * Application Window
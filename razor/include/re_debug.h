@@ -7,17 +7,115 @@
 
 #include "./re_core.h"
 
+#ifndef __cplusplus
+    #include <stdatomic.h>
+#endif
+
+// *=================================================
+// *
+// * Module Initialization
+// *
+// *=================================================
+
+/// @brief Initialize the debug module (starts the background log writer and installs the crash handler).
+RE_API void re_debugInit();
+
 // *=================================================
 // *
 // * Logging
 // *
 // *=================================================
 
+typedef enum re_LogLevel {
+    RE_LOG_LEVEL_DEBUG,
+    RE_LOG_LEVEL_INFO,
+    RE_LOG_LEVEL_SUCCESS,
+    RE_LOG_LEVEL_WARN,
+    RE_LOG_LEVEL_ERROR,
+    RE_LOG_LEVEL_FATAL,
+
+    RE_LOG_LEVEL_COUNT
+} re_LogLevel;
+
+typedef enum re_LogCategory {
+    RE_LOG_CATEGORY_APPLICATION,
+    RE_LOG_CATEGORY_CORE,
+    RE_LOG_CATEGORY_DEBUG,
+    RE_LOG_CATEGORY_GRAPHICS,
+
+    RE_LOG_CATEGORY_COUNT
+} re_LogCategory;
+
+// ? Code that doesn't define RE_LOG_CATEGORY logs as application code; the
+// ? engine's CMakeLists.txt sets it per module directory.
+#ifndef RE_LOG_CATEGORY
+    #define RE_LOG_CATEGORY RE_LOG_CATEGORY_APPLICATION
+#endif
+
+/// @brief Lowest re_LogLevel each category currently lets through (DO NOT USE DIRECTLY).
+RE_API extern volatile uint8_t __re_log_thresholds[RE_LOG_CATEGORY_COUNT];
+
+// ? Only the engine (C) touches the fields; C++ call sites just need the same
+// ? layout to hand the struct's address over.
+#ifdef __cplusplus
+    typedef uint32_t __re_LogAtomicU32;
+#else
+    typedef atomic_uint __re_LogAtomicU32;
+#endif
+
+/// @brief Static per-call-site rate limiting state (DO NOT USE DIRECTLY).
+typedef struct __re_LogRateLimit {
+    __re_LogAtomicU32 window;
+    __re_LogAtomicU32 count;
+    __re_LogAtomicU32 suppressed;
+} __re_LogRateLimit;
+
+#define __RE_LOG_SITE_MAX_ARGS 16u
+
+// ? arg_count of a site whose format can't be captured (too many arguments,
+// ? or a conversion the binary encoder doesn't know).
+#define __RE_LOG_SITE_REJECTED UINT8_MAX
+
+/// @brief Static per-call-site metadata for binary logging (DO NOT USE DIRECTLY).
+typedef struct __re_LogSite {
+    const char* format;
+    const char* file;
+    uint32_t line;
+    uint32_t level;
+
+    uint32_t id;
+    uint32_t emitted_epoch;
+
+    uint8_t arg_count;
+    uint8_t arg_kinds[__RE_LOG_SITE_MAX_ARGS];
+} __re_LogSite;
+
 /// @brief Internal logging method (DO NOT USE DIRECTLY).
 /// @param format The logging format.
 /// @param ... The variadic logging arguments.
 RE_API void __re_internalLog(const char* format, ...);
 
+/// @brief Count a call site's message against the rate limit (DO NOT USE DIRECTLY).
+/// @param rate_limit The call site's rate limiting state.
+/// @param file The call site's file.
+/// @param line The call site's line.
+/// @return A flag determining if the message should be logged.
+RE_API bool __re_checkLogRateLimit(__re_LogRateLimit* rate_limit, const char* file, const uint32_t line);
+
+/// @brief Internal binary logging method (DO NOT USE DIRECTLY).
+/// @param site The call site's static metadata.
+/// @param ... The variadic logging arguments.
+RE_API void __re_internalLogBinary(__re_LogSite* site, ...);
+
+/// @brief Render a binary log file (written with RE_LOG_BINARY_ENABLED) as text.
+/// @param input_path The path of the binary log file.
+/// @param output_path The path of the text file to write (NULL writes to stdout).
+/// @return A flag determining if the whole file was decoded.
+RE_API bool re_decodeBinaryLog(const char* input_path, const char* output_path);
+
+/// @brief Block until every message logged so far has been written out (bounded wait).
+RE_API void re_flushLog();
+
 /// @brief Close the logger's currently open file (does nothing if one is not open).
 RE_API void re_closeLogFile();
 
@@ -25,18 +123,76 @@ RE_API void re_closeLogFile();
 /// @param file_path The path of the file.
 RE_API void re_setLogFile(const char* file_path);
 
+/// @brief Set the lowest level logged by every category (fatal messages are always logged).
+/// @param level The lowest level to log.
+RE_API void re_setLogLevel(const re_LogLevel level);
+
+/// @brief Set the lowest level logged by a single category.
+/// @param category The category to configure.
+/// @param level The lowest level to log.
+RE_API void re_setLogCategoryLevel(const re_LogCategory category, const re_LogLevel level);
+
+/// @brief Choose which categories are logged at all (fatal messages are always logged).
+/// @param category_mask A bit mask with bit N set for every enabled re_LogCategory N.
+RE_API void re_setLogCategoryMask(const uint32_t category_mask);
+
+/// @brief Limit how many messages each call site may log per second (fatal messages are never limited).
+/// Rate limiting is off until this is called with a non-zero limit.
+/// @param messages_per_second The per-call-site limit (0 disables rate limiting).
+RE_API void re_setLogRateLimit(const uint32_t messages_per_second);
+
 #ifdef RE_LOGGER_ENABLED
-    #define re_logInfo(format, ...) __re_internalLog("%s"format"\n", "[INFO]: ", ##__VA_ARGS__)
+    // ? The level check runs before the arguments are evaluated, so filtered
+    // ? messages cost a single byte load.
+    #define __re_logFiltered(level, log_call) do { \
+        if ((level) >= __re_log_thresholds[RE_LOG_CATEGORY]) { \
+            static __re_LogRateLimit __re_log_rate_limit = { 0u, 0u, 0u }; \
+            if (__re_checkLogRateLimit(&__re_log_rate_limit, __FILE__, __LINE__)) { \
+                log_call; \
+            } \
+        } \
+    } while(0)
+#endif
+
+#if defined(RE_LOGGER_ENABLED) && defined(RE_LOG_BINARY_ENABLED)
+    // ? Binary mode only captures the call site and raw argument bytes; the
+    // ? text is rendered by the log writer thread or re_decodeBinaryLog.
+    #define __re_logBinary(level, format, ...) do { \
+        static __re_LogSite __re_log_site = { format, __FILE__, __LINE__, level, 0u, 0u, 0u, {0u} }; \
+        __re_internalLogBinary(&__re_log_site, ##__VA_ARGS__); \
+    } while(0)
+
+    #define re_logInfo(format, ...) __re_logFiltered(RE_LOG_LEVEL_INFO, __re_logBinary(RE_LOG_LEVEL_INFO, format, ##__VA_ARGS__))
+
+    #define re_logDebug(format, ...) __re_logFiltered(RE_LOG_LEVEL_DEBUG, __re_logBinary(RE_LOG_LEVEL_DEBUG, format, ##__VA_ARGS__))
+
+    #define re_logSuccess(format, ...) __re_logFiltered(RE_LOG_LEVEL_SUCCESS, __re_logBinary(RE_LOG_LEVEL_SUCCESS, format, ##__VA_ARGS__))
+
+    #define re_logWarn(format, ...) __re_logFiltered(RE_LOG_LEVEL_WARN, __re_logBinary(RE_LOG_LEVEL_WARN, format, ##__VA_ARGS__))
+
+    #define re_logError(format, ...) __re_logFiltered(RE_LOG_LEVEL_ERROR, __re_logBinary(RE_LOG_LEVEL_ERROR, format, ##__VA_ARGS__))
+
+    #define re_logFatal(format, ...) do { \
+        __re_logBinary(RE_LOG_LEVEL_FATAL, format, ##__VA_ARGS__); \
+        re_flushLog(); \
+        __re_dumpFlightRecorderOnCrash(); \
+    } while(0)
+#elif defined(RE_LOGGER_ENABLED)
+    #define re_logInfo(format, ...) __re_logFiltered(RE_LOG_LEVEL_INFO, __re_internalLog("%s" format "\n", "[INFO]: ", ##__VA_ARGS__))
 
-    #define re_logDebug(format, ...) __re_internalLog("%s"format"\n", "[DEBUG]: ", ##__VA_ARGS__)
+    #define re_logDebug(format, ...) __re_logFiltered(RE_LOG_LEVEL_DEBUG, __re_internalLog("%s" format "\n", "[DEBUG]: ", ##__VA_ARGS__))
 
-    #define re_logSuccess(format, ...) __re_internalLog("%s"format"\n", "[SUCCESS]: ", ##__VA_ARGS__)
+    #define re_logSuccess(format, ...) __re_logFiltered(RE_LOG_LEVEL_SUCCESS, __re_internalLog("%s" format "\n", "[SUCCESS]: ", ##__VA_ARGS__))
 
-    #define re_logWarn(format, ...) __re_internalLog("%s%d%s"format"\n", "[WARN]: (File: " __FILE__ "; Line: ", __LINE__, ") ", ##__VA_ARGS__)
+    #define re_logWarn(format, ...) __re_logFiltered(RE_LOG_LEVEL_WARN, __re_internalLog("%s%d%s" format "\n", "[WARN]: (File: " __FILE__ "; Line: ", __LINE__, ") ", ##__VA_ARGS__))
 
-    #define re_logError(format, ...) __re_internalLog("%s%d%s"format"\n", "[ERROR]: (File: " __FILE__ "; Line: ", __LINE__, ") ", ##__VA_ARGS__)
+    #define re_logError(format, ...) __re_logFiltered(RE_LOG_LEVEL_ERROR, __re_internalLog("%s%d%s" format "\n", "[ERROR]: (File: " __FILE__ "; Line: ", __LINE__, ") ", ##__VA_ARGS__))
 
-    #define re_logFatal(format, ...) __re_internalLog("%s%d%s"format"\n", "[FATAL]: (File: " __FILE__ "; Line: ", __LINE__, ") ", ##__VA_ARGS__)
+    #define re_logFatal(format, ...) do { \
+        __re_internalLog("%s%d%s" format "\n", "[FATAL]: (File: " __FILE__ "; Line: ", __LINE__, ") ", ##__VA_ARGS__); \
+        re_flushLog(); \
+        __re_dumpFlightRecorderOnCrash(); \
+    } while(0)
 #else
     #define re_logInfo(format, ...) ((void)(0))
     #define re_logDebug(format, ...) ((void)(0))
@@ -47,6 +203,43 @@ RE_API void re_setLogFile(const char* file_path);
     #define re_logFatal(format, ...) ((void)(0))
 #endif
 
+// *=================================================
+// *
+// * Flight Recorder
+// *
+// *=================================================
+
+typedef enum re_FlightEventKind {
+    RE_FLIGHT_EVENT_LOG,
+    RE_FLIGHT_EVENT_MODULE,
+    RE_FLIGHT_EVENT_GRAPHICS,
+    RE_FLIGHT_EVENT_FRAME,
+    RE_FLIGHT_EVENT_USER,
+
+    RE_FLIGHT_EVENT_COUNT
+} re_FlightEventKind;
+
+/// @brief Record an event in the calling thread's flight recorder ring (kept even when logging is off).
+/// @param kind The kind of event.
+/// @param format The event's format.
+/// @param ... The variadic format arguments.
+RE_API void re_recordFlightEvent(const re_FlightEventKind kind, const char* format, ...);
+
+/// @brief Record a frame boundary in the calling thread's flight recorder ring.
+RE_API void re_recordFlightFrame();
+
+/// @brief Set the file the flight recorder is dumped to on asserts, fatal logs and crashes.
+/// @param file_path The path of the file (copied).
+RE_API void re_setFlightRecorderPath(const char* file_path);
+
+/// @brief Write every thread's recent flight recorder events to a file, oldest first.
+/// @param file_path The path of the file (NULL uses the re_setFlightRecorderPath path).
+/// @return A flag determining if the file could be written.
+RE_API bool re_dumpFlightRecorder(const char* file_path);
+
+/// @brief Dump the flight recorder once per process on a fatal error (DO NOT USE DIRECTLY).
+RE_API void __re_dumpFlightRecorderOnCrash();
+
 // *=================================================
 // *
 // * Runtime Assert
@@ -59,6 +252,7 @@ RE_API void re_setLogFile(const char* file_path);
     #define re_assert(condition, format, ...) do { \
         if (!(condition)) { \
             re_logFatal("%s" format, "Assertion failed (" #condition ") ", ##__VA_ARGS__); \
+            __re_dumpFlightRecorderOnCrash(); \
             abort(); \
         } \
     } while(0)
@@ -66,6 +260,44 @@ RE_API void re_setLogFile(const char* file_path);
     #define re_assert(condition, format, ...) ((void)(0))
 #endif
 
+// *=================================================
+// *
+// * Memory Statistics
+// *
+// *=================================================
+
+#define RE_MEMORY_HISTOGRAM_BUCKET_COUNT 24u
+
+typedef enum re_MemoryCategory {
+    RE_MEMORY_CATEGORY_APPLICATION,
+    RE_MEMORY_CATEGORY_CORE,
+    RE_MEMORY_CATEGORY_DEBUG,
+    RE_MEMORY_CATEGORY_GRAPHICS,
+
+    RE_MEMORY_CATEGORY_COUNT
+} re_MemoryCategory;
+
+typedef struct re_MemoryStats {
+    uint64_t live_bytes;
+    uint64_t peak_bytes;
+
+    uint64_t live_allocations;
+    uint64_t total_allocations;
+    uint64_t total_frees;
+
+    // ? Bucket N counts allocations of [2^N, 2^(N+1)) bytes; the last bucket is open-ended.
+    uint64_t size_histogram[RE_MEMORY_HISTOGRAM_BUCKET_COUNT];
+} re_MemoryStats;
+
+/// @brief Get a snapshot of the re_malloc statistics for some memory category.
+/// @param category The category to query.
+/// @param stats A pointer to where the statistics will be stored.
+/// @return A flag indicating if allocation tracking is compiled in (RE_MEMORY_TRACKING_ENABLED).
+RE_API bool re_getMemoryStats(const re_MemoryCategory category, re_MemoryStats* stats);
+
+/// @brief Log every memory category that still has live allocations.
+RE_API void re_logMemoryLeaks();
+
 // *=================================================
 
 #ifdef __cplusplus
@@ -0,0 +1,105 @@
+#ifndef __RAZOR_PROFILE_HEADER_FILE
+#define __RAZOR_PROFILE_HEADER_FILE
+
+#ifdef __cplusplus
+    extern "C" {
+#endif
+
+#include "./re_core.h"
+
+// *=================================================
+// *
+// * CPU Scope Profiling
+// *
+// *=================================================
+
+// ? Track 0 is the recording thread's own timeline; other tracks come from
+// ? re_createProfileTrack and hold scopes measured elsewhere (e.g. on the GPU).
+#define RE_PROFILE_TRACK_THREAD 0u
+
+typedef struct re_ProfileScopeStats {
+    const char* name;
+    uint32_t track;
+
+    uint64_t call_count;
+    uint64_t total_ns;
+    uint64_t self_ns;
+
+    uint64_t min_ns;
+    uint64_t max_ns;
+} re_ProfileScopeStats;
+
+/// @brief Open a profiling scope on the calling thread.
+/// @param name The scope's name (must outlive the profile, e.g. a string literal).
+RE_API void re_profileBegin(const char* name);
+
+/// @brief Close the calling thread's innermost profiling scope.
+RE_API void re_profileEnd();
+
+/// @brief Register a named timeline for scopes that are not measured by the calling thread.
+/// @param name The track's name (must outlive the profile, e.g. a string literal).
+/// @return The new track's ID, or RE_PROFILE_TRACK_THREAD if every track is taken.
+RE_API uint32_t re_createProfileTrack(const char* name);
+
+/// @brief Record a scope that was already measured onto a track.
+/// @param name The scope's name (must outlive the profile, e.g. a string literal).
+/// @param track The track to record the scope onto.
+/// @param start_ns The scope's start on the re_getProfileTime clock.
+/// @param duration_ns The scope's duration.
+/// @param self_ns The part of the duration not spent in nested scopes.
+RE_API void re_profileRecord(
+    const char* name,
+    const uint32_t track,
+    const uint64_t start_ns,
+    const uint64_t duration_ns,
+    const uint64_t self_ns
+);
+
+/// @brief Get the current time on the profiler's clock.
+/// @return The monotonic time in nanoseconds.
+RE_API uint64_t re_getProfileTime();
+
+/// @brief Discard every recorded scope (scopes still open keep running).
+RE_API void re_clearProfile();
+
+/// @brief Aggregate the recorded scopes by name and track.
+/// @param stats An array to store the per-scope statistics in (may be NULL).
+/// @param max_count The length of stats.
+/// @return The number of distinct scopes recorded (may be larger than max_count).
+RE_API uint32_t re_getProfileStats(re_ProfileScopeStats* stats, const uint32_t max_count);
+
+/// @brief Log the recorded scopes aggregated by name, slowest first (e.g. as a startup breakdown right after bring-up).
+RE_API void re_logProfileReport();
+
+/// @brief Write the recorded scopes as a Chrome trace (chrome://tracing, Perfetto).
+/// @param file_path The path of the JSON file.
+/// @return A flag determining if the file could be written.
+RE_API bool re_exportProfileTrace(const char* file_path);
+
+#ifdef RE_PROFILER_ENABLED
+    // ? BEGIN/END must be paired on the same thread. RE_PROFILE_SCOPE wraps the
+    // ? statement that follows it; leaving that block with return/break/goto
+    // ? skips the END.
+    #define RE_PROFILE_BEGIN(name) re_profileBegin(name)
+    #define RE_PROFILE_END() re_profileEnd()
+
+    #define RE_PROFILE_FUNCTION_BEGIN() re_profileBegin(__func__)
+
+    #define RE_PROFILE_SCOPE(name) \
+        for (int __re_profile_scope = (re_profileBegin(name), 0); __re_profile_scope == 0; re_profileEnd(), __re_profile_scope = 1)
+#else
+    #define RE_PROFILE_BEGIN(name) ((void)(0))
+    #define RE_PROFILE_END() ((void)(0))
+
+    #define RE_PROFILE_FUNCTION_BEGIN() ((void)(0))
+
+    #define RE_PROFILE_SCOPE(name)
+#endif
+
+// *=================================================
+
+#ifdef __cplusplus
+    }
+#endif
+
+#endif
\ No newline at end of file
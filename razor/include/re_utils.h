@@ -17,7 +17,76 @@
 /// @param str_a Some NULL-terminated string.
 /// @param str_b Some other NULL-terminated string.
 /// @return A flag indicating if the strings are equivalent.
-bool re_isStrEqual(const char* str_a, const char* str_b);
+RE_API bool re_isStrEqual(const char* str_a, const char* str_b);
+
+/// @brief Determine if two NULL-terminated strings are equivalent, ignoring ASCII case.
+/// @param str_a Some NULL-terminated string.
+/// @param str_b Some other NULL-terminated string.
+/// @return A flag indicating if the strings are equivalent up to ASCII case.
+RE_API bool re_isStrEqualNoCase(const char* str_a, const char* str_b);
+
+/// @brief Determine if a NULL-terminated string starts with another.
+/// @param str Some NULL-terminated string.
+/// @param prefix The NULL-terminated prefix to look for.
+/// @return A flag indicating if str starts with prefix (always true for an empty prefix).
+RE_API bool re_hasStrPrefix(const char* str, const char* prefix);
+
+/// @brief Get the length of a NULL-terminated string.
+/// @param str Some NULL-terminated string.
+/// @return The string's length in characters (0 for a NULL string).
+RE_API size_t re_getStrLength(const char* str);
+
+/// @brief Copy a NULL-terminated string into a bounded buffer, truncating it if needed. The copy is always NULL-terminated (unless dst_size is 0).
+/// @param dst The buffer to copy into.
+/// @param src The NULL-terminated string to copy (NULL copies as an empty string).
+/// @param dst_size The size of dst in bytes.
+/// @return The length of src; a value of dst_size or more means the copy was truncated.
+RE_API size_t re_copyStr(char* dst, const char* src, const size_t dst_size);
+
+/// @brief Hash a string (or any bytes) with a fast non-cryptographic 64-bit hash.
+/// @param data The bytes to hash.
+/// @param length The number of bytes to hash.
+/// @return The hash, which is only stable within one build of the engine.
+RE_API uint64_t re_hashStr(const char* data, const size_t length);
+
+// *=================================================
+// *
+// * String Interning
+// *
+// *=================================================
+
+// ? A handle to a string stored once in the global intern table. Two strings
+// ? are equal exactly when their IDs are, and an ID stays valid (along with
+// ? the string it names) for the life of the process.
+typedef uint32_t re_StrId;
+
+#define RE_STR_ID_NULL 0u
+
+/// @brief Get the ID of a NULL-terminated string, adding it to the intern table if needed. Thread-safe.
+/// @param str Some NULL-terminated string.
+/// @return The string's ID (RE_STR_ID_NULL for a NULL string).
+RE_API re_StrId re_internStr(const char* str);
+
+/// @brief Get the ID of a string of known length (which need not be NULL-terminated), adding it to the intern table if needed. Thread-safe.
+/// @param str The string's first character.
+/// @param length The string's length in characters.
+/// @return The string's ID (RE_STR_ID_NULL for a NULL string).
+RE_API re_StrId re_internSizedStr(const char* str, const size_t length);
+
+/// @brief Look up the ID of a NULL-terminated string without adding it. Thread-safe.
+/// @param str Some NULL-terminated string.
+/// @return The string's ID, or RE_STR_ID_NULL if it was never interned.
+RE_API re_StrId re_findStrId(const char* str);
+
+/// @brief Get the string an ID names. Lock-free.
+/// @param id Some string ID.
+/// @return The interned NULL-terminated string (NULL for RE_STR_ID_NULL).
+RE_API const char* re_getInternedStr(const re_StrId id);
+
+/// @brief Get the length of the string an ID names. Lock-free.
+/// @param id Some string ID.
+/// @return The interned string's length in characters (0 for RE_STR_ID_NULL).
+RE_API size_t re_getInternedStrLength(const re_StrId id);
 
 #ifdef __cplusplus
     }
@@ -0,0 +1,121 @@
+#include <re_core.h>
+
+#if RE_PLATFORM == RE_PLATFORM_LINUX
+
+#include <re_debug.h>
+#include "./re_linux.h"
+#include "../re_files.h"
+
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <sys/stat.h>
+
+#define __RE_LINUX_MEMINFO_LINE_SIZE 128u
+
+size_t linux_page_size = __RE_LINUX_DEFAULT_PAGE_SIZE;
+size_t linux_huge_page_size = __RE_LINUX_DEFAULT_HUGE_PAGE_SIZE;
+
+// *=================================================
+// *
+// * __re_queryLinuxHugePageSize
+// *
+// *=================================================
+
+static size_t __re_queryLinuxHugePageSize() {
+    FILE* meminfo = fopen("/proc/meminfo", "r");
+
+    if (meminfo == RE_NULL_HANDLE) {
+        return __RE_LINUX_DEFAULT_HUGE_PAGE_SIZE;
+    }
+
+    size_t huge_page_kb = 0;
+    char line[__RE_LINUX_MEMINFO_LINE_SIZE];
+
+    while (fgets(line, sizeof(line), meminfo) != RE_NULL_HANDLE) {
+        if (sscanf(line, "Hugepagesize: %zu kB", &huge_page_kb) == 1) {
+            break;
+        }
+    }
+
+    fclose(meminfo);
+
+    if (huge_page_kb == 0) {
+        return __RE_LINUX_DEFAULT_HUGE_PAGE_SIZE;
+    }
+
+    return huge_page_kb * 1024u;
+}
+
+// *=================================================
+// *
+// * __re_makeLinuxDirectory
+// *
+// *=================================================
+
+static bool __re_makeLinuxDirectory(const char* path) {
+    return mkdir(path, 0700) == 0 || errno == EEXIST;
+}
+
+// *=================================================
+// *
+// * __re_getCacheFilePath
+// *
+// *=================================================
+
+bool __re_getCacheFilePath(const char* file_name, char* buffer, const size_t capacity) {
+    re_assert(file_name != RE_NULL_HANDLE, "Attempting to get cache path of NULL file name!");
+
+    // ? XDG base directories must be absolute; relative ones are ignored.
+    const char* cache_home = getenv("XDG_CACHE_HOME");
+    const char* home = getenv("HOME");
+
+    char directory[RE_MAX_FILE_PATH_SIZE];
+    int length = -1;
+
+    if (cache_home != RE_NULL_HANDLE && cache_home[0] == '/') {
+        length = snprintf(directory, sizeof(directory), "%s", cache_home);
+    }
+    else if (home != RE_NULL_HANDLE && home[0] == '/') {
+        length = snprintf(directory, sizeof(directory), "%s/.cache", home);
+    }
+
+    if (length < 0 || (size_t)length >= sizeof(directory) || !__re_makeLinuxDirectory(directory)) {
+        return false;
+    }
+
+    const int razor_length = snprintf(directory + length, sizeof(directory) - (size_t)length, "/razor");
+
+    if ((size_t)(length + razor_length) >= sizeof(directory) || !__re_makeLinuxDirectory(directory)) {
+        return false;
+    }
+
+    const int path_length = snprintf(buffer, capacity, "%s/%s", directory, file_name);
+
+    return path_length >= 0 && (size_t)path_length < capacity;
+}
+
+// *=================================================
+// *
+// * __re_initCoreLinux
+// *
+// *=================================================
+
+void __re_initCoreLinux() {
+    const long queried_page_size = sysconf(_SC_PAGESIZE);
+
+    if (queried_page_size > 0) {
+        linux_page_size = (size_t)queried_page_size;
+    }
+
+    linux_huge_page_size = __re_queryLinuxHugePageSize();
+
+    re_assert(
+        (linux_huge_page_size & (linux_huge_page_size - 1)) == 0 && linux_huge_page_size >= linux_page_size,
+        "Unexpected Linux huge page size: %zu",
+        linux_huge_page_size
+    );
+}
+
+#endif
\ No newline at end of file
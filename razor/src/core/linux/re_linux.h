@@ -0,0 +1,20 @@
+#ifndef __RAZOR_CORE_LINUX_HEADER_FILE
+#define __RAZOR_CORE_LINUX_HEADER_FILE
+
+#include <re_core.h>
+#include <stddef.h>
+
+#define __RE_LINUX_DEFAULT_PAGE_SIZE 4096u
+#define __RE_LINUX_DEFAULT_HUGE_PAGE_SIZE (2u * 1024u * 1024u)
+
+// ? Allocations at least this large bypass the libc heap and get their own
+// ? huge-page aligned mapping.
+#define __RE_LINUX_MMAP_THRESHOLD (256u * 1024u)
+
+extern size_t linux_page_size;
+extern size_t linux_huge_page_size;
+
+/// @brief Initialize the Linux core module values.
+void __re_initCoreLinux();
+
+#endif
\ No newline at end of file
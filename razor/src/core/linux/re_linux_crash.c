@@ -0,0 +1,121 @@
+#include <re_core.h>
+
+#if RE_PLATFORM == RE_PLATFORM_LINUX
+
+#include "../re_crash.h"
+
+#include <fcntl.h>
+#include <signal.h>
+#include <unistd.h>
+
+// ? Large enough for the handler to format its output after a stack overflow.
+#define __RE_LINUX_CRASH_STACK_SIZE (64u * 1024u)
+
+static const int __RE_LINUX_CRASH_SIGNALS[] = { SIGSEGV, SIGBUS, SIGILL, SIGFPE, SIGABRT };
+#define __RE_LINUX_CRASH_SIGNAL_COUNT (sizeof(__RE_LINUX_CRASH_SIGNALS) / sizeof(__RE_LINUX_CRASH_SIGNALS[0]))
+
+static re_CrashHandlerFn __re_linux_crash_handler = RE_NULL_HANDLE;
+static struct sigaction __re_linux_previous_actions[__RE_LINUX_CRASH_SIGNAL_COUNT];
+static char __re_linux_crash_stack[__RE_LINUX_CRASH_STACK_SIZE];
+
+// *=================================================
+// *
+// * __re_handleLinuxSignal
+// *
+// *=================================================
+
+static void __re_handleLinuxSignal(int signal_number, siginfo_t* signal_info, void* context) {
+    __re_linux_crash_handler();
+
+    // ? Hand the signal on to whoever was installed before us (a sanitizer, a
+    // ? host application's reporter...), with the original signal info.
+    for (size_t idx = 0; idx < __RE_LINUX_CRASH_SIGNAL_COUNT; ++idx) {
+        if (__RE_LINUX_CRASH_SIGNALS[idx] != signal_number) {
+            continue;
+        }
+
+        const struct sigaction* previous = &__re_linux_previous_actions[idx];
+
+        if (previous->sa_flags & SA_SIGINFO) {
+            previous->sa_sigaction(signal_number, signal_info, context);
+        }
+        else if (previous->sa_handler != SIG_DFL && previous->sa_handler != SIG_IGN) {
+            previous->sa_handler(signal_number);
+        }
+
+        break;
+    }
+
+    // ? SA_RESETHAND already restored the default action, so if the previous
+    // ? handler returned, re-raising keeps the usual exit status and core dump.
+    raise(signal_number);
+}
+
+// *=================================================
+// *
+// * __re_installCrashHandler
+// *
+// *=================================================
+
+void __re_installCrashHandler(const re_CrashHandlerFn handler) {
+    __re_linux_crash_handler = handler;
+
+    // ? The alternate stack only covers the installing thread (normally the
+    // ? main thread), which is where stack overflows tend to happen.
+    stack_t signal_stack = {0};
+    signal_stack.ss_sp = __re_linux_crash_stack;
+    signal_stack.ss_size = sizeof(__re_linux_crash_stack);
+    sigaltstack(&signal_stack, RE_NULL_HANDLE);
+
+    struct sigaction action = {0};
+    action.sa_sigaction = __re_handleLinuxSignal;
+    action.sa_flags = SA_SIGINFO | SA_RESETHAND | SA_ONSTACK;
+    sigemptyset(&action.sa_mask);
+
+    for (size_t idx = 0; idx < __RE_LINUX_CRASH_SIGNAL_COUNT; ++idx) {
+        sigaction(__RE_LINUX_CRASH_SIGNALS[idx], &action, &__re_linux_previous_actions[idx]);
+    }
+}
+
+// *=================================================
+// *
+// * __re_openCrashFile
+// *
+// *=================================================
+
+intptr_t __re_openCrashFile(const char* file_path) {
+    return (intptr_t)open(file_path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+}
+
+// *=================================================
+// *
+// * __re_writeCrashFile
+// *
+// *=================================================
+
+void __re_writeCrashFile(const intptr_t file, const void* data, const size_t size) {
+    const char* bytes = (const char*)data;
+    size_t written = 0;
+
+    while (written < size) {
+        const ssize_t result = write((int)file, bytes + written, size - written);
+
+        if (result <= 0) {
+            return;
+        }
+
+        written += (size_t)result;
+    }
+}
+
+// *=================================================
+// *
+// * __re_closeCrashFile
+// *
+// *=================================================
+
+void __re_closeCrashFile(const intptr_t file) {
+    close((int)file);
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,408 @@
+#define _GNU_SOURCE
+#include <re_core.h>
+
+#if RE_PLATFORM == RE_PLATFORM_LINUX
+
+#include <re_debug.h>
+#include "./re_linux.h"
+#include "../re_memory.h"
+
+#include <malloc.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdatomic.h>
+#include <sys/mman.h>
+
+// ? The low bit of a mapping's size is never set by page rounding, so it is
+// ? used to remember that the region came from the explicit huge page pool.
+#define __RE_LINUX_HUGETLB_FLAG ((size_t)1u)
+
+// ? Every allocation is preceded by this header so that the free and realloc
+// ? paths can tell mapped regions apart from libc heap blocks.
+typedef struct __re_LinuxAllocHeader {
+    void* base;
+    size_t mapped_size;
+} __re_LinuxAllocHeader;
+
+#define __RE_LINUX_ALLOC_HEADER_SIZE sizeof(__re_LinuxAllocHeader)
+
+static atomic_bool __re_hugetlb_available = true;
+
+// *=================================================
+// *
+// * __re_alignLinuxSize
+// *
+// *=================================================
+
+static inline size_t __re_alignLinuxSize(const size_t size, const size_t alignment) {
+    return (size + alignment - 1) & ~(alignment - 1);
+}
+
+// *=================================================
+// *
+// * __re_getLinuxHeader
+// *
+// *=================================================
+
+static inline __re_LinuxAllocHeader* __re_getLinuxHeader(void* src) {
+    return (__re_LinuxAllocHeader*)((char*)src - __RE_LINUX_ALLOC_HEADER_SIZE);
+}
+
+// *=================================================
+// *
+// * __re_mapLinuxRegion
+// *
+// *=================================================
+
+static void* __re_mapLinuxRegion(const size_t size, const size_t alignment, size_t* mapped_size) {
+    const int protection = PROT_READ | PROT_WRITE;
+    const int flags = MAP_PRIVATE | MAP_ANONYMOUS;
+
+    // ? Explicit huge pages are always tried first, but without a reserved
+    // ? pool (the usual case) the mapping fails. The first failure disables
+    // ? the attempt for the rest of the process, even if the pool was only
+    // ? exhausted at the time.
+    if (
+        size >= linux_huge_page_size &&
+        alignment <= linux_huge_page_size &&
+        atomic_load_explicit(&__re_hugetlb_available, memory_order_relaxed)
+    ) {
+        const size_t huge_size = __re_alignLinuxSize(size, linux_huge_page_size);
+        void* region = mmap(RE_NULL_HANDLE, huge_size, protection, flags | MAP_HUGETLB, -1, 0);
+
+        if (region != MAP_FAILED) {
+            *mapped_size = huge_size | __RE_LINUX_HUGETLB_FLAG;
+            return region;
+        }
+
+        atomic_store_explicit(&__re_hugetlb_available, false, memory_order_relaxed);
+    }
+
+    const size_t region_size = __re_alignLinuxSize(size, linux_page_size);
+
+    // ? Transparent huge pages can only back huge-page aligned ranges, so large
+    // ? regions are over-reserved and trimmed down to an aligned start.
+    size_t region_alignment = alignment > linux_page_size ? alignment : linux_page_size;
+    if (region_size >= linux_huge_page_size && region_alignment < linux_huge_page_size) {
+        region_alignment = linux_huge_page_size;
+    }
+
+    const size_t reserve_size = region_size + region_alignment - linux_page_size;
+    char* reserved = (char*)mmap(RE_NULL_HANDLE, reserve_size, protection, flags, -1, 0);
+
+    if ((void*)reserved == MAP_FAILED) {
+        return RE_NULL_HANDLE;
+    }
+
+    char* region = (char*)__re_alignLinuxSize((size_t)reserved, region_alignment);
+    const size_t head_size = (size_t)(region - reserved);
+    const size_t tail_size = reserve_size - head_size - region_size;
+
+    if (head_size > 0) {
+        munmap(reserved, head_size);
+    }
+
+    if (tail_size > 0) {
+        munmap(region + region_size, tail_size);
+    }
+
+    if (region_size >= linux_huge_page_size) {
+        madvise(region, region_size, MADV_HUGEPAGE);
+    }
+
+    *mapped_size = region_size;
+    return region;
+}
+
+// *=================================================
+// *
+// * __re_releaseLinuxAllocation
+// *
+// *=================================================
+
+static void __re_releaseLinuxAllocation(void* src) {
+    const __re_LinuxAllocHeader* header = __re_getLinuxHeader(src);
+
+    if (header->mapped_size == 0) {
+        free(header->base);
+        return;
+    }
+
+    const int unmap_result = munmap(header->base, header->mapped_size & ~__RE_LINUX_HUGETLB_FLAG);
+    re_assert(unmap_result == 0, "Attempted to free invalid memory!");
+}
+
+// *=================================================
+// *
+// * __re_allocateLinux
+// *
+// *=================================================
+
+static void* __re_allocateLinux(const size_t size, const size_t alignment, const bool zero) {
+    // ? The header sits directly in front of the returned pointer, so the
+    // ? padding in front of it is at least a header wide.
+    const size_t padding = alignment > __RE_LINUX_ALLOC_HEADER_SIZE ? alignment : __RE_LINUX_ALLOC_HEADER_SIZE;
+
+    // ? Like malloc, no allocation may exceed PTRDIFF_MAX, which also leaves
+    // ? the header and the page rounding in __re_mapLinuxRegion room to not wrap.
+    if (size > PTRDIFF_MAX || padding > PTRDIFF_MAX - size) {
+        return RE_NULL_HANDLE;
+    }
+
+    const size_t total_size = size + padding;
+
+    void* base = RE_NULL_HANDLE;
+    size_t mapped_size = 0;
+
+    if (total_size >= __RE_LINUX_MMAP_THRESHOLD) {
+        // ? Fresh anonymous mappings are already zeroed by the kernel.
+        base = __re_mapLinuxRegion(total_size, padding, &mapped_size);
+    }
+    else if (padding > __RE_LINUX_ALLOC_HEADER_SIZE) {
+        if (posix_memalign(&base, padding, total_size) != 0) {
+            base = RE_NULL_HANDLE;
+        }
+        else if (zero) {
+            memset(base, 0, total_size);
+        }
+    }
+    else {
+        base = zero ? calloc(1, total_size) : malloc(total_size);
+    }
+
+    if (base == RE_NULL_HANDLE) {
+        return RE_NULL_HANDLE;
+    }
+
+    void* ptr = (char*)base + padding;
+
+    __re_LinuxAllocHeader* header = __re_getLinuxHeader(ptr);
+    header->base = base;
+    header->mapped_size = mapped_size;
+
+    return ptr;
+}
+
+// *=================================================
+// *
+// * __re_platformMalloc
+// *
+// *=================================================
+
+void* __re_platformMalloc(const size_t size) {
+    re_assert(size > 0, "Cannot allocate 0 bytes!");
+
+    return __re_allocateLinux(size, 0, false);
+}
+
+// *=================================================
+// *
+// * __re_platformCalloc
+// *
+// *=================================================
+
+void* __re_platformCalloc(const size_t element_count, const size_t element_size) {
+    if (element_size != 0 && element_count > SIZE_MAX / element_size) {
+        return RE_NULL_HANDLE;
+    }
+
+    const size_t total_size = element_count * element_size;
+    re_assert(total_size > 0, "Cannot contiguous allocate 0 bytes!");
+
+    return __re_allocateLinux(total_size, 0, true);
+}
+
+// *=================================================
+// *
+// * __re_platformRealloc
+// *
+// *=================================================
+
+void* __re_platformRealloc(void* src, const size_t new_size) {
+    re_assert(src != RE_NULL_HANDLE, "Cannot reallocate from NULL pointer!");
+    re_assert(new_size > 0, "Cannot reallocate into 0 bytes!");
+
+    if (new_size > PTRDIFF_MAX - __RE_LINUX_ALLOC_HEADER_SIZE) {
+        return RE_NULL_HANDLE;
+    }
+
+    __re_LinuxAllocHeader* header = __re_getLinuxHeader(src);
+    const size_t new_total_size = new_size + __RE_LINUX_ALLOC_HEADER_SIZE;
+
+    if (header->mapped_size != 0) {
+        // ? Mapped regions grow and shrink in place or get remapped by the
+        // ? kernel, so large buffers are never copied byte by byte.
+        const bool is_hugetlb = (header->mapped_size & __RE_LINUX_HUGETLB_FLAG) != 0;
+        const size_t old_size = header->mapped_size & ~__RE_LINUX_HUGETLB_FLAG;
+        const size_t new_mapped_size = __re_alignLinuxSize(
+            new_total_size,
+            is_hugetlb ? linux_huge_page_size : linux_page_size
+        );
+
+        if (new_mapped_size == old_size) {
+            return src;
+        }
+
+        void* base = mremap(header->base, old_size, new_mapped_size, MREMAP_MAYMOVE);
+
+        if (base == MAP_FAILED) {
+            return RE_NULL_HANDLE;
+        }
+
+        if (!is_hugetlb && new_mapped_size >= linux_huge_page_size) {
+            madvise(base, new_mapped_size, MADV_HUGEPAGE);
+        }
+
+        header = (__re_LinuxAllocHeader*)base;
+        header->base = base;
+        header->mapped_size = new_mapped_size | (is_hugetlb ? __RE_LINUX_HUGETLB_FLAG : 0);
+
+        return header + 1;
+    }
+
+    if (new_total_size >= __RE_LINUX_MMAP_THRESHOLD) {
+        void* ptr = __re_allocateLinux(new_size, 0, false);
+
+        if (ptr == RE_NULL_HANDLE) {
+            return RE_NULL_HANDLE;
+        }
+
+        const size_t old_size = malloc_usable_size(header->base) - __RE_LINUX_ALLOC_HEADER_SIZE;
+        memcpy(ptr, src, old_size < new_size ? old_size : new_size);
+        free(header->base);
+
+        return ptr;
+    }
+
+    void* base = realloc(header->base, new_total_size);
+
+    if (base == RE_NULL_HANDLE) {
+        return RE_NULL_HANDLE;
+    }
+
+    header = (__re_LinuxAllocHeader*)base;
+    header->base = base;
+
+    return header + 1;
+}
+
+// *=================================================
+// *
+// * __re_platformFree
+// *
+// *=================================================
+
+void __re_platformFree(void* src) {
+    re_assert(src != RE_NULL_HANDLE, "Cannot free NULL pointer!");
+
+    __re_releaseLinuxAllocation(src);
+}
+
+// *=================================================
+// *
+// * __re_getVirtualPageSize
+// *
+// *=================================================
+
+size_t __re_getVirtualPageSize() {
+    return linux_page_size;
+}
+
+// *=================================================
+// *
+// * __re_reserveVirtualMemory
+// *
+// *=================================================
+
+void* __re_reserveVirtualMemory(const size_t size) {
+    re_assert(size > 0, "Cannot reserve 0 bytes!");
+
+    // ? PROT_NONE + MAP_NORESERVE claims address space only; nothing counts
+    // ? against the commit limit until pages are made accessible.
+    void* region = mmap(RE_NULL_HANDLE, size, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+
+    if (region == MAP_FAILED) {
+        return RE_NULL_HANDLE;
+    }
+
+    return region;
+}
+
+// *=================================================
+// *
+// * __re_commitVirtualMemory
+// *
+// *=================================================
+
+bool __re_commitVirtualMemory(void* src, const size_t size) {
+    re_assert(src != RE_NULL_HANDLE, "Cannot commit NULL pointer!");
+
+    return mprotect(src, size, PROT_READ | PROT_WRITE) == 0;
+}
+
+// *=================================================
+// *
+// * __re_decommitVirtualMemory
+// *
+// *=================================================
+
+void __re_decommitVirtualMemory(void* src, const size_t size) {
+    re_assert(src != RE_NULL_HANDLE, "Cannot decommit NULL pointer!");
+
+    madvise(src, size, MADV_DONTNEED);
+    mprotect(src, size, PROT_NONE);
+}
+
+// *=================================================
+// *
+// * __re_releaseVirtualMemory
+// *
+// *=================================================
+
+void __re_releaseVirtualMemory(void* src, const size_t size) {
+    re_assert(src != RE_NULL_HANDLE, "Cannot release NULL pointer!");
+
+    munmap(src, size);
+}
+
+// *=================================================
+// *
+// * re_mallocAlign
+// *
+// *=================================================
+
+void* re_mallocAlign(const size_t size, const size_t alignment) {
+    re_assert(size > 0, "Cannot allocate 0 bytes!");
+    re_assert((alignment & (alignment - 1)) == 0, "Alignment must be power-of-two!");
+
+    return __re_allocateLinux(size, alignment, false);
+}
+
+// *=================================================
+// *
+// * re_callocAlign
+// *
+// *=================================================
+
+void* re_callocAlign(const size_t element_count, const size_t element_size, const size_t alignment) {
+    const size_t total_size = element_count * element_size;
+    re_assert(total_size > 0, "Cannot contiguous allocate 0 bytes!");
+    re_assert((alignment & (alignment - 1)) == 0, "Alignment must be power-of-two!");
+
+    return __re_allocateLinux(total_size, alignment, true);
+}
+
+// *=================================================
+// *
+// * re_freeAlign
+// *
+// *=================================================
+
+void re_freeAlign(void* src) {
+    re_assert(src != RE_NULL_HANDLE, "Cannot free NULL pointer!");
+
+    __re_releaseLinuxAllocation(src);
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,231 @@
+#define _GNU_SOURCE
+#include <re_core.h>
+
+#if RE_PLATFORM == RE_PLATFORM_LINUX
+
+#include <re_debug.h>
+#include "../re_threads.h"
+
+#include <time.h>
+#include <errno.h>
+#include <sched.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <semaphore.h>
+
+typedef struct re_Thread_T {
+    pthread_t handle;
+    re_ThreadFn thread_fn;
+    void* user_data;
+} re_Thread_T;
+
+typedef struct re_Semaphore_T {
+    sem_t handle;
+} re_Semaphore_T;
+
+// *=================================================
+// *
+// * __re_runLinuxThread
+// *
+// *=================================================
+
+static void* __re_runLinuxThread(void* thread_data) {
+    re_Thread thread = (re_Thread)thread_data;
+    thread->thread_fn(thread->user_data);
+
+    __re_exitThread();
+
+    return RE_NULL_HANDLE;
+}
+
+// *=================================================
+// *
+// * __re_createThread
+// *
+// *=================================================
+
+re_Thread __re_createThread(const re_ThreadFn thread_fn, void* user_data) {
+    re_assert(thread_fn != RE_NULL_HANDLE, "Attempting to create thread with NULL function!");
+
+    re_Thread thread = (re_Thread)re_malloc(sizeof(re_Thread_T));
+    thread->thread_fn = thread_fn;
+    thread->user_data = user_data;
+
+    const int create_result = pthread_create(&thread->handle, RE_NULL_HANDLE, __re_runLinuxThread, thread);
+    re_assert(create_result == 0, "Failed to create Linux thread! Error: %d", create_result);
+
+    return thread;
+}
+
+// *=================================================
+// *
+// * __re_joinThread
+// *
+// *=================================================
+
+void __re_joinThread(re_Thread* thread) {
+    re_assert(thread != RE_NULL_HANDLE, "Attempting to join NULL thread!");
+
+    re_Thread thread_data = *thread;
+    re_assert(thread_data != RE_NULL_HANDLE, "Attempting to join NULL thread!");
+
+    pthread_join(thread_data->handle, RE_NULL_HANDLE);
+
+    re_free(thread_data);
+    *thread = RE_NULL_HANDLE;
+}
+
+// *=================================================
+// *
+// * __re_yieldThread
+// *
+// *=================================================
+
+void __re_yieldThread() {
+    sched_yield();
+}
+
+// *=================================================
+// *
+// * __re_sleepThread
+// *
+// *=================================================
+
+void __re_sleepThread(const uint32_t milliseconds) {
+    struct timespec duration;
+    duration.tv_sec = (time_t)(milliseconds / 1000u);
+    duration.tv_nsec = (long)(milliseconds % 1000u) * 1000000L;
+
+    while (nanosleep(&duration, &duration) == -1 && errno == EINTR) {}
+}
+
+// *=================================================
+// *
+// * __re_getCpuCoreCount
+// *
+// *=================================================
+
+uint32_t __re_getCpuCoreCount() {
+    // ? The affinity mask (unlike the online core count) honors taskset and
+    // ? cgroup cpusets.
+    cpu_set_t cpu_set;
+    CPU_ZERO(&cpu_set);
+
+    if (sched_getaffinity(0, sizeof(cpu_set), &cpu_set) == 0 && CPU_COUNT(&cpu_set) > 0) {
+        return (uint32_t)CPU_COUNT(&cpu_set);
+    }
+
+    const long online_count = sysconf(_SC_NPROCESSORS_ONLN);
+
+    return online_count > 0 ? (uint32_t)online_count : 1u;
+}
+
+// *=================================================
+// *
+// * __re_pinCurrentThread
+// *
+// *=================================================
+
+bool __re_pinCurrentThread(const uint32_t core_idx) {
+    cpu_set_t allowed_set;
+    CPU_ZERO(&allowed_set);
+
+    if (sched_getaffinity(0, sizeof(allowed_set), &allowed_set) != 0 || CPU_COUNT(&allowed_set) == 0) {
+        return false;
+    }
+
+    // ? core_idx counts allowed cores only, so pinning never leaves the process's cpuset.
+    uint32_t remaining = core_idx % (uint32_t)CPU_COUNT(&allowed_set);
+
+    for (int cpu = 0; cpu < CPU_SETSIZE; ++cpu) {
+        if (!CPU_ISSET(cpu, &allowed_set)) {
+            continue;
+        }
+
+        if (remaining-- > 0) {
+            continue;
+        }
+
+        cpu_set_t cpu_set;
+        CPU_ZERO(&cpu_set);
+        CPU_SET(cpu, &cpu_set);
+
+        return pthread_setaffinity_np(pthread_self(), sizeof(cpu_set), &cpu_set) == 0;
+    }
+
+    return false;
+}
+
+// *=================================================
+// *
+// * __re_createSemaphore
+// *
+// *=================================================
+
+re_Semaphore __re_createSemaphore() {
+    re_Semaphore semaphore = (re_Semaphore)re_malloc(sizeof(re_Semaphore_T));
+
+    const int init_result = sem_init(&semaphore->handle, 0, 0u);
+    re_assert(init_result == 0, "Failed to create Linux semaphore!");
+
+    return semaphore;
+}
+
+// *=================================================
+// *
+// * __re_destroySemaphore
+// *
+// *=================================================
+
+void __re_destroySemaphore(re_Semaphore* semaphore) {
+    re_assert(semaphore != RE_NULL_HANDLE, "Attempting to destroy NULL semaphore!");
+
+    re_Semaphore semaphore_data = *semaphore;
+    re_assert(semaphore_data != RE_NULL_HANDLE, "Attempting to destroy NULL semaphore!");
+
+    sem_destroy(&semaphore_data->handle);
+
+    re_free(semaphore_data);
+    *semaphore = RE_NULL_HANDLE;
+}
+
+// *=================================================
+// *
+// * __re_signalSemaphore
+// *
+// *=================================================
+
+void __re_signalSemaphore(re_Semaphore semaphore) {
+    re_assert(semaphore != RE_NULL_HANDLE, "Attempting to signal NULL semaphore!");
+
+    sem_post(&semaphore->handle);
+}
+
+// *=================================================
+// *
+// * __re_waitSemaphore
+// *
+// *=================================================
+
+bool __re_waitSemaphore(re_Semaphore semaphore, const uint32_t timeout_ms) {
+    re_assert(semaphore != RE_NULL_HANDLE, "Attempting to wait on NULL semaphore!");
+
+    // ? sem_timedwait takes an absolute CLOCK_REALTIME deadline.
+    struct timespec deadline;
+    clock_gettime(CLOCK_REALTIME, &deadline);
+
+    deadline.tv_sec += (time_t)(timeout_ms / 1000u);
+    deadline.tv_nsec += (long)(timeout_ms % 1000u) * 1000000L;
+
+    if (deadline.tv_nsec >= 1000000000L) {
+        deadline.tv_sec += 1;
+        deadline.tv_nsec -= 1000000000L;
+    }
+
+    int wait_result = 0;
+    while ((wait_result = sem_timedwait(&semaphore->handle, &deadline)) == -1 && errno == EINTR) {}
+
+    return wait_result == 0;
+}
+
+#endif
\ No newline at end of file
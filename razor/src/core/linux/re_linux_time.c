@@ -0,0 +1,35 @@
+#include <re_core.h>
+
+#if RE_PLATFORM == RE_PLATFORM_LINUX
+
+#include "../re_time.h"
+
+#include <time.h>
+
+// *=================================================
+// *
+// * __re_getMonotonicNs
+// *
+// *=================================================
+
+uint64_t __re_getMonotonicNs() {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return (uint64_t)now.tv_sec * 1000000000ull + (uint64_t)now.tv_nsec;
+}
+
+// *=================================================
+// *
+// * __re_getRealtimeNs
+// *
+// *=================================================
+
+uint64_t __re_getRealtimeNs() {
+    struct timespec now;
+    clock_gettime(CLOCK_REALTIME, &now);
+
+    return (uint64_t)now.tv_sec * 1000000000ull + (uint64_t)now.tv_nsec;
+}
+
+#endif
\ No newline at end of file
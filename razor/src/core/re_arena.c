@@ -0,0 +1,168 @@
+#include <re_core.h>
+
+#include <re_debug.h>
+
+// ? The arena header shares the backing block with the data, so the block's
+// ? alignment is also the largest alignment a push gets for free.
+#define __RE_ARENA_BLOCK_ALIGNMENT 64u
+
+typedef struct re_Arena_T {
+    uint8_t* data;
+    size_t capacity;
+    size_t offset;
+} re_Arena_T;
+
+#define __RE_ARENA_HEADER_SIZE ((sizeof(re_Arena_T) + __RE_ARENA_BLOCK_ALIGNMENT - 1) & ~((size_t)__RE_ARENA_BLOCK_ALIGNMENT - 1))
+
+// *=================================================
+// *
+// * re_createArena
+// *
+// *=================================================
+
+re_Arena re_createArena(const size_t capacity) {
+    re_assert(capacity > 0, "Cannot create an arena with a capacity of 0 bytes!");
+
+    uint8_t* block = (uint8_t*)re_mallocAlign(__RE_ARENA_HEADER_SIZE + capacity, __RE_ARENA_BLOCK_ALIGNMENT);
+    re_assert(block != RE_NULL_HANDLE, "Failed to reserve %zu bytes for arena!", capacity);
+
+    re_Arena arena = (re_Arena)block;
+    arena->data = block + __RE_ARENA_HEADER_SIZE;
+    arena->capacity = capacity;
+    arena->offset = 0;
+
+    return arena;
+}
+
+// *=================================================
+// *
+// * re_destroyArena
+// *
+// *=================================================
+
+void re_destroyArena(re_Arena* arena) {
+    re_assert(arena != RE_NULL_HANDLE, "Attempting to destroy NULL arena!");
+
+    re_Arena arena_data = *arena;
+    re_assert(arena_data != RE_NULL_HANDLE, "Attempting to destroy NULL arena!");
+
+    re_freeAlign(arena_data);
+    *arena = RE_NULL_HANDLE;
+}
+
+// *=================================================
+// *
+// * re_arenaPush
+// *
+// *=================================================
+
+void* re_arenaPush(re_Arena arena, const size_t size, const size_t alignment) {
+    re_assert(arena != RE_NULL_HANDLE, "Attempting to push onto NULL arena!");
+    re_assert(size > 0, "Cannot allocate 0 bytes!");
+    re_assert(alignment > 0 && (alignment & (alignment - 1)) == 0, "Alignment must be power-of-two!");
+
+    const uintptr_t top = (uintptr_t)(arena->data + arena->offset);
+    const uintptr_t aligned_top = (top + alignment - 1) & ~((uintptr_t)alignment - 1);
+    const size_t aligned_offset = (size_t)(aligned_top - (uintptr_t)arena->data);
+
+    // ? A full arena is an ordinary failure (containers on an arena allocator
+    // ? report it); compared this way round, huge sizes can't wrap the check.
+    if (aligned_offset > arena->capacity || size > arena->capacity - aligned_offset) {
+        return RE_NULL_HANDLE;
+    }
+
+    arena->offset = aligned_offset + size;
+
+    return (void*)aligned_top;
+}
+
+// *=================================================
+// *
+// * re_arenaPushZero
+// *
+// *=================================================
+
+void* re_arenaPushZero(re_Arena arena, const size_t size, const size_t alignment) {
+    void* ptr = re_arenaPush(arena, size, alignment);
+
+    if (ptr == RE_NULL_HANDLE) {
+        return RE_NULL_HANDLE;
+    }
+
+    return re_memset(ptr, 0, size);
+}
+
+// *=================================================
+// *
+// * re_getArenaMark
+// *
+// *=================================================
+
+re_ArenaMark re_getArenaMark(const re_Arena arena) {
+    re_assert(arena != RE_NULL_HANDLE, "Attempting to mark NULL arena!");
+
+    return arena->offset;
+}
+
+// *=================================================
+// *
+// * re_rewindArena
+// *
+// *=================================================
+
+void re_rewindArena(re_Arena arena, const re_ArenaMark mark) {
+    re_assert(arena != RE_NULL_HANDLE, "Attempting to rewind NULL arena!");
+    re_assert(mark <= arena->offset, "Attempting to rewind arena past its current top!");
+
+    arena->offset = mark;
+}
+
+// *=================================================
+// *
+// * re_resetArena
+// *
+// *=================================================
+
+void re_resetArena(re_Arena arena) {
+    re_assert(arena != RE_NULL_HANDLE, "Attempting to reset NULL arena!");
+
+    arena->offset = 0;
+}
+
+// *=================================================
+// *
+// * __re_arenaAllocatorAlloc
+// *
+// *=================================================
+
+static void* __re_arenaAllocatorAlloc(void* user_data, const size_t size, const size_t alignment) {
+    return re_arenaPush((re_Arena)user_data, size, alignment);
+}
+
+// *=================================================
+// *
+// * __re_arenaAllocatorFree
+// *
+// *=================================================
+
+static void __re_arenaAllocatorFree(void* user_data, void* src) {
+    (void)user_data;
+    (void)src;
+}
+
+// *=================================================
+// *
+// * re_getArenaAllocator
+// *
+// *=================================================
+
+re_Allocator re_getArenaAllocator(re_Arena arena) {
+    re_assert(arena != RE_NULL_HANDLE, "Attempting to get allocator of NULL arena!");
+
+    re_Allocator allocator = {0};
+    allocator.alloc = __re_arenaAllocatorAlloc;
+    allocator.free = __re_arenaAllocatorFree;
+    allocator.user_data = arena;
+
+    return allocator;
+}
\ No newline at end of file
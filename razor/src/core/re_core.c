@@ -1,10 +1,16 @@
 #include <re_core.h>
 
 #include <re_debug.h>
+#include <re_profile.h>
+#include <stdlib.h>
+#include "./re_jobs.h"
+#include "./re_threads.h"
 #include "../re_internals.h"
 
 #if RE_PLATFORM == RE_PLATFORM_WINDOWS
 #include "./win32/re_win32.h"
+#elif RE_PLATFORM == RE_PLATFORM_LINUX
+#include "./linux/re_linux.h"
 #endif
 
 const char* RE_APP_NAME = "Untitled Application";
@@ -12,6 +18,36 @@ uint8_t RE_APP_MAJOR_VER = 0u;
 uint8_t RE_APP_MINOR_VER = 0u;
 uint8_t RE_APP_PATCH_VER = 0u;
 
+static RE_THREAD_LOCAL re_Arena __re_scratch_arena = RE_NULL_HANDLE;
+
+// *=================================================
+// *
+// * __re_getScratchArena
+// *
+// *=================================================
+
+re_Arena __re_getScratchArena() {
+    if (__re_scratch_arena == RE_NULL_HANDLE) {
+        RE_MEMORY_MODULE_BEGIN(RE_CORE_MODULE);
+        __re_scratch_arena = re_createArena(RE_SCRATCH_ARENA_CAPACITY);
+        RE_MEMORY_MODULE_END();
+    }
+
+    return __re_scratch_arena;
+}
+
+// *=================================================
+// *
+// * __re_releaseScratchArena
+// *
+// *=================================================
+
+void __re_releaseScratchArena() {
+    if (__re_scratch_arena != RE_NULL_HANDLE) {
+        re_destroyArena(&__re_scratch_arena);
+    }
+}
+
 // *=================================================
 // *
 // * re_coreInit
@@ -20,6 +56,8 @@ uint8_t RE_APP_PATCH_VER = 0u;
 
 void re_coreInit(const re_CoreInitParams* params) {
     RE_MODULE_INIT_GUARD(RE_CORE_MODULE, 0u);
+    RE_MEMORY_MODULE_BEGIN(RE_CORE_MODULE);
+    RE_PROFILE_FUNCTION_BEGIN();
 
     re_assert(params != RE_NULL_HANDLE, "Attempted to initialize core module with NULL parameters!");
 
@@ -30,5 +68,18 @@ void re_coreInit(const re_CoreInitParams* params) {
 
     #if RE_PLATFORM == RE_PLATFORM_WINDOWS
     __re_initCoreWin32();
+    #elif RE_PLATFORM == RE_PLATFORM_LINUX
+    __re_initCoreLinux();
     #endif
+
+    #ifdef RE_MEMORY_TRACKING_ENABLED
+    atexit(re_logMemoryLeaks);
+    #endif
+
+    // ? Started after the leak report is registered so the workers are shut
+    // ? down (and their pool freed) before it runs.
+    __re_initJobSystem(params->job_worker_count, params->pin_job_workers);
+
+    RE_PROFILE_END();
+    RE_MEMORY_MODULE_END();
 }
\ No newline at end of file
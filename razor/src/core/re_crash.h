@@ -0,0 +1,37 @@
+#ifndef __RAZOR_CORE_CRASH_HEADER_FILE
+#define __RAZOR_CORE_CRASH_HEADER_FILE
+
+#include <re_core.h>
+
+// *=================================================
+// *
+// * Crash Handling
+// *
+// *=================================================
+
+typedef void (*re_CrashHandlerFn)();
+
+/// @brief Run a function when the process crashes (fatal signals on Linux, unhandled SEH
+/// exceptions on Windows). Afterwards the previously installed signal handler or exception filter
+/// runs, or else the platform's default crash behaviour.
+/// @param handler The function to run. It must not allocate, take locks or use stdio streams, and
+/// should keep to async-signal-safe calls (the flight recorder's only exception is rendering
+/// binary log events, which uses snprintf).
+void __re_installCrashHandler(const re_CrashHandlerFn handler);
+
+/// @brief Create (or truncate) a file using only calls that are safe inside a crash handler.
+/// @param file_path The path of the file.
+/// @return A platform file handle, or -1 if the file could not be created.
+intptr_t __re_openCrashFile(const char* file_path);
+
+/// @brief Write to a file opened with __re_openCrashFile.
+/// @param file The file to write to.
+/// @param data The bytes to write.
+/// @param size The number of bytes to write.
+void __re_writeCrashFile(const intptr_t file, const void* data, const size_t size);
+
+/// @brief Close a file opened with __re_openCrashFile.
+/// @param file The file to close.
+void __re_closeCrashFile(const intptr_t file);
+
+#endif
\ No newline at end of file
@@ -0,0 +1,22 @@
+#ifndef __RAZOR_CORE_FILES_HEADER_FILE
+#define __RAZOR_CORE_FILES_HEADER_FILE
+
+#include <re_core.h>
+
+#define RE_MAX_FILE_PATH_SIZE 1024u
+
+// *=================================================
+// *
+// * Engine Directories
+// *
+// *=================================================
+
+/// @brief Build the path of a file in the engine's per-user cache directory, creating the
+/// directory if needed ($XDG_CACHE_HOME/razor or ~/.cache/razor on Linux, %LOCALAPPDATA%\Razor on Windows).
+/// @param file_name The name of the file in the cache directory.
+/// @param buffer The buffer to write the path into.
+/// @param capacity The size of buffer.
+/// @return A flag determining if the directory exists and the path fit in buffer.
+bool __re_getCacheFilePath(const char* file_name, char* buffer, const size_t capacity);
+
+#endif
\ No newline at end of file
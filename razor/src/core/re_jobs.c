@@ -0,0 +1,639 @@
+#include <re_core.h>
+
+#include <re_debug.h>
+#include <stdlib.h>
+#include "./re_jobs.h"
+#include "./re_threads.h"
+#include "../re_internals.h"
+
+// ? Must be a power-of-two; a full deque spills into the shared queue.
+#define __RE_JOB_DEQUE_CAPACITY 4096u
+#define __RE_JOB_DEQUE_MASK (__RE_JOB_DEQUE_CAPACITY - 1u)
+
+#define __RE_JOB_POOL_SLOTS_PER_BLOCK 256u
+
+// ? Workers spin this many empty searches before going to sleep, and sleep
+// ? with a timeout so a missed wake-up only ever costs one timeout.
+#define __RE_JOB_IDLE_SPINS 256u
+#define __RE_JOB_SLEEP_TIMEOUT_MS 10u
+
+#define __RE_JOB_NO_WORKER UINT32_MAX
+
+// ? The top counter bit is held while the last job of a counter hands off
+// ? its dependent batches, so waiters never see the counter done (and free
+// ? it) while it is still being touched.
+#define __RE_JOB_COUNTER_RELEASE_BIT (1u << 31)
+
+typedef struct __re_Job {
+    re_JobDecl decl;
+    re_JobCounter counter;
+    struct __re_Job* next;
+} __re_Job;
+
+typedef struct __re_JobBatch {
+    struct __re_JobBatch* next;
+    re_JobCounter counter;
+    uint32_t job_count;
+    re_JobDecl jobs[];
+} __re_JobBatch;
+
+typedef struct re_JobCounter_T {
+    atomic_uint value;
+    re_SpinLock lock;
+    __re_JobBatch* pending;
+} re_JobCounter_T;
+
+// ? Chase-Lev work-stealing deque: the owner pushes and pops at the bottom,
+// ? thieves steal from the top. Memory orderings follow Le et al., "Correct
+// ? and Efficient Work-Stealing for Weak Memory Models" (PPoPP 2013), with
+// ? push's release fence folded into the store to bottom.
+typedef struct __re_JobDeque {
+    _Alignas(RE_CACHE_LINE_SIZE) atomic_int_fast64_t top;
+    _Alignas(RE_CACHE_LINE_SIZE) atomic_int_fast64_t bottom;
+    _Alignas(RE_CACHE_LINE_SIZE) _Atomic(__re_Job*) jobs[__RE_JOB_DEQUE_CAPACITY];
+} __re_JobDeque;
+
+typedef struct __re_JobWorker {
+    __re_JobDeque deque;
+    re_Thread thread;
+    uint32_t worker_idx;
+    bool is_pinned;
+} __re_JobWorker;
+
+static __re_JobWorker* __re_job_workers = RE_NULL_HANDLE;
+static uint32_t __re_job_worker_count = 0u;
+static atomic_bool __re_job_running = false;
+
+static re_Pool __re_job_pool = RE_NULL_HANDLE;
+static re_Semaphore __re_job_wake = RE_NULL_HANDLE;
+static atomic_uint __re_job_sleeping_count = 0u;
+
+// ? Jobs queued by threads that are not workers, or by workers whose deque
+// ? is full.
+static re_SpinLock __re_job_queue_lock = RE_SPIN_LOCK_INIT;
+static __re_Job* __re_job_queue = RE_NULL_HANDLE;
+static atomic_uint __re_job_queue_count = 0u;
+
+static RE_THREAD_LOCAL uint32_t __re_job_worker_index = __RE_JOB_NO_WORKER;
+static RE_THREAD_LOCAL uint32_t __re_job_random_state = 0u;
+
+// *=================================================
+// *
+// * __re_pushJobDeque
+// *
+// *=================================================
+
+static bool __re_pushJobDeque(__re_JobDeque* deque, __re_Job* job) {
+    const int_fast64_t bottom = atomic_load_explicit(&deque->bottom, memory_order_relaxed);
+    const int_fast64_t top = atomic_load_explicit(&deque->top, memory_order_acquire);
+
+    if (bottom - top >= (int_fast64_t)__RE_JOB_DEQUE_CAPACITY) {
+        return false;
+    }
+
+    atomic_store_explicit(&deque->jobs[bottom & __RE_JOB_DEQUE_MASK], job, memory_order_relaxed);
+    atomic_store_explicit(&deque->bottom, bottom + 1, memory_order_release);
+
+    return true;
+}
+
+// *=================================================
+// *
+// * __re_popJobDeque
+// *
+// *=================================================
+
+static __re_Job* __re_popJobDeque(__re_JobDeque* deque) {
+    const int_fast64_t bottom = atomic_load_explicit(&deque->bottom, memory_order_relaxed) - 1;
+    atomic_store_explicit(&deque->bottom, bottom, memory_order_relaxed);
+    atomic_thread_fence(memory_order_seq_cst);
+    int_fast64_t top = atomic_load_explicit(&deque->top, memory_order_relaxed);
+
+    if (top > bottom) {
+        atomic_store_explicit(&deque->bottom, bottom + 1, memory_order_relaxed);
+        return RE_NULL_HANDLE;
+    }
+
+    __re_Job* job = atomic_load_explicit(&deque->jobs[bottom & __RE_JOB_DEQUE_MASK], memory_order_relaxed);
+
+    if (top == bottom) {
+        // ? Last job left; race the thieves for it.
+        if (!atomic_compare_exchange_strong_explicit(&deque->top, &top, top + 1, memory_order_seq_cst, memory_order_relaxed)) {
+            job = RE_NULL_HANDLE;
+        }
+
+        atomic_store_explicit(&deque->bottom, bottom + 1, memory_order_relaxed);
+    }
+
+    return job;
+}
+
+// *=================================================
+// *
+// * __re_stealJobDeque
+// *
+// *=================================================
+
+static __re_Job* __re_stealJobDeque(__re_JobDeque* deque) {
+    int_fast64_t top = atomic_load_explicit(&deque->top, memory_order_acquire);
+    atomic_thread_fence(memory_order_seq_cst);
+    const int_fast64_t bottom = atomic_load_explicit(&deque->bottom, memory_order_acquire);
+
+    if (top >= bottom) {
+        return RE_NULL_HANDLE;
+    }
+
+    __re_Job* job = atomic_load_explicit(&deque->jobs[top & __RE_JOB_DEQUE_MASK], memory_order_relaxed);
+
+    if (!atomic_compare_exchange_strong_explicit(&deque->top, &top, top + 1, memory_order_seq_cst, memory_order_relaxed)) {
+        return RE_NULL_HANDLE;
+    }
+
+    return job;
+}
+
+// *=================================================
+// *
+// * __re_popJobQueue
+// *
+// *=================================================
+
+static __re_Job* __re_popJobQueue() {
+    // ? Skip the lock while the queue is empty, which is nearly always.
+    if (atomic_load_explicit(&__re_job_queue_count, memory_order_acquire) == 0) {
+        return RE_NULL_HANDLE;
+    }
+
+    __re_lockSpinLock(&__re_job_queue_lock);
+
+    __re_Job* job = __re_job_queue;
+    if (job != RE_NULL_HANDLE) {
+        __re_job_queue = job->next;
+        atomic_fetch_sub_explicit(&__re_job_queue_count, 1u, memory_order_relaxed);
+    }
+
+    __re_unlockSpinLock(&__re_job_queue_lock);
+
+    return job;
+}
+
+// *=================================================
+// *
+// * __re_findJob
+// *
+// *=================================================
+
+static __re_Job* __re_findJob() {
+    const uint32_t worker_idx = __re_job_worker_index;
+    __re_Job* job = RE_NULL_HANDLE;
+
+    if (worker_idx != __RE_JOB_NO_WORKER) {
+        job = __re_popJobDeque(&__re_job_workers[worker_idx].deque);
+
+        if (job != RE_NULL_HANDLE) {
+            return job;
+        }
+    }
+
+    job = __re_popJobQueue();
+
+    if (job != RE_NULL_HANDLE) {
+        return job;
+    }
+
+    // ? Start at a random victim so thieves spread out instead of all
+    // ? hammering worker 0.
+    uint32_t random_state = __re_job_random_state != 0 ? __re_job_random_state : 0x9E3779B9u ^ __re_getThreadIndex();
+    random_state ^= random_state << 13;
+    random_state ^= random_state >> 17;
+    random_state ^= random_state << 5;
+    __re_job_random_state = random_state;
+
+    const uint32_t first_victim = random_state % __re_job_worker_count;
+
+    for (uint32_t idx = 0; idx < __re_job_worker_count; ++idx) {
+        const uint32_t victim_idx = (first_victim + idx) % __re_job_worker_count;
+
+        if (victim_idx == worker_idx) {
+            continue;
+        }
+
+        job = __re_stealJobDeque(&__re_job_workers[victim_idx].deque);
+
+        if (job != RE_NULL_HANDLE) {
+            return job;
+        }
+    }
+
+    return RE_NULL_HANDLE;
+}
+
+// *=================================================
+// *
+// * __re_submitJobs
+// *
+// *=================================================
+
+static void __re_submitJobs(const re_JobDecl* jobs, const uint32_t job_count, re_JobCounter counter) {
+    RE_MEMORY_MODULE_BEGIN(RE_CORE_MODULE);
+
+    const uint32_t worker_idx = __re_job_worker_index;
+    __re_JobDeque* deque = worker_idx != __RE_JOB_NO_WORKER ? &__re_job_workers[worker_idx].deque : RE_NULL_HANDLE;
+
+    for (uint32_t idx = 0; idx < job_count; ++idx) {
+        __re_Job* job = (__re_Job*)re_poolAlloc(__re_job_pool);
+        re_assert(job != RE_NULL_HANDLE, "Failed to allocate job!");
+
+        job->decl = jobs[idx];
+        job->counter = counter;
+        job->next = RE_NULL_HANDLE;
+
+        if (deque != RE_NULL_HANDLE && __re_pushJobDeque(deque, job)) {
+            continue;
+        }
+
+        __re_lockSpinLock(&__re_job_queue_lock);
+        job->next = __re_job_queue;
+        __re_job_queue = job;
+        atomic_fetch_add_explicit(&__re_job_queue_count, 1u, memory_order_release);
+        __re_unlockSpinLock(&__re_job_queue_lock);
+    }
+
+    RE_MEMORY_MODULE_END();
+
+    // ? Pairs with the fence a worker issues between announcing it is going
+    // ? to sleep and its last search, so either it sees these jobs or this
+    // ? thread sees it sleeping.
+    atomic_thread_fence(memory_order_seq_cst);
+    const uint32_t sleeping_count = atomic_load_explicit(&__re_job_sleeping_count, memory_order_relaxed);
+    const uint32_t wake_count = sleeping_count < job_count ? sleeping_count : job_count;
+
+    for (uint32_t idx = 0; idx < wake_count; ++idx) {
+        __re_signalSemaphore(__re_job_wake);
+    }
+}
+
+// *=================================================
+// *
+// * __re_releaseJobCounter
+// *
+// *=================================================
+
+static void __re_releaseJobCounter(re_JobCounter counter) {
+    uint32_t value = atomic_load_explicit(&counter->value, memory_order_relaxed);
+    uint32_t desired = 0u;
+
+    do {
+        // ? A counter reused before its last release finished waits for that
+        // ? release to let go of the counter.
+        while ((value & __RE_JOB_COUNTER_RELEASE_BIT) != 0) {
+            __re_cpuRelax();
+            value = atomic_load_explicit(&counter->value, memory_order_relaxed);
+        }
+
+        re_assert(value > 0, "Job counter released more times than it was run against!");
+        desired = value == 1u ? __RE_JOB_COUNTER_RELEASE_BIT : value - 1u;
+    } while (!atomic_compare_exchange_weak_explicit(&counter->value, &value, desired, memory_order_acq_rel, memory_order_relaxed));
+
+    if (desired != __RE_JOB_COUNTER_RELEASE_BIT) {
+        return;
+    }
+
+    __re_lockSpinLock(&counter->lock);
+    __re_JobBatch* batch = counter->pending;
+    counter->pending = RE_NULL_HANDLE;
+    __re_unlockSpinLock(&counter->lock);
+
+    // ? The counter may be destroyed from here on.
+    atomic_fetch_and_explicit(&counter->value, ~__RE_JOB_COUNTER_RELEASE_BIT, memory_order_release);
+
+    while (batch != RE_NULL_HANDLE) {
+        __re_JobBatch* next_batch = batch->next;
+
+        __re_submitJobs(batch->jobs, batch->job_count, batch->counter);
+        re_free(batch);
+
+        batch = next_batch;
+    }
+}
+
+// *=================================================
+// *
+// * __re_executeJob
+// *
+// *=================================================
+
+static void __re_executeJob(__re_Job* job) {
+    const re_JobDecl decl = job->decl;
+    re_JobCounter counter = job->counter;
+
+    re_poolFree(__re_job_pool, job);
+
+    decl.job_fn(decl.user_data);
+
+    if (counter != RE_NULL_HANDLE) {
+        __re_releaseJobCounter(counter);
+    }
+}
+
+// *=================================================
+// *
+// * __re_runJobWorker
+// *
+// *=================================================
+
+static void __re_runJobWorker(void* user_data) {
+    __re_JobWorker* worker = (__re_JobWorker*)user_data;
+    __re_job_worker_index = worker->worker_idx;
+
+    if (worker->is_pinned && !__re_pinCurrentThread(worker->worker_idx)) {
+        re_logWarn("Failed to pin job worker %u to its core!", worker->worker_idx);
+    }
+
+    uint32_t idle_count = 0;
+
+    while (atomic_load_explicit(&__re_job_running, memory_order_acquire)) {
+        __re_Job* job = __re_findJob();
+
+        if (job != RE_NULL_HANDLE) {
+            __re_executeJob(job);
+            idle_count = 0;
+            continue;
+        }
+
+        if (++idle_count < __RE_JOB_IDLE_SPINS) {
+            __re_cpuRelax();
+            continue;
+        }
+
+        atomic_fetch_add_explicit(&__re_job_sleeping_count, 1u, memory_order_relaxed);
+        atomic_thread_fence(memory_order_seq_cst);
+
+        job = __re_findJob();
+
+        if (job == RE_NULL_HANDLE && atomic_load_explicit(&__re_job_running, memory_order_acquire)) {
+            __re_waitSemaphore(__re_job_wake, __RE_JOB_SLEEP_TIMEOUT_MS);
+        }
+
+        atomic_fetch_sub_explicit(&__re_job_sleeping_count, 1u, memory_order_relaxed);
+
+        if (job != RE_NULL_HANDLE) {
+            __re_executeJob(job);
+        }
+
+        idle_count = 0;
+    }
+}
+
+// *=================================================
+// *
+// * __re_shutdownJobSystem
+// *
+// *=================================================
+
+static void __re_shutdownJobSystem() {
+    if (!atomic_exchange_explicit(&__re_job_running, false, memory_order_acq_rel)) {
+        return;
+    }
+
+    for (uint32_t idx = 1; idx < __re_job_worker_count; ++idx) {
+        __re_signalSemaphore(__re_job_wake);
+    }
+
+    for (uint32_t idx = 1; idx < __re_job_worker_count; ++idx) {
+        __re_joinThread(&__re_job_workers[idx].thread);
+    }
+
+    // ? Jobs still queued at exit are dropped along with their pool.
+    __re_job_worker_index = __RE_JOB_NO_WORKER;
+    __re_job_worker_count = 0u;
+    __re_job_queue = RE_NULL_HANDLE;
+    atomic_store_explicit(&__re_job_queue_count, 0u, memory_order_relaxed);
+
+    re_freeAlign(__re_job_workers);
+    __re_job_workers = RE_NULL_HANDLE;
+
+    re_destroyPool(&__re_job_pool);
+    __re_destroySemaphore(&__re_job_wake);
+}
+
+// *=================================================
+// *
+// * __re_initJobSystem
+// *
+// *=================================================
+
+void __re_initJobSystem(const uint32_t worker_count, const bool pin_workers) {
+    uint32_t job_worker_count = worker_count > 0 ? worker_count : __re_getCpuCoreCount();
+    job_worker_count = job_worker_count < RE_MAX_JOB_WORKERS ? job_worker_count : RE_MAX_JOB_WORKERS;
+
+    // ? Worker 0 only runs jobs while it waits on a counter, so a lone worker
+    // ? would starve fire-and-forget jobs.
+    job_worker_count = job_worker_count > 2u ? job_worker_count : 2u;
+
+    re_PoolCreateInfo pool_create_info = {0};
+    pool_create_info.slot_size = sizeof(__re_Job);
+    pool_create_info.slots_per_block = __RE_JOB_POOL_SLOTS_PER_BLOCK;
+    pool_create_info.flags = RE_POOL_THREAD_CACHE;
+
+    __re_job_pool = re_createPool(&pool_create_info);
+    __re_job_wake = __re_createSemaphore();
+
+    __re_job_workers = (__re_JobWorker*)re_callocAlign(job_worker_count, sizeof(__re_JobWorker), RE_CACHE_LINE_SIZE);
+    __re_job_worker_count = job_worker_count;
+
+    for (uint32_t idx = 0; idx < job_worker_count; ++idx) {
+        __re_job_workers[idx].worker_idx = idx;
+        __re_job_workers[idx].is_pinned = pin_workers;
+    }
+
+    // ? The initializing thread is worker 0 and is left unpinned; it is
+    // ? usually the main thread, which owns the window and the renderer.
+    __re_job_worker_index = 0u;
+
+    atomic_store_explicit(&__re_job_running, true, memory_order_release);
+
+    for (uint32_t idx = 1; idx < job_worker_count; ++idx) {
+        __re_job_workers[idx].thread = __re_createThread(__re_runJobWorker, &__re_job_workers[idx]);
+    }
+
+    re_logInfo("Job system started with %u workers.", job_worker_count);
+
+    atexit(__re_shutdownJobSystem);
+}
+
+// *=================================================
+// *
+// * re_getJobWorkerCount
+// *
+// *=================================================
+
+uint32_t re_getJobWorkerCount() {
+    return __re_job_worker_count;
+}
+
+// *=================================================
+// *
+// * re_createJobCounter
+// *
+// *=================================================
+
+re_JobCounter re_createJobCounter() {
+    re_JobCounter counter = (re_JobCounter)re_calloc(1, sizeof(re_JobCounter_T));
+
+    atomic_init(&counter->value, 0u);
+    atomic_flag_clear(&counter->lock);
+
+    return counter;
+}
+
+// *=================================================
+// *
+// * re_destroyJobCounter
+// *
+// *=================================================
+
+void re_destroyJobCounter(re_JobCounter* counter) {
+    re_assert(counter != RE_NULL_HANDLE, "Attempting to destroy NULL job counter!");
+
+    re_JobCounter counter_data = *counter;
+    re_assert(counter_data != RE_NULL_HANDLE, "Attempting to destroy NULL job counter!");
+    re_assert(re_isJobCounterDone(counter_data), "Attempting to destroy job counter with unfinished jobs!");
+
+    re_free(counter_data);
+    *counter = RE_NULL_HANDLE;
+}
+
+// *=================================================
+// *
+// * re_runJobs
+// *
+// *=================================================
+
+void re_runJobs(const re_JobDecl* jobs, const uint32_t job_count, re_JobCounter counter) {
+    re_assert(jobs != RE_NULL_HANDLE || job_count == 0, "Attempting to run NULL jobs!");
+
+    if (job_count == 0) {
+        return;
+    }
+
+    // ? Without workers there is nothing to hand the jobs to.
+    if (!atomic_load_explicit(&__re_job_running, memory_order_acquire)) {
+        for (uint32_t idx = 0; idx < job_count; ++idx) {
+            jobs[idx].job_fn(jobs[idx].user_data);
+        }
+
+        return;
+    }
+
+    if (counter != RE_NULL_HANDLE) {
+        atomic_fetch_add_explicit(&counter->value, job_count, memory_order_relaxed);
+    }
+
+    __re_submitJobs(jobs, job_count, counter);
+}
+
+// *=================================================
+// *
+// * re_runJobsAfter
+// *
+// *=================================================
+
+void re_runJobsAfter(const re_JobDecl* jobs, const uint32_t job_count, re_JobCounter dependency, re_JobCounter counter) {
+    re_assert(dependency != RE_NULL_HANDLE, "Attempting to run jobs after NULL job counter!");
+    re_assert(dependency != counter, "Jobs cannot depend on the counter that tracks them!");
+    re_assert(jobs != RE_NULL_HANDLE || job_count == 0, "Attempting to run NULL jobs!");
+
+    if (job_count == 0) {
+        return;
+    }
+
+    if (!atomic_load_explicit(&__re_job_running, memory_order_acquire)) {
+        re_waitForJobCounter(dependency);
+        re_runJobs(jobs, job_count, counter);
+        return;
+    }
+
+    if (counter != RE_NULL_HANDLE) {
+        atomic_fetch_add_explicit(&counter->value, job_count, memory_order_relaxed);
+    }
+
+    // ? The dependency's last job takes its pending batches under the same
+    // ? lock, so a batch is either seen here as runnable or handed off there.
+    // ? A release in flight has already taken them; wait for it to finish so
+    // ? nothing runs after the dependency before the dependency reads done.
+    uint32_t dependency_value = 0u;
+
+    for (;;) {
+        __re_lockSpinLock(&dependency->lock);
+        dependency_value = atomic_load_explicit(&dependency->value, memory_order_acquire);
+
+        if ((dependency_value & __RE_JOB_COUNTER_RELEASE_BIT) == 0) {
+            break;
+        }
+
+        __re_unlockSpinLock(&dependency->lock);
+        __re_cpuRelax();
+    }
+
+    if (dependency_value != 0) {
+        RE_MEMORY_MODULE_BEGIN(RE_CORE_MODULE);
+        __re_JobBatch* batch = (__re_JobBatch*)re_malloc(sizeof(__re_JobBatch) + job_count * sizeof(re_JobDecl));
+        RE_MEMORY_MODULE_END();
+
+        batch->next = dependency->pending;
+        batch->counter = counter;
+        batch->job_count = job_count;
+        re_memcpy(batch->jobs, jobs, job_count * sizeof(re_JobDecl));
+
+        dependency->pending = batch;
+
+        __re_unlockSpinLock(&dependency->lock);
+        return;
+    }
+
+    __re_unlockSpinLock(&dependency->lock);
+
+    __re_submitJobs(jobs, job_count, counter);
+}
+
+// *=================================================
+// *
+// * re_isJobCounterDone
+// *
+// *=================================================
+
+bool re_isJobCounterDone(const re_JobCounter counter) {
+    re_assert(counter != RE_NULL_HANDLE, "Attempting to check NULL job counter!");
+
+    return atomic_load_explicit(&counter->value, memory_order_acquire) == 0;
+}
+
+// *=================================================
+// *
+// * re_waitForJobCounter
+// *
+// *=================================================
+
+void re_waitForJobCounter(re_JobCounter counter) {
+    re_assert(counter != RE_NULL_HANDLE, "Attempting to wait on NULL job counter!");
+
+    uint32_t idle_count = 0;
+
+    while (!re_isJobCounterDone(counter)) {
+        __re_Job* job = atomic_load_explicit(&__re_job_running, memory_order_acquire) ? __re_findJob() : RE_NULL_HANDLE;
+
+        if (job != RE_NULL_HANDLE) {
+            __re_executeJob(job);
+            idle_count = 0;
+            continue;
+        }
+
+        if (++idle_count < __RE_JOB_IDLE_SPINS) {
+            __re_cpuRelax();
+        }
+        else {
+            __re_yieldThread();
+        }
+    }
+}
\ No newline at end of file
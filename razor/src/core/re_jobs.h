@@ -0,0 +1,11 @@
+#ifndef __RAZOR_CORE_JOBS_HEADER_FILE
+#define __RAZOR_CORE_JOBS_HEADER_FILE
+
+#include <re_core.h>
+
+/// @brief Start the job workers. The calling thread becomes worker 0.
+/// @param worker_count The number of job workers (0 for one per detected core; at least 2 are started).
+/// @param pin_workers A flag determining if each spawned worker is pinned to its own core.
+void __re_initJobSystem(const uint32_t worker_count, const bool pin_workers);
+
+#endif
\ No newline at end of file
@@ -0,0 +1,461 @@
+#include <re_core.h>
+
+#include <re_debug.h>
+#include "./re_memory.h"
+#include "./re_threads.h"
+
+#include <string.h>
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+// ? Size classes are 16 byte steps up to 128 bytes, then four classes per
+// ? power of two up to 2 KiB. Anything larger goes straight to the platform.
+#define __RE_MEMORY_SIZE_CLASS_COUNT 24u
+#define __RE_MEMORY_SMALL_CLASS_COUNT 8u
+#define __RE_MEMORY_MAX_CLASS_SIZE 2048u
+#define __RE_MEMORY_LARGE_CLASS UINT32_MAX
+
+// ? Blocks move between thread caches and the depot in whole batches.
+#define __RE_MEMORY_BATCH_SIZE 32u
+#define __RE_MEMORY_THREAD_CACHE_LIMIT (__RE_MEMORY_BATCH_SIZE * 2u)
+
+typedef struct __re_MemoryHeader {
+    size_t size;
+    uint32_t size_class;
+    uint32_t module;
+} __re_MemoryHeader;
+
+#define __RE_MEMORY_HEADER_SIZE sizeof(__re_MemoryHeader)
+
+// ? Lives in the user area of a block while it sits in a cache or the depot.
+typedef struct __re_MemoryFreeBlock {
+    struct __re_MemoryFreeBlock* next;
+    struct __re_MemoryFreeBlock* next_batch;
+} __re_MemoryFreeBlock;
+
+typedef struct __re_MemoryThreadBin {
+    __re_MemoryFreeBlock* head;
+    uint32_t count;
+} __re_MemoryThreadBin;
+
+// ? Zero-initialized static storage leaves every depot lock clear.
+typedef struct __re_MemoryDepot {
+    _Alignas(RE_CACHE_LINE_SIZE) re_SpinLock lock;
+    __re_MemoryFreeBlock* batches;
+
+    __re_MemoryFreeBlock* loose;
+    uint32_t loose_count;
+} __re_MemoryDepot;
+
+static RE_THREAD_LOCAL __re_MemoryThreadBin __re_thread_bins[__RE_MEMORY_SIZE_CLASS_COUNT];
+static __re_MemoryDepot __re_memory_depots[__RE_MEMORY_SIZE_CLASS_COUNT];
+
+// *=================================================
+// *
+// * __re_getSizeClass
+// *
+// *=================================================
+
+static inline uint32_t __re_getSizeClass(const size_t size) {
+    const uint32_t last_byte = (uint32_t)(size - 1);
+
+    if (last_byte < 128u) {
+        return last_byte >> 4;
+    }
+
+    #ifdef _MSC_VER
+    unsigned long msb = 0;
+    _BitScanReverse(&msb, last_byte);
+    #else
+    const uint32_t msb = 31u - (uint32_t)__builtin_clz(last_byte);
+    #endif
+
+    const uint32_t shift = (uint32_t)msb - 2u;
+    return __RE_MEMORY_SMALL_CLASS_COUNT + ((uint32_t)msb - 7u) * 4u + (last_byte >> shift) - 4u;
+}
+
+// *=================================================
+// *
+// * __re_getSizeClassSize
+// *
+// *=================================================
+
+static inline size_t __re_getSizeClassSize(const uint32_t size_class) {
+    if (size_class < __RE_MEMORY_SMALL_CLASS_COUNT) {
+        return (size_t)(size_class + 1u) * 16u;
+    }
+
+    const uint32_t group = (size_class - __RE_MEMORY_SMALL_CLASS_COUNT) / 4u;
+    const uint32_t step = (size_class - __RE_MEMORY_SMALL_CLASS_COUNT) % 4u;
+
+    return ((size_t)128u << group) + (size_t)(step + 1u) * ((size_t)32u << group);
+}
+
+// *=================================================
+// *
+// * __re_getMemoryHeader
+// *
+// *=================================================
+
+static inline __re_MemoryHeader* __re_getMemoryHeader(void* src) {
+    return (__re_MemoryHeader*)((uint8_t*)src - __RE_MEMORY_HEADER_SIZE);
+}
+
+// *=================================================
+// *
+// * __re_refillThreadBin
+// *
+// *=================================================
+
+static bool __re_refillThreadBin(__re_MemoryThreadBin* bin, const uint32_t size_class) {
+    __re_MemoryDepot* depot = &__re_memory_depots[size_class];
+
+    __re_lockSpinLock(&depot->lock);
+    __re_MemoryFreeBlock* batch = depot->batches;
+    uint32_t batch_count = __RE_MEMORY_BATCH_SIZE;
+
+    if (batch != RE_NULL_HANDLE) {
+        depot->batches = batch->next_batch;
+    }
+    else if (depot->loose != RE_NULL_HANDLE) {
+        batch = depot->loose;
+        batch_count = depot->loose_count;
+
+        depot->loose = RE_NULL_HANDLE;
+        depot->loose_count = 0;
+    }
+
+    __re_unlockSpinLock(&depot->lock);
+
+    if (batch != RE_NULL_HANDLE) {
+        bin->head = batch;
+        bin->count = batch_count;
+        return true;
+    }
+
+    // ? The depot is empty, so carve a fresh batch out of one platform block.
+    // ? Slabs stay with the size class for the rest of the process.
+    const size_t block_size = __RE_MEMORY_HEADER_SIZE + __re_getSizeClassSize(size_class);
+    uint8_t* slab = (uint8_t*)__re_platformMalloc(block_size * __RE_MEMORY_BATCH_SIZE);
+
+    if (slab == RE_NULL_HANDLE) {
+        return false;
+    }
+
+    __re_MemoryFreeBlock* head = RE_NULL_HANDLE;
+    for (uint32_t idx = __RE_MEMORY_BATCH_SIZE; idx > 0; --idx) {
+        uint8_t* block = slab + (idx - 1) * block_size;
+
+        __re_MemoryHeader* header = (__re_MemoryHeader*)block;
+        header->size_class = size_class;
+
+        __re_MemoryFreeBlock* free_block = (__re_MemoryFreeBlock*)(block + __RE_MEMORY_HEADER_SIZE);
+        free_block->next = head;
+        head = free_block;
+    }
+
+    bin->head = head;
+    bin->count = __RE_MEMORY_BATCH_SIZE;
+
+    return true;
+}
+
+// *=================================================
+// *
+// * __re_spillThreadBin
+// *
+// *=================================================
+
+static void __re_spillThreadBin(__re_MemoryThreadBin* bin, const uint32_t size_class) {
+    // ? The most recently freed blocks are the warmest, so they stay in the
+    // ? bin and the batch is cut from the tail of the list.
+    const uint32_t keep_count = bin->count - __RE_MEMORY_BATCH_SIZE;
+    __re_MemoryFreeBlock* batch = bin->head;
+
+    if (keep_count > 0) {
+        __re_MemoryFreeBlock* keep_tail = bin->head;
+
+        for (uint32_t idx = 1; idx < keep_count; ++idx) {
+            keep_tail = keep_tail->next;
+        }
+
+        batch = keep_tail->next;
+        keep_tail->next = RE_NULL_HANDLE;
+    }
+    else {
+        bin->head = RE_NULL_HANDLE;
+    }
+
+    bin->count = keep_count;
+
+    __re_MemoryDepot* depot = &__re_memory_depots[size_class];
+
+    __re_lockSpinLock(&depot->lock);
+    batch->next_batch = depot->batches;
+    depot->batches = batch;
+    __re_unlockSpinLock(&depot->lock);
+}
+
+// *=================================================
+// *
+// * __re_allocateBlock
+// *
+// *=================================================
+
+static void* __re_allocateBlock(const size_t size, const bool zero) {
+    if (size > __RE_MEMORY_MAX_CLASS_SIZE) {
+        if (size > SIZE_MAX - __RE_MEMORY_HEADER_SIZE) {
+            return RE_NULL_HANDLE;
+        }
+
+        __re_MemoryHeader* header = (__re_MemoryHeader*)(
+            zero
+                ? __re_platformCalloc(1, __RE_MEMORY_HEADER_SIZE + size)
+                : __re_platformMalloc(__RE_MEMORY_HEADER_SIZE + size)
+        );
+
+        if (header == RE_NULL_HANDLE) {
+            return RE_NULL_HANDLE;
+        }
+
+        header->size = size;
+        header->size_class = __RE_MEMORY_LARGE_CLASS;
+
+        #ifdef RE_MEMORY_TRACKING_ENABLED
+        header->module = __re_getMemoryModule();
+        __re_trackAllocation(header->module, size);
+        #endif
+
+        return header + 1;
+    }
+
+    const uint32_t size_class = __re_getSizeClass(size);
+    __re_MemoryThreadBin* bin = &__re_thread_bins[size_class];
+
+    if (bin->head == RE_NULL_HANDLE && !__re_refillThreadBin(bin, size_class)) {
+        return RE_NULL_HANDLE;
+    }
+
+    __re_MemoryFreeBlock* block = bin->head;
+    bin->head = block->next;
+    --bin->count;
+
+    __re_MemoryHeader* header = __re_getMemoryHeader(block);
+    header->size = size;
+
+    #ifdef RE_MEMORY_TRACKING_ENABLED
+    header->module = __re_getMemoryModule();
+    __re_trackAllocation(header->module, size);
+    #endif
+
+    if (zero) {
+        memset(block, 0, size);
+    }
+
+    return block;
+}
+
+// *=================================================
+// *
+// * __re_releaseBlock
+// *
+// *=================================================
+
+static void __re_releaseBlock(void* src) {
+    __re_MemoryHeader* header = __re_getMemoryHeader(src);
+    const uint32_t size_class = header->size_class;
+
+    #ifdef RE_MEMORY_TRACKING_ENABLED
+    __re_trackFree(header->module, header->size);
+    #endif
+
+    if (size_class == __RE_MEMORY_LARGE_CLASS) {
+        __re_platformFree(header);
+        return;
+    }
+
+    re_assert(size_class < __RE_MEMORY_SIZE_CLASS_COUNT, "Attempted to free invalid memory!");
+
+    __re_MemoryThreadBin* bin = &__re_thread_bins[size_class];
+
+    __re_MemoryFreeBlock* block = (__re_MemoryFreeBlock*)src;
+    block->next = bin->head;
+    bin->head = block;
+    ++bin->count;
+
+    if (bin->count >= __RE_MEMORY_THREAD_CACHE_LIMIT) {
+        __re_spillThreadBin(bin, size_class);
+    }
+}
+
+// *=================================================
+// *
+// * __re_flushThreadMemoryCache
+// *
+// *=================================================
+
+void __re_flushThreadMemoryCache() {
+    for (uint32_t size_class = 0; size_class < __RE_MEMORY_SIZE_CLASS_COUNT; ++size_class) {
+        __re_MemoryThreadBin* bin = &__re_thread_bins[size_class];
+
+        while (bin->count >= __RE_MEMORY_BATCH_SIZE) {
+            __re_spillThreadBin(bin, size_class);
+        }
+
+        if (bin->head == RE_NULL_HANDLE) {
+            continue;
+        }
+
+        // ? Whatever is left is less than a batch, so it goes on the depot's
+        // ? loose list where the next refill picks it up.
+        __re_MemoryFreeBlock* tail = bin->head;
+        while (tail->next != RE_NULL_HANDLE) {
+            tail = tail->next;
+        }
+
+        __re_MemoryDepot* depot = &__re_memory_depots[size_class];
+
+        __re_lockSpinLock(&depot->lock);
+        tail->next = depot->loose;
+        depot->loose = bin->head;
+        depot->loose_count += bin->count;
+        __re_unlockSpinLock(&depot->lock);
+
+        bin->head = RE_NULL_HANDLE;
+        bin->count = 0;
+    }
+}
+
+// *=================================================
+// *
+// * re_malloc
+// *
+// *=================================================
+
+void* re_malloc(const size_t size) {
+    re_assert(size > 0, "Cannot allocate 0 bytes!");
+
+    return __re_allocateBlock(size, false);
+}
+
+// *=================================================
+// *
+// * re_calloc
+// *
+// *=================================================
+
+void* re_calloc(const size_t element_count, const size_t element_size) {
+    if (element_size != 0 && element_count > SIZE_MAX / element_size) {
+        return RE_NULL_HANDLE;
+    }
+
+    const size_t total_size = element_count * element_size;
+    re_assert(total_size > 0, "Cannot contiguous allocate 0 bytes!");
+
+    return __re_allocateBlock(total_size, true);
+}
+
+// *=================================================
+// *
+// * re_realloc
+// *
+// *=================================================
+
+void* re_realloc(void* src, const size_t new_size) {
+    re_assert(src != RE_NULL_HANDLE, "Cannot reallocate from NULL pointer!");
+    re_assert(new_size > 0, "Cannot reallocate into 0 bytes!");
+
+    __re_MemoryHeader* header = __re_getMemoryHeader(src);
+    const uint32_t size_class = header->size_class;
+
+    if (size_class == __RE_MEMORY_LARGE_CLASS && new_size > __RE_MEMORY_MAX_CLASS_SIZE) {
+        if (new_size > SIZE_MAX - __RE_MEMORY_HEADER_SIZE) {
+            return RE_NULL_HANDLE;
+        }
+
+        header = (__re_MemoryHeader*)__re_platformRealloc(header, __RE_MEMORY_HEADER_SIZE + new_size);
+
+        if (header == RE_NULL_HANDLE) {
+            return RE_NULL_HANDLE;
+        }
+
+        #ifdef RE_MEMORY_TRACKING_ENABLED
+        __re_trackResize(header->module, header->size, new_size);
+        #endif
+
+        header->size = new_size;
+        return header + 1;
+    }
+
+    if (size_class != __RE_MEMORY_LARGE_CLASS && new_size <= __re_getSizeClassSize(size_class)) {
+        #ifdef RE_MEMORY_TRACKING_ENABLED
+        __re_trackResize(header->module, header->size, new_size);
+        #endif
+
+        header->size = new_size;
+        return src;
+    }
+
+    void* ptr = __re_allocateBlock(new_size, false);
+
+    if (ptr == RE_NULL_HANDLE) {
+        return RE_NULL_HANDLE;
+    }
+
+    memcpy(ptr, src, header->size < new_size ? header->size : new_size);
+    __re_releaseBlock(src);
+
+    return ptr;
+}
+
+// *=================================================
+// *
+// * re_free
+// *
+// *=================================================
+
+void re_free(void* src) {
+    re_assert(src != RE_NULL_HANDLE, "Cannot free NULL pointer!");
+
+    __re_releaseBlock(src);
+}
+
+// *=================================================
+// *
+// * __re_heapAllocatorAlloc
+// *
+// *=================================================
+
+static void* __re_heapAllocatorAlloc(void* user_data, const size_t size, const size_t alignment) {
+    (void)user_data;
+
+    return re_mallocAlign(size, alignment);
+}
+
+// *=================================================
+// *
+// * __re_heapAllocatorFree
+// *
+// *=================================================
+
+static void __re_heapAllocatorFree(void* user_data, void* src) {
+    (void)user_data;
+
+    re_freeAlign(src);
+}
+
+// *=================================================
+// *
+// * re_getHeapAllocator
+// *
+// *=================================================
+
+re_Allocator re_getHeapAllocator() {
+    re_Allocator allocator = {0};
+    allocator.alloc = __re_heapAllocatorAlloc;
+    allocator.free = __re_heapAllocatorFree;
+
+    return allocator;
+}
\ No newline at end of file
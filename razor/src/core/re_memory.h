@@ -0,0 +1,130 @@
+#ifndef __RAZOR_CORE_MEMORY_HEADER_FILE
+#define __RAZOR_CORE_MEMORY_HEADER_FILE
+
+#include <re_core.h>
+
+// *=================================================
+// *
+// * Platform Heap
+// *
+// *=================================================
+
+/// @brief Allocate a chunk of memory directly from the platform heap.
+/// @param size The number of bytes to allocate.
+/// @return A pointer to the new memory.
+void* __re_platformMalloc(const size_t size);
+
+/// @brief Allocate and zero a chunk of memory directly from the platform heap.
+/// @param element_count The number of elements in the new memory.
+/// @param element_size The size in bytes of each element.
+/// @return A pointer to the new memory.
+void* __re_platformCalloc(const size_t element_count, const size_t element_size);
+
+/// @brief Resize a chunk of memory owned by the platform heap.
+/// @param src A pointer to the original platform heap memory.
+/// @param new_size The number of byte for the new allocation.
+/// @return A pointer to the new memory.
+void* __re_platformRealloc(void* src, const size_t new_size);
+
+/// @brief Free a chunk of memory owned by the platform heap.
+/// @param src A pointer to the platform heap memory.
+void __re_platformFree(void* src);
+
+// *=================================================
+// *
+// * Virtual Memory
+// *
+// *=================================================
+
+/// @brief Get the granularity that virtual memory is committed in.
+/// @return The platform page size in bytes.
+size_t __re_getVirtualPageSize();
+
+/// @brief Reserve a range of address space without backing it with memory.
+/// @param size The number of bytes to reserve (multiple of the page size).
+/// @return A pointer to the start of the range, or NULL if it could not be reserved.
+void* __re_reserveVirtualMemory(const size_t size);
+
+/// @brief Back part of a reserved range with readable and writable memory.
+/// @param src A page-aligned pointer inside a reserved range.
+/// @param size The number of bytes to commit (multiple of the page size).
+/// @return A flag determining if the memory was committed.
+bool __re_commitVirtualMemory(void* src, const size_t size);
+
+/// @brief Return the memory backing part of a reserved range to the platform, keeping the addresses reserved.
+/// @param src A page-aligned pointer inside a reserved range.
+/// @param size The number of bytes to decommit (multiple of the page size).
+void __re_decommitVirtualMemory(void* src, const size_t size);
+
+/// @brief Release a whole reserved range.
+/// @param src The pointer returned by __re_reserveVirtualMemory.
+/// @param size The number of bytes originally reserved.
+void __re_releaseVirtualMemory(void* src, const size_t size);
+
+// *=================================================
+// *
+// * CPU Features
+// *
+// *=================================================
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+    #define __RE_CPU_X86 1
+
+    // ? Lets one function use AVX2 intrinsics in a build that targets baseline
+    // ? x86. Only call such functions once __re_hasAVX2 returned true.
+    #ifdef _MSC_VER
+        #define __RE_TARGET_AVX2
+    #else
+        #define __RE_TARGET_AVX2 __attribute__((target("avx2")))
+    #endif
+
+    /// @brief Check if the CPU and OS support AVX2 (detected once, on the first call).
+    /// @return A flag determining if AVX2 code paths may run.
+    bool __re_hasAVX2();
+#endif
+
+// *=================================================
+// *
+// * Thread Caches
+// *
+// *=================================================
+
+/// @brief Return every block cached by the calling thread to the global depot.
+/// Engine-owned threads call this before they exit.
+void __re_flushThreadMemoryCache();
+
+/// @brief Return the calling thread's cached slots to every pool created with RE_POOL_THREAD_CACHE.
+/// Engine-owned threads call this before they exit, so a reused thread index starts with empty caches.
+void __re_flushThreadPoolCaches();
+
+// *=================================================
+// *
+// * Allocation Tracking
+// *
+// *=================================================
+
+#ifdef RE_MEMORY_TRACKING_ENABLED
+
+/// @brief Get the engine module the calling thread is currently allocating for.
+/// @return The module flag allocations are tagged with.
+uint32_t __re_getMemoryModule();
+
+/// @brief Record a new allocation against some engine module.
+/// @param module The engine module that owns the allocation.
+/// @param size The number of bytes allocated.
+void __re_trackAllocation(const uint32_t module, const size_t size);
+
+/// @brief Record an in-place resize of an allocation owned by some engine module.
+/// @param module The engine module that owns the allocation.
+/// @param old_size The number of bytes before the resize.
+/// @param new_size The number of bytes after the resize.
+void __re_trackResize(const uint32_t module, const size_t old_size, const size_t new_size);
+
+/// @brief Record a freed allocation against some engine module.
+/// @param module The engine module that owned the allocation.
+/// @param size The number of bytes freed.
+void __re_trackFree(const uint32_t module, const size_t size);
+
+#endif
+
+#endif
\ No newline at end of file
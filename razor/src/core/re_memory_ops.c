@@ -0,0 +1,305 @@
+#include <re_core.h>
+
+#include <re_debug.h>
+
+#include "./re_memory.h"
+
+#include <string.h>
+#include <stdatomic.h>
+
+#ifdef __RE_CPU_X86
+    #include <immintrin.h>
+
+    #ifdef _MSC_VER
+        #include <intrin.h>
+    #endif
+#endif
+
+// ? Copies and sets at least this large are assumed not to be read back soon
+// ? (staging uploads, clearing big buffers), so they bypass the cache instead
+// ? of evicting the caller's working set.
+#define __RE_MEMORY_DEFAULT_STREAMING_THRESHOLD (4u * 1024u * 1024u)
+#define __RE_MEMORY_MIN_STREAMING_THRESHOLD 256u
+
+typedef enum __re_MemoryKernel {
+    __RE_MEMORY_KERNEL_UNRESOLVED = -1,
+    __RE_MEMORY_KERNEL_GENERIC,
+    __RE_MEMORY_KERNEL_SSE2,
+    __RE_MEMORY_KERNEL_AVX2
+} __re_MemoryKernel;
+
+static atomic_int __re_memory_kernel = __RE_MEMORY_KERNEL_UNRESOLVED;
+static atomic_size_t __re_streaming_threshold = __RE_MEMORY_DEFAULT_STREAMING_THRESHOLD;
+
+// *=================================================
+// *
+// * __re_detectMemoryKernel
+// *
+// *=================================================
+
+static __re_MemoryKernel __re_detectMemoryKernel() {
+    #if defined(__RE_CPU_X86) && defined(_MSC_VER)
+    int cpu_info[4] = {0};
+
+    __cpuid(cpu_info, 0);
+    const int max_leaf = cpu_info[0];
+
+    __cpuid(cpu_info, 1);
+    const bool has_sse2 = (cpu_info[3] & (1 << 26)) != 0;
+    const bool has_avx = (cpu_info[2] & (1 << 28)) != 0;
+    const bool has_osxsave = (cpu_info[2] & (1 << 27)) != 0;
+
+    bool has_avx2 = false;
+    if (max_leaf >= 7) {
+        __cpuidex(cpu_info, 7, 0);
+        has_avx2 = (cpu_info[1] & (1 << 5)) != 0;
+    }
+
+    // ? The OS must also save the YMM registers across context switches.
+    if (has_avx2 && has_avx && has_osxsave && (_xgetbv(0) & 0x6) == 0x6) {
+        return __RE_MEMORY_KERNEL_AVX2;
+    }
+
+    if (has_sse2) {
+        return __RE_MEMORY_KERNEL_SSE2;
+    }
+    #elif defined(__RE_CPU_X86)
+    __builtin_cpu_init();
+
+    if (__builtin_cpu_supports("avx2")) {
+        return __RE_MEMORY_KERNEL_AVX2;
+    }
+
+    if (__builtin_cpu_supports("sse2")) {
+        return __RE_MEMORY_KERNEL_SSE2;
+    }
+    #endif
+
+    return __RE_MEMORY_KERNEL_GENERIC;
+}
+
+// *=================================================
+// *
+// * __re_getMemoryKernel
+// *
+// *=================================================
+
+static inline __re_MemoryKernel __re_getMemoryKernel() {
+    int kernel = atomic_load_explicit(&__re_memory_kernel, memory_order_relaxed);
+
+    if (kernel == __RE_MEMORY_KERNEL_UNRESOLVED) {
+        kernel = __re_detectMemoryKernel();
+        atomic_store_explicit(&__re_memory_kernel, kernel, memory_order_relaxed);
+    }
+
+    return (__re_MemoryKernel)kernel;
+}
+
+#ifdef __RE_CPU_X86
+
+// *=================================================
+// *
+// * __re_hasAVX2
+// *
+// *=================================================
+
+bool __re_hasAVX2() {
+    return __re_getMemoryKernel() == __RE_MEMORY_KERNEL_AVX2;
+}
+
+// *=================================================
+// *
+// * __re_streamCopySSE2
+// *
+// *=================================================
+
+static void __re_streamCopySSE2(uint8_t* dst, const uint8_t* src, size_t size) {
+    const size_t head = (16u - ((uintptr_t)dst & 15u)) & 15u;
+    memcpy(dst, src, head);
+
+    dst += head;
+    src += head;
+    size -= head;
+
+    for (; size >= 64u; size -= 64u, dst += 64u, src += 64u) {
+        const __m128i v0 = _mm_loadu_si128((const __m128i*)(src));
+        const __m128i v1 = _mm_loadu_si128((const __m128i*)(src + 16u));
+        const __m128i v2 = _mm_loadu_si128((const __m128i*)(src + 32u));
+        const __m128i v3 = _mm_loadu_si128((const __m128i*)(src + 48u));
+
+        _mm_stream_si128((__m128i*)(dst), v0);
+        _mm_stream_si128((__m128i*)(dst + 16u), v1);
+        _mm_stream_si128((__m128i*)(dst + 32u), v2);
+        _mm_stream_si128((__m128i*)(dst + 48u), v3);
+    }
+
+    memcpy(dst, src, size);
+    _mm_sfence();
+}
+
+// *=================================================
+// *
+// * __re_streamSetSSE2
+// *
+// *=================================================
+
+static void __re_streamSetSSE2(uint8_t* dst, const int value, size_t size) {
+    const size_t head = (16u - ((uintptr_t)dst & 15u)) & 15u;
+    memset(dst, value, head);
+
+    dst += head;
+    size -= head;
+
+    const __m128i v = _mm_set1_epi8((char)value);
+
+    for (; size >= 64u; size -= 64u, dst += 64u) {
+        _mm_stream_si128((__m128i*)(dst), v);
+        _mm_stream_si128((__m128i*)(dst + 16u), v);
+        _mm_stream_si128((__m128i*)(dst + 32u), v);
+        _mm_stream_si128((__m128i*)(dst + 48u), v);
+    }
+
+    memset(dst, value, size);
+    _mm_sfence();
+}
+
+// *=================================================
+// *
+// * __re_streamCopyAVX2
+// *
+// *=================================================
+
+__RE_TARGET_AVX2 static void __re_streamCopyAVX2(uint8_t* dst, const uint8_t* src, size_t size) {
+    const size_t head = (32u - ((uintptr_t)dst & 31u)) & 31u;
+    memcpy(dst, src, head);
+
+    dst += head;
+    src += head;
+    size -= head;
+
+    for (; size >= 128u; size -= 128u, dst += 128u, src += 128u) {
+        const __m256i v0 = _mm256_loadu_si256((const __m256i*)(src));
+        const __m256i v1 = _mm256_loadu_si256((const __m256i*)(src + 32u));
+        const __m256i v2 = _mm256_loadu_si256((const __m256i*)(src + 64u));
+        const __m256i v3 = _mm256_loadu_si256((const __m256i*)(src + 96u));
+
+        _mm256_stream_si256((__m256i*)(dst), v0);
+        _mm256_stream_si256((__m256i*)(dst + 32u), v1);
+        _mm256_stream_si256((__m256i*)(dst + 64u), v2);
+        _mm256_stream_si256((__m256i*)(dst + 96u), v3);
+    }
+
+    memcpy(dst, src, size);
+    _mm_sfence();
+}
+
+// *=================================================
+// *
+// * __re_streamSetAVX2
+// *
+// *=================================================
+
+__RE_TARGET_AVX2 static void __re_streamSetAVX2(uint8_t* dst, const int value, size_t size) {
+    const size_t head = (32u - ((uintptr_t)dst & 31u)) & 31u;
+    memset(dst, value, head);
+
+    dst += head;
+    size -= head;
+
+    const __m256i v = _mm256_set1_epi8((char)value);
+
+    for (; size >= 128u; size -= 128u, dst += 128u) {
+        _mm256_stream_si256((__m256i*)(dst), v);
+        _mm256_stream_si256((__m256i*)(dst + 32u), v);
+        _mm256_stream_si256((__m256i*)(dst + 64u), v);
+        _mm256_stream_si256((__m256i*)(dst + 96u), v);
+    }
+
+    memset(dst, value, size);
+    _mm_sfence();
+}
+
+#endif
+
+// *=================================================
+// *
+// * re_memset
+// *
+// *=================================================
+
+void* re_memset(void* src, const int value, const size_t size) {
+    re_assert(src != RE_NULL_HANDLE, "Cannot memset NULL pointer!");
+
+    // ? Below the threshold libc is already vectorized and keeps the data
+    // ? cached, which is what small callers want.
+    if (size < atomic_load_explicit(&__re_streaming_threshold, memory_order_relaxed)) {
+        return memset(src, value, size);
+    }
+
+    switch (__re_getMemoryKernel()) {
+        #ifdef __RE_CPU_X86
+        case __RE_MEMORY_KERNEL_AVX2:
+            __re_streamSetAVX2((uint8_t*)src, value, size);
+            return src;
+        case __RE_MEMORY_KERNEL_SSE2:
+            __re_streamSetSSE2((uint8_t*)src, value, size);
+            return src;
+        #endif
+        default:
+            return memset(src, value, size);
+    }
+}
+
+// *=================================================
+// *
+// * re_memcpy
+// *
+// *=================================================
+
+void* re_memcpy(void* dst, const void* src, const size_t size) {
+    re_assert(src != RE_NULL_HANDLE, "Cannot memcpy from NULL pointer!");
+    re_assert(dst != RE_NULL_HANDLE, "Cannot memcpy to NULL pointer!");
+
+    if (size < atomic_load_explicit(&__re_streaming_threshold, memory_order_relaxed)) {
+        return memcpy(dst, src, size);
+    }
+
+    switch (__re_getMemoryKernel()) {
+        #ifdef __RE_CPU_X86
+        case __RE_MEMORY_KERNEL_AVX2:
+            __re_streamCopyAVX2((uint8_t*)dst, (const uint8_t*)src, size);
+            return dst;
+        case __RE_MEMORY_KERNEL_SSE2:
+            __re_streamCopySSE2((uint8_t*)dst, (const uint8_t*)src, size);
+            return dst;
+        #endif
+        default:
+            return memcpy(dst, src, size);
+    }
+}
+
+// *=================================================
+// *
+// * re_setMemoryStreamingThreshold
+// *
+// *=================================================
+
+void re_setMemoryStreamingThreshold(const size_t threshold) {
+    // ? The kernels align their destination with a short head copy, which
+    // ? needs the size to comfortably exceed one vector.
+    const size_t clamped_threshold = threshold < __RE_MEMORY_MIN_STREAMING_THRESHOLD ?
+        __RE_MEMORY_MIN_STREAMING_THRESHOLD :
+        threshold;
+
+    atomic_store_explicit(&__re_streaming_threshold, clamped_threshold, memory_order_relaxed);
+}
+
+// *=================================================
+// *
+// * re_getMemoryStreamingThreshold
+// *
+// *=================================================
+
+size_t re_getMemoryStreamingThreshold() {
+    return atomic_load_explicit(&__re_streaming_threshold, memory_order_relaxed);
+}
\ No newline at end of file
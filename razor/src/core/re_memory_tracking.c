@@ -0,0 +1,224 @@
+#include <re_core.h>
+
+#include <re_debug.h>
+#include "./re_memory.h"
+#include "./re_threads.h"
+#include "../re_internals.h"
+
+#ifdef RE_MEMORY_TRACKING_ENABLED
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+// ? Every counter is a relaxed atomic, so tracking never takes a lock. Each
+// ? category sits on its own cache lines to keep modules from false sharing.
+typedef struct __re_MemoryCategoryStats {
+    _Alignas(RE_CACHE_LINE_SIZE) atomic_uint_fast64_t live_bytes;
+    atomic_uint_fast64_t peak_bytes;
+
+    atomic_uint_fast64_t total_allocations;
+    atomic_uint_fast64_t total_frees;
+
+    atomic_uint_fast64_t size_histogram[RE_MEMORY_HISTOGRAM_BUCKET_COUNT];
+} __re_MemoryCategoryStats;
+
+static __re_MemoryCategoryStats __re_memory_stats[RE_MEMORY_CATEGORY_COUNT];
+static RE_THREAD_LOCAL uint32_t __re_memory_module = 0u;
+
+static const char* const __RE_MEMORY_CATEGORY_NAMES[RE_MEMORY_CATEGORY_COUNT] = {
+    "Application",
+    "Core",
+    "Debug",
+    "Graphics"
+};
+
+// *=================================================
+// *
+// * __re_getLog2
+// *
+// *=================================================
+
+static inline uint32_t __re_getLog2(const uint64_t value) {
+    #ifdef _MSC_VER
+    unsigned long msb = 0;
+    _BitScanReverse64(&msb, value);
+    return (uint32_t)msb;
+    #else
+    return 63u - (uint32_t)__builtin_clzll(value);
+    #endif
+}
+
+// *=================================================
+// *
+// * __re_getMemoryCategoryStats
+// *
+// *=================================================
+
+static inline __re_MemoryCategoryStats* __re_getMemoryCategoryStats(const uint32_t module) {
+    // ? Module bits map onto categories by bit index; untagged allocations
+    // ? (and RE_ALL_MODULES) count as application memory.
+    if (module == 0u) {
+        return &__re_memory_stats[RE_MEMORY_CATEGORY_APPLICATION];
+    }
+
+    const uint32_t category = __re_getLog2(module);
+    re_assert(category < RE_MEMORY_CATEGORY_COUNT, "Unknown memory module tag: %u", module);
+
+    return &__re_memory_stats[category];
+}
+
+// *=================================================
+// *
+// * __re_addLiveBytes
+// *
+// *=================================================
+
+static inline void __re_addLiveBytes(__re_MemoryCategoryStats* stats, const uint64_t size) {
+    const uint64_t live_bytes = atomic_fetch_add_explicit(&stats->live_bytes, size, memory_order_relaxed) + size;
+
+    uint64_t peak_bytes = atomic_load_explicit(&stats->peak_bytes, memory_order_relaxed);
+    while (live_bytes > peak_bytes) {
+        if (atomic_compare_exchange_weak_explicit(
+            &stats->peak_bytes,
+            &peak_bytes,
+            live_bytes,
+            memory_order_relaxed,
+            memory_order_relaxed
+        )) {
+            break;
+        }
+    }
+}
+
+// *=================================================
+// *
+// * __re_setMemoryModule
+// *
+// *=================================================
+
+re_EngineModuleFlag __re_setMemoryModule(const re_EngineModuleFlag module) {
+    const re_EngineModuleFlag prev_module = __re_memory_module;
+    __re_memory_module = module;
+
+    return prev_module;
+}
+
+// *=================================================
+// *
+// * __re_getMemoryModule
+// *
+// *=================================================
+
+uint32_t __re_getMemoryModule() {
+    return __re_memory_module;
+}
+
+// *=================================================
+// *
+// * __re_trackAllocation
+// *
+// *=================================================
+
+void __re_trackAllocation(const uint32_t module, const size_t size) {
+    __re_MemoryCategoryStats* stats = __re_getMemoryCategoryStats(module);
+
+    uint32_t bucket = __re_getLog2((uint64_t)size);
+    if (bucket >= RE_MEMORY_HISTOGRAM_BUCKET_COUNT) {
+        bucket = RE_MEMORY_HISTOGRAM_BUCKET_COUNT - 1u;
+    }
+
+    atomic_fetch_add_explicit(&stats->total_allocations, 1u, memory_order_relaxed);
+    atomic_fetch_add_explicit(&stats->size_histogram[bucket], 1u, memory_order_relaxed);
+
+    __re_addLiveBytes(stats, (uint64_t)size);
+}
+
+// *=================================================
+// *
+// * __re_trackResize
+// *
+// *=================================================
+
+void __re_trackResize(const uint32_t module, const size_t old_size, const size_t new_size) {
+    __re_MemoryCategoryStats* stats = __re_getMemoryCategoryStats(module);
+
+    if (new_size >= old_size) {
+        __re_addLiveBytes(stats, (uint64_t)(new_size - old_size));
+    }
+    else {
+        atomic_fetch_sub_explicit(&stats->live_bytes, (uint64_t)(old_size - new_size), memory_order_relaxed);
+    }
+}
+
+// *=================================================
+// *
+// * __re_trackFree
+// *
+// *=================================================
+
+void __re_trackFree(const uint32_t module, const size_t size) {
+    __re_MemoryCategoryStats* stats = __re_getMemoryCategoryStats(module);
+
+    atomic_fetch_add_explicit(&stats->total_frees, 1u, memory_order_relaxed);
+    atomic_fetch_sub_explicit(&stats->live_bytes, (uint64_t)size, memory_order_relaxed);
+}
+
+#endif
+
+// *=================================================
+// *
+// * re_getMemoryStats
+// *
+// *=================================================
+
+bool re_getMemoryStats(const re_MemoryCategory category, re_MemoryStats* stats) {
+    re_assert(category < RE_MEMORY_CATEGORY_COUNT, "Unknown memory category: %d", category);
+    re_assert(stats != RE_NULL_HANDLE, "Attempting to query memory stats into NULL pointer!");
+
+    #ifdef RE_MEMORY_TRACKING_ENABLED
+    __re_MemoryCategoryStats* category_stats = &__re_memory_stats[category];
+
+    stats->live_bytes = atomic_load_explicit(&category_stats->live_bytes, memory_order_relaxed);
+    stats->peak_bytes = atomic_load_explicit(&category_stats->peak_bytes, memory_order_relaxed);
+    stats->total_allocations = atomic_load_explicit(&category_stats->total_allocations, memory_order_relaxed);
+    stats->total_frees = atomic_load_explicit(&category_stats->total_frees, memory_order_relaxed);
+    stats->live_allocations = stats->total_allocations - stats->total_frees;
+
+    for (uint32_t idx = 0; idx < RE_MEMORY_HISTOGRAM_BUCKET_COUNT; ++idx) {
+        stats->size_histogram[idx] = atomic_load_explicit(&category_stats->size_histogram[idx], memory_order_relaxed);
+    }
+
+    return true;
+    #else
+    re_memset(stats, 0, sizeof(re_MemoryStats));
+    return false;
+    #endif
+}
+
+// *=================================================
+// *
+// * re_logMemoryLeaks
+// *
+// *=================================================
+
+void re_logMemoryLeaks() {
+    #ifdef RE_MEMORY_TRACKING_ENABLED
+    for (uint32_t category = 0; category < RE_MEMORY_CATEGORY_COUNT; ++category) {
+        re_MemoryStats stats;
+        re_getMemoryStats((re_MemoryCategory)category, &stats);
+
+        if (stats.live_allocations == 0) {
+            continue;
+        }
+
+        re_logWarn(
+            "%s memory still live: %llu bytes in %llu allocations (peak: %llu bytes)",
+            __RE_MEMORY_CATEGORY_NAMES[category],
+            (unsigned long long)stats.live_bytes,
+            (unsigned long long)stats.live_allocations,
+            (unsigned long long)stats.peak_bytes
+        );
+    }
+    #endif
+}
\ No newline at end of file
@@ -0,0 +1,394 @@
+#include <re_core.h>
+
+#include <re_debug.h>
+#include "./re_memory.h"
+#include "./re_threads.h"
+
+#define RE_POOL_MAX_THREAD_CACHES 16u
+
+// ? Thread caches refill from and spill back to the shared free list in
+// ? batches, so the lock is taken once per batch instead of once per slot.
+#define __RE_POOL_CACHE_BATCH 32u
+#define __RE_POOL_CACHE_LIMIT (__RE_POOL_CACHE_BATCH * 2u)
+
+typedef struct __re_PoolSlot {
+    struct __re_PoolSlot* next;
+} __re_PoolSlot;
+
+typedef struct __re_PoolBlock {
+    struct __re_PoolBlock* next;
+} __re_PoolBlock;
+
+typedef struct __re_PoolThreadCache {
+    _Alignas(RE_CACHE_LINE_SIZE) __re_PoolSlot* head;
+    uint32_t count;
+} __re_PoolThreadCache;
+
+typedef struct re_Pool_T {
+    size_t slot_size;
+    size_t slot_stride;
+    uint32_t slots_per_block;
+    re_PoolFlag flags;
+
+    re_SpinLock lock;
+    __re_PoolBlock* blocks;
+    __re_PoolSlot* free_list;
+
+    __re_PoolThreadCache thread_caches[RE_POOL_MAX_THREAD_CACHES];
+
+    // ? Pools with thread caches are linked together so that an exiting
+    // ? thread can hand its cached slots back to every one of them.
+    struct re_Pool_T* prev_cached;
+    struct re_Pool_T* next_cached;
+} re_Pool_T;
+
+static re_Pool __re_cached_pools = RE_NULL_HANDLE;
+static re_SpinLock __re_cached_pools_lock = RE_SPIN_LOCK_INIT;
+
+// *=================================================
+// *
+// * __re_growPool
+// *
+// *=================================================
+
+static bool __re_growPool(re_Pool pool) {
+    const size_t block_size = RE_CACHE_LINE_SIZE + pool->slot_stride * pool->slots_per_block;
+    uint8_t* block_data = (uint8_t*)re_mallocAlign(block_size, RE_CACHE_LINE_SIZE);
+
+    if (block_data == RE_NULL_HANDLE) {
+        return false;
+    }
+
+    __re_PoolBlock* block = (__re_PoolBlock*)block_data;
+    block->next = pool->blocks;
+    pool->blocks = block;
+
+    // ? Thread the new slots in reverse so they are handed out in address order.
+    uint8_t* slots = block_data + RE_CACHE_LINE_SIZE;
+    for (uint32_t idx = pool->slots_per_block; idx > 0; --idx) {
+        __re_PoolSlot* slot = (__re_PoolSlot*)(slots + (idx - 1) * pool->slot_stride);
+        slot->next = pool->free_list;
+        pool->free_list = slot;
+    }
+
+    return true;
+}
+
+// *=================================================
+// *
+// * __re_takePoolSlots
+// *
+// *=================================================
+
+static __re_PoolSlot* __re_takePoolSlots(re_Pool pool, const uint32_t max_count, uint32_t* taken_count) {
+    __re_lockSpinLock(&pool->lock);
+
+    if (pool->free_list == RE_NULL_HANDLE && !__re_growPool(pool)) {
+        __re_unlockSpinLock(&pool->lock);
+        *taken_count = 0;
+        return RE_NULL_HANDLE;
+    }
+
+    __re_PoolSlot* head = pool->free_list;
+    __re_PoolSlot* tail = head;
+
+    uint32_t count = 1;
+    while (count < max_count && tail->next != RE_NULL_HANDLE) {
+        tail = tail->next;
+        ++count;
+    }
+
+    pool->free_list = tail->next;
+    tail->next = RE_NULL_HANDLE;
+
+    __re_unlockSpinLock(&pool->lock);
+
+    *taken_count = count;
+    return head;
+}
+
+// *=================================================
+// *
+// * __re_returnPoolSlots
+// *
+// *=================================================
+
+static void __re_returnPoolSlots(re_Pool pool, __re_PoolSlot* head, __re_PoolSlot* tail) {
+    __re_lockSpinLock(&pool->lock);
+
+    tail->next = pool->free_list;
+    pool->free_list = head;
+
+    __re_unlockSpinLock(&pool->lock);
+}
+
+// *=================================================
+// *
+// * __re_getPoolThreadCache
+// *
+// *=================================================
+
+static __re_PoolThreadCache* __re_getPoolThreadCache(re_Pool pool) {
+    if ((pool->flags & RE_POOL_THREAD_CACHE) == 0) {
+        return RE_NULL_HANDLE;
+    }
+
+    // ? Threads past the cache count share the locked free list.
+    const uint32_t thread_index = __re_getThreadIndex();
+
+    if (thread_index >= RE_POOL_MAX_THREAD_CACHES) {
+        return RE_NULL_HANDLE;
+    }
+
+    return &pool->thread_caches[thread_index];
+}
+
+// *=================================================
+// *
+// * __re_flushThreadPoolCaches
+// *
+// *=================================================
+
+void __re_flushThreadPoolCaches() {
+    const uint32_t thread_index = __re_getThreadIndex();
+
+    if (thread_index >= RE_POOL_MAX_THREAD_CACHES) {
+        return;
+    }
+
+    // ? Holding the list lock keeps every pool alive until its slots are back.
+    __re_lockSpinLock(&__re_cached_pools_lock);
+
+    for (re_Pool pool = __re_cached_pools; pool != RE_NULL_HANDLE; pool = pool->next_cached) {
+        __re_PoolThreadCache* cache = &pool->thread_caches[thread_index];
+
+        if (cache->head == RE_NULL_HANDLE) {
+            continue;
+        }
+
+        __re_PoolSlot* tail = cache->head;
+        while (tail->next != RE_NULL_HANDLE) {
+            tail = tail->next;
+        }
+
+        __re_returnPoolSlots(pool, cache->head, tail);
+
+        cache->head = RE_NULL_HANDLE;
+        cache->count = 0;
+    }
+
+    __re_unlockSpinLock(&__re_cached_pools_lock);
+}
+
+// *=================================================
+// *
+// * re_createPool
+// *
+// *=================================================
+
+re_Pool re_createPool(const re_PoolCreateInfo* create_info) {
+    re_assert(create_info != RE_NULL_HANDLE, "Attempting to create pool with NULL create info!");
+    re_assert(create_info->slot_size > 0, "Cannot create a pool of 0 byte slots!");
+    re_assert(create_info->slots_per_block > 0, "Cannot create a pool with 0 slots per block!");
+
+    re_Pool pool = (re_Pool)re_callocAlign(1, sizeof(re_Pool_T), RE_CACHE_LINE_SIZE);
+
+    const size_t slot_size = create_info->slot_size > sizeof(__re_PoolSlot) ? create_info->slot_size : sizeof(__re_PoolSlot);
+
+    pool->slot_size = create_info->slot_size;
+    pool->slot_stride = (slot_size + RE_CACHE_LINE_SIZE - 1) & ~((size_t)RE_CACHE_LINE_SIZE - 1);
+    pool->slots_per_block = create_info->slots_per_block;
+    pool->flags = create_info->flags;
+
+    atomic_flag_clear(&pool->lock);
+
+    if (pool->flags & RE_POOL_THREAD_CACHE) {
+        __re_lockSpinLock(&__re_cached_pools_lock);
+
+        pool->next_cached = __re_cached_pools;
+        if (__re_cached_pools != RE_NULL_HANDLE) {
+            __re_cached_pools->prev_cached = pool;
+        }
+        __re_cached_pools = pool;
+
+        __re_unlockSpinLock(&__re_cached_pools_lock);
+    }
+
+    return pool;
+}
+
+// *=================================================
+// *
+// * re_destroyPool
+// *
+// *=================================================
+
+void re_destroyPool(re_Pool* pool) {
+    re_assert(pool != RE_NULL_HANDLE, "Attempting to destroy NULL pool!");
+
+    re_Pool pool_data = *pool;
+    re_assert(pool_data != RE_NULL_HANDLE, "Attempting to destroy NULL pool!");
+
+    if (pool_data->flags & RE_POOL_THREAD_CACHE) {
+        __re_lockSpinLock(&__re_cached_pools_lock);
+
+        if (pool_data->prev_cached != RE_NULL_HANDLE) {
+            pool_data->prev_cached->next_cached = pool_data->next_cached;
+        }
+        else {
+            __re_cached_pools = pool_data->next_cached;
+        }
+
+        if (pool_data->next_cached != RE_NULL_HANDLE) {
+            pool_data->next_cached->prev_cached = pool_data->prev_cached;
+        }
+
+        __re_unlockSpinLock(&__re_cached_pools_lock);
+    }
+
+    __re_PoolBlock* block = pool_data->blocks;
+    while (block != RE_NULL_HANDLE) {
+        __re_PoolBlock* next_block = block->next;
+        re_freeAlign(block);
+        block = next_block;
+    }
+
+    re_freeAlign(pool_data);
+    *pool = RE_NULL_HANDLE;
+}
+
+// *=================================================
+// *
+// * re_poolAlloc
+// *
+// *=================================================
+
+void* re_poolAlloc(re_Pool pool) {
+    re_assert(pool != RE_NULL_HANDLE, "Attempting to allocate from NULL pool!");
+
+    __re_PoolThreadCache* cache = __re_getPoolThreadCache(pool);
+
+    if (cache == RE_NULL_HANDLE) {
+        uint32_t taken_count = 0;
+        return __re_takePoolSlots(pool, 1, &taken_count);
+    }
+
+    if (cache->head == RE_NULL_HANDLE) {
+        cache->head = __re_takePoolSlots(pool, __RE_POOL_CACHE_BATCH, &cache->count);
+
+        if (cache->head == RE_NULL_HANDLE) {
+            return RE_NULL_HANDLE;
+        }
+    }
+
+    __re_PoolSlot* slot = cache->head;
+    cache->head = slot->next;
+    --cache->count;
+
+    return slot;
+}
+
+// *=================================================
+// *
+// * re_poolCalloc
+// *
+// *=================================================
+
+void* re_poolCalloc(re_Pool pool) {
+    void* ptr = re_poolAlloc(pool);
+
+    if (ptr == RE_NULL_HANDLE) {
+        return RE_NULL_HANDLE;
+    }
+
+    return re_memset(ptr, 0, pool->slot_size);
+}
+
+// *=================================================
+// *
+// * re_poolFree
+// *
+// *=================================================
+
+void re_poolFree(re_Pool pool, void* src) {
+    re_assert(pool != RE_NULL_HANDLE, "Attempting to free into NULL pool!");
+    re_assert(src != RE_NULL_HANDLE, "Cannot free NULL pointer!");
+
+    __re_PoolSlot* slot = (__re_PoolSlot*)src;
+    __re_PoolThreadCache* cache = __re_getPoolThreadCache(pool);
+
+    if (cache == RE_NULL_HANDLE) {
+        __re_returnPoolSlots(pool, slot, slot);
+        return;
+    }
+
+    slot->next = cache->head;
+    cache->head = slot;
+    ++cache->count;
+
+    if (cache->count < __RE_POOL_CACHE_LIMIT) {
+        return;
+    }
+
+    // ? Spill the oldest half of the cache back to the shared free list.
+    __re_PoolSlot* tail = cache->head;
+    for (uint32_t idx = 1; idx < __RE_POOL_CACHE_BATCH; ++idx) {
+        tail = tail->next;
+    }
+
+    __re_PoolSlot* spilled = tail->next;
+    __re_PoolSlot* spilled_tail = spilled;
+    while (spilled_tail->next != RE_NULL_HANDLE) {
+        spilled_tail = spilled_tail->next;
+    }
+
+    tail->next = RE_NULL_HANDLE;
+    cache->count = __RE_POOL_CACHE_BATCH;
+
+    __re_returnPoolSlots(pool, spilled, spilled_tail);
+}
+
+// *=================================================
+// *
+// * __re_poolAllocatorAlloc
+// *
+// *=================================================
+
+static void* __re_poolAllocatorAlloc(void* user_data, const size_t size, const size_t alignment) {
+    re_Pool pool = (re_Pool)user_data;
+
+    // ? Like the arena allocator, a request the pool can't serve fails with
+    // ? NULL, which the containers already handle.
+    if (size > pool->slot_size || alignment > RE_CACHE_LINE_SIZE) {
+        return RE_NULL_HANDLE;
+    }
+
+    return re_poolAlloc(pool);
+}
+
+// *=================================================
+// *
+// * __re_poolAllocatorFree
+// *
+// *=================================================
+
+static void __re_poolAllocatorFree(void* user_data, void* src) {
+    re_poolFree((re_Pool)user_data, src);
+}
+
+// *=================================================
+// *
+// * re_getPoolAllocator
+// *
+// *=================================================
+
+re_Allocator re_getPoolAllocator(re_Pool pool) {
+    re_assert(pool != RE_NULL_HANDLE, "Attempting to get allocator of NULL pool!");
+
+    re_Allocator allocator = {0};
+    allocator.alloc = __re_poolAllocatorAlloc;
+    allocator.free = __re_poolAllocatorFree;
+    allocator.user_data = pool;
+
+    return allocator;
+}
\ No newline at end of file
@@ -0,0 +1,88 @@
+#include "./re_threads.h"
+
+#include "./re_memory.h"
+#include "../re_internals.h"
+
+// ? Indices given back by exited engine threads. Past this many waiting to
+// ? be reused, an exiting thread's index is simply retired.
+#define __RE_MAX_FREE_THREAD_INDICES 256u
+
+static atomic_uint __re_next_thread_index = 0;
+static RE_THREAD_LOCAL uint32_t __re_thread_index = UINT32_MAX;
+
+static re_SpinLock __re_free_thread_index_lock = RE_SPIN_LOCK_INIT;
+static uint32_t __re_free_thread_indices[__RE_MAX_FREE_THREAD_INDICES];
+static uint32_t __re_free_thread_index_count = 0u;
+
+// *=================================================
+// *
+// * __re_getThreadIndex
+// *
+// *=================================================
+
+uint32_t __re_getThreadIndex() {
+    if (__re_thread_index != UINT32_MAX) {
+        return __re_thread_index;
+    }
+
+    // ? Reusing the lowest free index keeps indices dense, so per-thread
+    // ? tables sized by index stay covered as threads come and go.
+    __re_lockSpinLock(&__re_free_thread_index_lock);
+
+    uint32_t lowest_idx = UINT32_MAX;
+    for (uint32_t idx = 0; idx < __re_free_thread_index_count; ++idx) {
+        if (lowest_idx == UINT32_MAX || __re_free_thread_indices[idx] < __re_free_thread_indices[lowest_idx]) {
+            lowest_idx = idx;
+        }
+    }
+
+    if (lowest_idx != UINT32_MAX) {
+        __re_thread_index = __re_free_thread_indices[lowest_idx];
+        __re_free_thread_indices[lowest_idx] = __re_free_thread_indices[--__re_free_thread_index_count];
+    }
+
+    __re_unlockSpinLock(&__re_free_thread_index_lock);
+
+    if (__re_thread_index == UINT32_MAX) {
+        __re_thread_index = atomic_fetch_add_explicit(&__re_next_thread_index, 1u, memory_order_relaxed);
+    }
+
+    return __re_thread_index;
+}
+
+// *=================================================
+// *
+// * __re_releaseThreadIndex
+// *
+// *=================================================
+
+static void __re_releaseThreadIndex() {
+    if (__re_thread_index == UINT32_MAX) {
+        return;
+    }
+
+    __re_lockSpinLock(&__re_free_thread_index_lock);
+
+    if (__re_free_thread_index_count < __RE_MAX_FREE_THREAD_INDICES) {
+        __re_free_thread_indices[__re_free_thread_index_count++] = __re_thread_index;
+    }
+
+    __re_unlockSpinLock(&__re_free_thread_index_lock);
+
+    __re_thread_index = UINT32_MAX;
+}
+
+// *=================================================
+// *
+// * __re_exitThread
+// *
+// *=================================================
+
+void __re_exitThread() {
+    __re_releaseScratchArena();
+    __re_flushThreadPoolCaches();
+    __re_flushThreadMemoryCache();
+
+    // ? Last, since everything above may still record under the index.
+    __re_releaseThreadIndex();
+}
\ No newline at end of file
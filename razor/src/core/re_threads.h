@@ -0,0 +1,168 @@
+#ifndef __RAZOR_CORE_THREADS_HEADER_FILE
+#define __RAZOR_CORE_THREADS_HEADER_FILE
+
+#include <re_core.h>
+#include <stdatomic.h>
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+    #include <immintrin.h>
+    #define __re_cpuRelax() _mm_pause()
+#elif defined(_M_ARM64)
+    #include <intrin.h>
+    #define __re_cpuRelax() __yield()
+#elif defined(__aarch64__) || defined(__arm__)
+    #define __re_cpuRelax() __asm__ __volatile__("yield")
+#else
+    #define __re_cpuRelax() ((void)(0))
+#endif
+
+#ifdef _MSC_VER
+    #define RE_THREAD_LOCAL __declspec(thread)
+#else
+    #define RE_THREAD_LOCAL _Thread_local
+#endif
+
+#define RE_CACHE_LINE_SIZE 64u
+
+// *=================================================
+// *
+// * Spin Locks
+// *
+// *=================================================
+
+typedef atomic_flag re_SpinLock;
+
+#define RE_SPIN_LOCK_INIT ATOMIC_FLAG_INIT
+
+/// @brief Acquire a spin lock, busy-waiting until it is free.
+/// @param lock The spin lock to acquire.
+static inline void __re_lockSpinLock(re_SpinLock* lock) {
+    while (atomic_flag_test_and_set_explicit(lock, memory_order_acquire)) {
+        __re_cpuRelax();
+    }
+}
+
+/// @brief Release a previously acquired spin lock.
+/// @param lock The spin lock to release.
+static inline void __re_unlockSpinLock(re_SpinLock* lock) {
+    atomic_flag_clear_explicit(lock, memory_order_release);
+}
+
+// *=================================================
+// *
+// * Once Flags
+// *
+// *=================================================
+
+typedef atomic_int re_OnceFlag;
+
+#define RE_ONCE_INIT 0
+
+#define __RE_ONCE_PENDING 0
+#define __RE_ONCE_RUNNING 1
+#define __RE_ONCE_DONE 2
+
+typedef void (*re_OnceFn)();
+
+/// @brief Run a function exactly once across every thread sharing the flag. Threads that
+/// lose the race wait until the winner's call has returned.
+/// @param flag The flag guarding the function (initialized with RE_ONCE_INIT).
+/// @param once_fn The function to run.
+static inline void __re_callOnce(re_OnceFlag* flag, const re_OnceFn once_fn) {
+    if (atomic_load_explicit(flag, memory_order_acquire) == __RE_ONCE_DONE) {
+        return;
+    }
+
+    int expected = __RE_ONCE_PENDING;
+    if (atomic_compare_exchange_strong_explicit(flag, &expected, __RE_ONCE_RUNNING, memory_order_acquire, memory_order_acquire)) {
+        once_fn();
+        atomic_store_explicit(flag, __RE_ONCE_DONE, memory_order_release);
+
+        return;
+    }
+
+    while (atomic_load_explicit(flag, memory_order_acquire) != __RE_ONCE_DONE) {
+        __re_cpuRelax();
+    }
+}
+
+// *=================================================
+// *
+// * Thread Identification
+// *
+// *=================================================
+
+/// @brief Get the calling thread's engine index. Indices are handed out on first
+/// use; an exited engine thread's index goes to the next thread that asks.
+/// @return The calling thread's engine index.
+uint32_t __re_getThreadIndex();
+
+// *=================================================
+// *
+// * Threads
+// *
+// *=================================================
+
+typedef struct re_Thread_T re_Thread_T;
+typedef re_Thread_T* re_Thread;
+
+typedef void (*re_ThreadFn)(void* user_data);
+
+/// @brief Start a new engine-owned thread.
+/// @param thread_fn The function the thread runs.
+/// @param user_data The pointer passed to thread_fn.
+/// @return A handle to the new thread.
+re_Thread __re_createThread(const re_ThreadFn thread_fn, void* user_data);
+
+/// @brief Release the calling thread's per-thread engine state (scratch arena, memory
+/// caches, thread index). Engine-owned threads call this as they exit.
+void __re_exitThread();
+
+/// @brief Wait for a thread to finish and release its handle.
+/// @param thread A pointer to the thread to join.
+void __re_joinThread(re_Thread* thread);
+
+/// @brief Give up the rest of the calling thread's time slice.
+void __re_yieldThread();
+
+/// @brief Put the calling thread to sleep.
+/// @param milliseconds The minimum time to sleep for.
+void __re_sleepThread(const uint32_t milliseconds);
+
+/// @brief Get the number of logical CPU cores the process may run on.
+/// @return The core count (at least 1).
+uint32_t __re_getCpuCoreCount();
+
+/// @brief Pin the calling thread to one logical CPU core.
+/// @param core_idx The core's index among the cores the process may run on (wraps around past the core count).
+/// @return A flag determining if the thread was pinned.
+bool __re_pinCurrentThread(const uint32_t core_idx);
+
+// *=================================================
+// *
+// * Semaphores
+// *
+// *=================================================
+
+typedef struct re_Semaphore_T re_Semaphore_T;
+typedef re_Semaphore_T* re_Semaphore;
+
+/// @brief Create a counting semaphore with a count of 0.
+/// @return A handle to the new semaphore.
+re_Semaphore __re_createSemaphore();
+
+/// @brief Destroy a semaphore.
+/// @param semaphore A pointer to the semaphore to destroy.
+void __re_destroySemaphore(re_Semaphore* semaphore);
+
+/// @brief Increment a semaphore's count, waking one waiter.
+/// @param semaphore The semaphore to signal.
+void __re_signalSemaphore(re_Semaphore semaphore);
+
+/// @brief Wait for a semaphore's count to become positive, then decrement it.
+/// @param semaphore The semaphore to wait on.
+/// @param timeout_ms The longest time to wait for.
+/// @return A flag determining if the semaphore was signaled (false on timeout).
+bool __re_waitSemaphore(re_Semaphore semaphore, const uint32_t timeout_ms);
+
+#endif
\ No newline at end of file
@@ -0,0 +1,20 @@
+#ifndef __RAZOR_CORE_TIME_HEADER_FILE
+#define __RAZOR_CORE_TIME_HEADER_FILE
+
+#include <re_core.h>
+
+// *=================================================
+// *
+// * Monotonic Clock
+// *
+// *=================================================
+
+/// @brief Read the platform's high-resolution monotonic clock.
+/// @return The time in nanoseconds since some arbitrary, fixed point.
+uint64_t __re_getMonotonicNs();
+
+/// @brief Read the platform's wall clock.
+/// @return The time in nanoseconds since the Unix epoch.
+uint64_t __re_getRealtimeNs();
+
+#endif
\ No newline at end of file
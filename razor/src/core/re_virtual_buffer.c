@@ -0,0 +1,178 @@
+#include <re_core.h>
+
+#include <re_debug.h>
+#include "./re_memory.h"
+
+// ? Commits are rounded up to this step so that steady small growth does not
+// ? turn into one system call per page.
+#define __RE_VIRTUAL_BUFFER_COMMIT_STEP (64u * 1024u)
+
+typedef struct re_VirtualBuffer_T {
+    uint8_t* data;
+    size_t size;
+    size_t committed_size;
+    size_t reserved_size;
+} re_VirtualBuffer_T;
+
+// *=================================================
+// *
+// * __re_alignVirtualSize
+// *
+// *=================================================
+
+static inline size_t __re_alignVirtualSize(const size_t size, const size_t alignment) {
+    return (size + alignment - 1) & ~(alignment - 1);
+}
+
+// *=================================================
+// *
+// * re_createVirtualBuffer
+// *
+// *=================================================
+
+re_VirtualBuffer re_createVirtualBuffer(const size_t max_size) {
+    re_assert(max_size > 0, "Cannot create a virtual buffer with a capacity of 0 bytes!");
+
+    const size_t reserved_size = __re_alignVirtualSize(max_size, __re_getVirtualPageSize());
+
+    uint8_t* data = (uint8_t*)__re_reserveVirtualMemory(reserved_size);
+    re_assert(data != RE_NULL_HANDLE, "Failed to reserve %zu bytes of address space for virtual buffer!", reserved_size);
+
+    re_VirtualBuffer buffer = (re_VirtualBuffer)re_malloc(sizeof(re_VirtualBuffer_T));
+    buffer->data = data;
+    buffer->size = 0;
+    buffer->committed_size = 0;
+    buffer->reserved_size = reserved_size;
+
+    return buffer;
+}
+
+// *=================================================
+// *
+// * re_destroyVirtualBuffer
+// *
+// *=================================================
+
+void re_destroyVirtualBuffer(re_VirtualBuffer* buffer) {
+    re_assert(buffer != RE_NULL_HANDLE, "Attempting to destroy NULL virtual buffer!");
+
+    re_VirtualBuffer buffer_data = *buffer;
+    re_assert(buffer_data != RE_NULL_HANDLE, "Attempting to destroy NULL virtual buffer!");
+
+    __re_releaseVirtualMemory(buffer_data->data, buffer_data->reserved_size);
+
+    re_free(buffer_data);
+    *buffer = RE_NULL_HANDLE;
+}
+
+// *=================================================
+// *
+// * re_getVirtualBufferData
+// *
+// *=================================================
+
+void* re_getVirtualBufferData(const re_VirtualBuffer buffer) {
+    re_assert(buffer != RE_NULL_HANDLE, "Attempting to get data of NULL virtual buffer!");
+
+    return buffer->data;
+}
+
+// *=================================================
+// *
+// * re_getVirtualBufferSize
+// *
+// *=================================================
+
+size_t re_getVirtualBufferSize(const re_VirtualBuffer buffer) {
+    re_assert(buffer != RE_NULL_HANDLE, "Attempting to get size of NULL virtual buffer!");
+
+    return buffer->size;
+}
+
+// *=================================================
+// *
+// * re_getVirtualBufferCapacity
+// *
+// *=================================================
+
+size_t re_getVirtualBufferCapacity(const re_VirtualBuffer buffer) {
+    re_assert(buffer != RE_NULL_HANDLE, "Attempting to get capacity of NULL virtual buffer!");
+
+    return buffer->reserved_size;
+}
+
+// *=================================================
+// *
+// * re_resizeVirtualBuffer
+// *
+// *=================================================
+
+bool re_resizeVirtualBuffer(re_VirtualBuffer buffer, const size_t size) {
+    re_assert(buffer != RE_NULL_HANDLE, "Attempting to resize NULL virtual buffer!");
+
+    if (size > buffer->reserved_size) {
+        re_logError("Virtual buffer cannot grow past its reserved size! Requested: %zu; Capacity: %zu", size, buffer->reserved_size);
+        return false;
+    }
+
+    if (size > buffer->committed_size) {
+        size_t committed_size = __re_alignVirtualSize(size, __RE_VIRTUAL_BUFFER_COMMIT_STEP);
+
+        if (committed_size > buffer->reserved_size) {
+            committed_size = buffer->reserved_size;
+        }
+
+        const bool committed = __re_commitVirtualMemory(
+            buffer->data + buffer->committed_size,
+            committed_size - buffer->committed_size
+        );
+
+        if (!committed) {
+            re_logError("Failed to commit %zu bytes for virtual buffer!", committed_size - buffer->committed_size);
+            return false;
+        }
+
+        buffer->committed_size = committed_size;
+    }
+
+    buffer->size = size;
+
+    return true;
+}
+
+// *=================================================
+// *
+// * re_virtualBufferPush
+// *
+// *=================================================
+
+void* re_virtualBufferPush(re_VirtualBuffer buffer, const size_t size) {
+    re_assert(buffer != RE_NULL_HANDLE, "Attempting to push onto NULL virtual buffer!");
+
+    const size_t offset = buffer->size;
+
+    if (size > buffer->reserved_size - offset || !re_resizeVirtualBuffer(buffer, offset + size)) {
+        return RE_NULL_HANDLE;
+    }
+
+    return buffer->data + offset;
+}
+
+// *=================================================
+// *
+// * re_trimVirtualBuffer
+// *
+// *=================================================
+
+void re_trimVirtualBuffer(re_VirtualBuffer buffer) {
+    re_assert(buffer != RE_NULL_HANDLE, "Attempting to trim NULL virtual buffer!");
+
+    const size_t committed_size = __re_alignVirtualSize(buffer->size, __re_getVirtualPageSize());
+
+    if (committed_size >= buffer->committed_size) {
+        return;
+    }
+
+    __re_decommitVirtualMemory(buffer->data + committed_size, buffer->committed_size - committed_size);
+    buffer->committed_size = committed_size;
+}
\ No newline at end of file
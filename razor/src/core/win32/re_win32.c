@@ -1,11 +1,47 @@
+#include <re_core.h>
+
 #if RE_PLATFORM == RE_PLATFORM_WINDOWS
 
 #include <re_debug.h>
 #include "./re_win32.h"
+#include "../re_files.h"
+
+#include <stdio.h>
 
 HANDLE process_heap = RE_NULL_HANDLE;
 HINSTANCE h_instance = RE_NULL_HANDLE;
 
+// *=================================================
+// *
+// * __re_getCacheFilePath
+// *
+// *=================================================
+
+bool __re_getCacheFilePath(const char* file_name, char* buffer, const size_t capacity) {
+    re_assert(file_name != RE_NULL_HANDLE, "Attempting to get cache path of NULL file name!");
+
+    char local_app_data[MAX_PATH];
+    const DWORD local_app_data_length = GetEnvironmentVariableA("LOCALAPPDATA", local_app_data, MAX_PATH);
+
+    if (local_app_data_length == 0 || local_app_data_length >= MAX_PATH) {
+        return false;
+    }
+
+    const int directory_length = snprintf(buffer, capacity, "%s\\Razor", local_app_data);
+
+    if (directory_length < 0 || (size_t)directory_length >= capacity) {
+        return false;
+    }
+
+    if (!CreateDirectoryA(buffer, RE_NULL_HANDLE) && GetLastError() != ERROR_ALREADY_EXISTS) {
+        return false;
+    }
+
+    const int length = snprintf(buffer, capacity, "%s\\Razor\\%s", local_app_data, file_name);
+
+    return length >= 0 && (size_t)length < capacity;
+}
+
 // *=================================================
 // *
 // * __re_initCoreWin32
@@ -26,6 +62,8 @@ void __re_initCoreWin32() {
 
     const ATOM register_result = RegisterClass(&window_class);
     re_assert(register_result, "Failed to register Win32 window class!");
+
+    __re_initWin32Windows();
 }
 
 #endif
\ No newline at end of file
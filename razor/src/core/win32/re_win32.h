@@ -14,6 +14,9 @@ extern HINSTANCE h_instance;
 /// @brief Initialize the Win32 core module values.
 void __re_initCoreWin32();
 
+/// @brief Initialize the Win32 window module values.
+void __re_initWin32Windows();
+
 /// @brief Processes an internal window event.
 /// @param h_window The window receiving the event.
 /// @param u_message The window message tag.
@@ -0,0 +1,82 @@
+#include <re_core.h>
+
+#if RE_PLATFORM == RE_PLATFORM_WINDOWS
+
+#include "./re_win32.h"
+#include "../re_crash.h"
+
+static re_CrashHandlerFn __re_win32_crash_handler = RE_NULL_HANDLE;
+static LPTOP_LEVEL_EXCEPTION_FILTER __re_win32_previous_filter = RE_NULL_HANDLE;
+
+// *=================================================
+// *
+// * __re_handleWin32Exception
+// *
+// *=================================================
+
+static LONG WINAPI __re_handleWin32Exception(EXCEPTION_POINTERS* exception_info) {
+    __re_win32_crash_handler();
+
+    // ? Hand the exception on to the filter installed before us, if any.
+    if (__re_win32_previous_filter != RE_NULL_HANDLE) {
+        return __re_win32_previous_filter(exception_info);
+    }
+
+    // ? Let Windows Error Reporting (or an attached debugger) take over as usual.
+    return EXCEPTION_CONTINUE_SEARCH;
+}
+
+// *=================================================
+// *
+// * __re_installCrashHandler
+// *
+// *=================================================
+
+void __re_installCrashHandler(const re_CrashHandlerFn handler) {
+    __re_win32_crash_handler = handler;
+
+    __re_win32_previous_filter = SetUnhandledExceptionFilter(__re_handleWin32Exception);
+}
+
+// *=================================================
+// *
+// * __re_openCrashFile
+// *
+// *=================================================
+
+intptr_t __re_openCrashFile(const char* file_path) {
+    const HANDLE file = CreateFileA(
+        file_path,
+        GENERIC_WRITE,
+        FILE_SHARE_READ,
+        RE_NULL_HANDLE,
+        CREATE_ALWAYS,
+        FILE_ATTRIBUTE_NORMAL,
+        RE_NULL_HANDLE
+    );
+
+    return file == INVALID_HANDLE_VALUE ? -1 : (intptr_t)file;
+}
+
+// *=================================================
+// *
+// * __re_writeCrashFile
+// *
+// *=================================================
+
+void __re_writeCrashFile(const intptr_t file, const void* data, const size_t size) {
+    DWORD written = 0;
+    WriteFile((HANDLE)file, data, (DWORD)size, &written, RE_NULL_HANDLE);
+}
+
+// *=================================================
+// *
+// * __re_closeCrashFile
+// *
+// *=================================================
+
+void __re_closeCrashFile(const intptr_t file) {
+    CloseHandle((HANDLE)file);
+}
+
+#endif
\ No newline at end of file
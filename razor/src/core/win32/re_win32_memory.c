@@ -1,15 +1,18 @@
+#include <re_core.h>
+
 #if RE_PLATFORM == RE_PLATFORM_WINDOWS
 
 #include <re_debug.h>
 #include "./re_win32.h"
+#include "../re_memory.h"
 
 // *=================================================
 // *
-// * re_malloc
+// * __re_platformMalloc
 // *
 // *=================================================
 
-void* re_malloc(const size_t size) {
+void* __re_platformMalloc(const size_t size) {
     re_assert(size > 0, "Cannot allocate 0 bytes!");
 
     return HeapAlloc(process_heap, 0, size);
@@ -17,11 +20,11 @@ void* re_malloc(const size_t size) {
 
 // *=================================================
 // *
-// * re_calloc
+// * __re_platformCalloc
 // *
 // *=================================================
 
-void* re_calloc(const size_t element_count, const size_t element_size) {
+void* __re_platformCalloc(const size_t element_count, const size_t element_size) {
     const size_t total_size = element_count * element_size;
     re_assert(total_size > 0, "Cannot contiguous allocate 0 bytes!");
 
@@ -30,11 +33,11 @@ void* re_calloc(const size_t element_count, const size_t element_size) {
 
 // *=================================================
 // *
-// * re_realloc
+// * __re_platformRealloc
 // *
 // *=================================================
 
-void* re_realloc(void* src, const size_t new_size) {
+void* __re_platformRealloc(void* src, const size_t new_size) {
     re_assert(src != RE_NULL_HANDLE, "Cannot reallocate from NULL pointer!");
     re_assert(new_size > 0, "Cannot reallocate into 0 bytes!");
 
@@ -43,11 +46,11 @@ void* re_realloc(void* src, const size_t new_size) {
 
 // *=================================================
 // *
-// * re_free
+// * __re_platformFree
 // *
 // *=================================================
 
-void re_free(void* src) {
+void __re_platformFree(void* src) {
     re_assert(src != RE_NULL_HANDLE, "Cannot free NULL pointer!");
 
     BOOL ok = HeapFree(process_heap, 0, src);
@@ -56,27 +59,64 @@ void re_free(void* src) {
 
 // *=================================================
 // *
-// * re_memset
+// * __re_getVirtualPageSize
+// *
+// *=================================================
+
+size_t __re_getVirtualPageSize() {
+    SYSTEM_INFO system_info;
+    GetSystemInfo(&system_info);
+
+    return (size_t)system_info.dwPageSize;
+}
+
+// *=================================================
+// *
+// * __re_reserveVirtualMemory
+// *
+// *=================================================
+
+void* __re_reserveVirtualMemory(const size_t size) {
+    re_assert(size > 0, "Cannot reserve 0 bytes!");
+
+    return VirtualAlloc(RE_NULL_HANDLE, size, MEM_RESERVE, PAGE_NOACCESS);
+}
+
+// *=================================================
+// *
+// * __re_commitVirtualMemory
 // *
 // *=================================================
 
-void* re_memset(void* src, const int value, const size_t size) {
-    re_assert(src != RE_NULL_HANDLE, "Cannot memset NULL pointer!");
-    
-    return memset(src, value, size);
+bool __re_commitVirtualMemory(void* src, const size_t size) {
+    re_assert(src != RE_NULL_HANDLE, "Cannot commit NULL pointer!");
+
+    return VirtualAlloc(src, size, MEM_COMMIT, PAGE_READWRITE) != RE_NULL_HANDLE;
+}
+
+// *=================================================
+// *
+// * __re_decommitVirtualMemory
+// *
+// *=================================================
+
+void __re_decommitVirtualMemory(void* src, const size_t size) {
+    re_assert(src != RE_NULL_HANDLE, "Cannot decommit NULL pointer!");
+
+    VirtualFree(src, size, MEM_DECOMMIT);
 }
 
 // *=================================================
 // *
-// * re_memcpy
+// * __re_releaseVirtualMemory
 // *
 // *=================================================
 
-void* re_memcpy(void* dst, const void* src, const size_t size) {
-    re_assert(src != RE_NULL_HANDLE, "Cannot memcpy from NULL pointer!");
-    re_assert(dst != RE_NULL_HANDLE, "Cannot memcpy to NULL pointer!");
+void __re_releaseVirtualMemory(void* src, const size_t size) {
+    re_assert(src != RE_NULL_HANDLE, "Cannot release NULL pointer!");
 
-    return memcpy(dst, src, size);
+    (void)size;
+    VirtualFree(src, 0, MEM_RELEASE);
 }
 
 // *=================================================
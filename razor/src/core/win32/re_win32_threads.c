@@ -0,0 +1,176 @@
+#include <re_core.h>
+
+#if RE_PLATFORM == RE_PLATFORM_WINDOWS
+
+#include <re_debug.h>
+#include "./re_win32.h"
+#include "../re_threads.h"
+
+typedef struct re_Thread_T {
+    HANDLE handle;
+    re_ThreadFn thread_fn;
+    void* user_data;
+} re_Thread_T;
+
+typedef struct re_Semaphore_T {
+    HANDLE handle;
+} re_Semaphore_T;
+
+// *=================================================
+// *
+// * __re_runWin32Thread
+// *
+// *=================================================
+
+static DWORD WINAPI __re_runWin32Thread(LPVOID thread_data) {
+    re_Thread thread = (re_Thread)thread_data;
+    thread->thread_fn(thread->user_data);
+
+    __re_exitThread();
+
+    return 0;
+}
+
+// *=================================================
+// *
+// * __re_createThread
+// *
+// *=================================================
+
+re_Thread __re_createThread(const re_ThreadFn thread_fn, void* user_data) {
+    re_assert(thread_fn != RE_NULL_HANDLE, "Attempting to create thread with NULL function!");
+
+    re_Thread thread = (re_Thread)re_malloc(sizeof(re_Thread_T));
+    thread->thread_fn = thread_fn;
+    thread->user_data = user_data;
+
+    thread->handle = CreateThread(RE_NULL_HANDLE, 0, __re_runWin32Thread, thread, 0, RE_NULL_HANDLE);
+    re_assert(thread->handle != RE_NULL_HANDLE, "Failed to create Win32 thread! Error: %lu", GetLastError());
+
+    return thread;
+}
+
+// *=================================================
+// *
+// * __re_joinThread
+// *
+// *=================================================
+
+void __re_joinThread(re_Thread* thread) {
+    re_assert(thread != RE_NULL_HANDLE, "Attempting to join NULL thread!");
+
+    re_Thread thread_data = *thread;
+    re_assert(thread_data != RE_NULL_HANDLE, "Attempting to join NULL thread!");
+
+    WaitForSingleObject(thread_data->handle, INFINITE);
+    CloseHandle(thread_data->handle);
+
+    re_free(thread_data);
+    *thread = RE_NULL_HANDLE;
+}
+
+// *=================================================
+// *
+// * __re_yieldThread
+// *
+// *=================================================
+
+void __re_yieldThread() {
+    SwitchToThread();
+}
+
+// *=================================================
+// *
+// * __re_sleepThread
+// *
+// *=================================================
+
+void __re_sleepThread(const uint32_t milliseconds) {
+    Sleep((DWORD)milliseconds);
+}
+
+// *=================================================
+// *
+// * __re_getCpuCoreCount
+// *
+// *=================================================
+
+uint32_t __re_getCpuCoreCount() {
+    // ? Only the calling thread's processor group, which is also the most
+    // ? SetThreadAffinityMask can address.
+    SYSTEM_INFO system_info;
+    GetSystemInfo(&system_info);
+
+    return system_info.dwNumberOfProcessors > 0 ? (uint32_t)system_info.dwNumberOfProcessors : 1u;
+}
+
+// *=================================================
+// *
+// * __re_pinCurrentThread
+// *
+// *=================================================
+
+bool __re_pinCurrentThread(const uint32_t core_idx) {
+    const DWORD_PTR core_mask = (DWORD_PTR)1u << (core_idx % __re_getCpuCoreCount());
+
+    return SetThreadAffinityMask(GetCurrentThread(), core_mask) != 0;
+}
+
+// *=================================================
+// *
+// * __re_createSemaphore
+// *
+// *=================================================
+
+re_Semaphore __re_createSemaphore() {
+    re_Semaphore semaphore = (re_Semaphore)re_malloc(sizeof(re_Semaphore_T));
+
+    semaphore->handle = CreateSemaphore(RE_NULL_HANDLE, 0, LONG_MAX, RE_NULL_HANDLE);
+    re_assert(semaphore->handle != RE_NULL_HANDLE, "Failed to create Win32 semaphore!");
+
+    return semaphore;
+}
+
+// *=================================================
+// *
+// * __re_destroySemaphore
+// *
+// *=================================================
+
+void __re_destroySemaphore(re_Semaphore* semaphore) {
+    re_assert(semaphore != RE_NULL_HANDLE, "Attempting to destroy NULL semaphore!");
+
+    re_Semaphore semaphore_data = *semaphore;
+    re_assert(semaphore_data != RE_NULL_HANDLE, "Attempting to destroy NULL semaphore!");
+
+    CloseHandle(semaphore_data->handle);
+
+    re_free(semaphore_data);
+    *semaphore = RE_NULL_HANDLE;
+}
+
+// *=================================================
+// *
+// * __re_signalSemaphore
+// *
+// *=================================================
+
+void __re_signalSemaphore(re_Semaphore semaphore) {
+    re_assert(semaphore != RE_NULL_HANDLE, "Attempting to signal NULL semaphore!");
+
+    ReleaseSemaphore(semaphore->handle, 1, RE_NULL_HANDLE);
+}
+
+// *=================================================
+// *
+// * __re_waitSemaphore
+// *
+// *=================================================
+
+bool __re_waitSemaphore(re_Semaphore semaphore, const uint32_t timeout_ms) {
+    re_assert(semaphore != RE_NULL_HANDLE, "Attempting to wait on NULL semaphore!");
+
+    return WaitForSingleObject(semaphore->handle, (DWORD)timeout_ms) == WAIT_OBJECT_0;
+}
+
+#endif
\ No newline at end of file
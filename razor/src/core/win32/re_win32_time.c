@@ -0,0 +1,53 @@
+#include <re_core.h>
+
+#if RE_PLATFORM == RE_PLATFORM_WINDOWS
+
+#include "./re_win32.h"
+#include "../re_time.h"
+
+// ? FILETIME counts 100ns intervals since 1601-01-01.
+#define __RE_WIN32_FILETIME_UNIX_EPOCH 116444736000000000ull
+
+static uint64_t __re_win32_counter_frequency = 0;
+
+// *=================================================
+// *
+// * __re_getMonotonicNs
+// *
+// *=================================================
+
+uint64_t __re_getMonotonicNs() {
+    // ? The frequency is fixed at boot, so racing threads all store the same value.
+    if (__re_win32_counter_frequency == 0) {
+        LARGE_INTEGER frequency;
+        QueryPerformanceFrequency(&frequency);
+
+        __re_win32_counter_frequency = (uint64_t)frequency.QuadPart;
+    }
+
+    LARGE_INTEGER counter;
+    QueryPerformanceCounter(&counter);
+
+    const uint64_t ticks = (uint64_t)counter.QuadPart;
+    const uint64_t frequency = __re_win32_counter_frequency;
+
+    // ? Split to keep ticks * 1e9 from overflowing after a few days of uptime.
+    return (ticks / frequency) * 1000000000ull + ((ticks % frequency) * 1000000000ull) / frequency;
+}
+
+// *=================================================
+// *
+// * __re_getRealtimeNs
+// *
+// *=================================================
+
+uint64_t __re_getRealtimeNs() {
+    FILETIME now;
+    GetSystemTimePreciseAsFileTime(&now);
+
+    const uint64_t intervals = ((uint64_t)now.dwHighDateTime << 32) | (uint64_t)now.dwLowDateTime;
+
+    return (intervals - __RE_WIN32_FILETIME_UNIX_EPOCH) * 100ull;
+}
+
+#endif
\ No newline at end of file
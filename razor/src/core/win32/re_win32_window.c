@@ -1,6 +1,9 @@
+#include <re_core.h>
+
 #if RE_PLATFORM == RE_PLATFORM_WINDOWS
 
 #include <re_debug.h>
+#include <re_profile.h>
 #include "./re_win32.h"
 
 typedef struct re_Window_T {
@@ -20,6 +23,10 @@ typedef struct re_Window_T {
     re_WindowFlag flags;
 } re_Window_T;
 
+#define __RE_WIN32_WINDOW_POOL_BLOCK_SIZE 4u
+
+static re_Pool __re_win32_window_pool = RE_NULL_HANDLE;
+
 #ifdef RE_VULKAN_AVAILABLE
 
 #include "../re_vulkan_window.h"
@@ -33,6 +40,20 @@ static const char* const __RE_VULKAN_WINDOW_EXTENSIONS[__RE_VULKAN_WINDOW_EXTENS
 
 #endif
 
+// *=================================================
+// *
+// * __re_initWin32Windows
+// *
+// *=================================================
+
+void __re_initWin32Windows() {
+    re_PoolCreateInfo pool_create_info = {0};
+    pool_create_info.slot_size = sizeof(re_Window_T);
+    pool_create_info.slots_per_block = __RE_WIN32_WINDOW_POOL_BLOCK_SIZE;
+
+    __re_win32_window_pool = re_createPool(&pool_create_info);
+}
+
 // *=================================================
 // *
 // * __re_processWindowEvents
@@ -156,6 +177,8 @@ VkExtent2D __re_getVulkanExtent(const re_Window window) {
 re_Window re_createWindow(const re_WindowCreateInfo* create_info) {
     re_assert(create_info != RE_NULL_HANDLE, "Attempting to create window with NULL create info!");
 
+    RE_PROFILE_FUNCTION_BEGIN();
+
     const re_WindowFlag flags = create_info->flags;
     const bool is_fullscreen  = (flags & RE_WINDOW_FULLSCREEN) != 0;
     const bool is_resizeable  = (flags & RE_WINDOW_RESIZEABLE) != 0;
@@ -165,7 +188,7 @@ re_Window re_createWindow(const re_WindowCreateInfo* create_info) {
     const bool is_no_maximize = (flags & RE_WINDOW_NO_MAXIMIZE) != 0;
     const bool is_no_minimize = (flags & RE_WINDOW_NO_MINIMIZE) != 0;
 
-    re_Window window = (re_Window)re_calloc(1, sizeof(re_Window_T));
+    re_Window window = (re_Window)re_poolCalloc(__re_win32_window_pool);
 
     DWORD style = 0;
     DWORD ex_style = 0;
@@ -257,6 +280,8 @@ re_Window re_createWindow(const re_WindowCreateInfo* create_info) {
     window->height = create_info->height;
     window->flags = flags;
 
+    RE_PROFILE_END();
+
     return window;
 }
 
@@ -282,7 +307,7 @@ void re_destroyWindow(re_Window* window) {
 
     DestroyWindow(window_data->h_window);
 
-    re_free(window_data);
+    re_poolFree(__re_win32_window_pool, window_data);
     *window = RE_NULL_HANDLE;
 }
 
@@ -384,11 +409,16 @@ void re_setWindowCloseCallback(re_Window window, const re_WindowCloseCallbackFn
 void re_pollEvents(re_Window window) {
     re_assert(window != RE_NULL_HANDLE, "Attempting to set fullscreen mode of NULL window!");
 
+    re_recordFlightFrame();
+    RE_PROFILE_FUNCTION_BEGIN();
+
     MSG message;
     while (PeekMessage(&message, RE_NULL_HANDLE, 0, 0, PM_REMOVE)) {
         TranslateMessage(&message);
         DispatchMessage(&message);
     }
+
+    RE_PROFILE_END();
 }
 
 #endif
\ No newline at end of file
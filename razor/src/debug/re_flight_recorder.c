@@ -0,0 +1,416 @@
+#include "./re_flight_recorder.h"
+
+#include "./re_log_binary.h"
+#include "../core/re_time.h"
+#include "../core/re_crash.h"
+#include "../core/re_threads.h"
+
+#include <stdio.h>
+#include <stdarg.h>
+#include <string.h>
+
+// ? Rings live in static storage so recording never allocates and a crash
+// ? handler can walk them. There is one for every job worker plus room for
+// ? the main thread, the log writer and application threads; a thread that
+// ? reuses an exited engine thread's index appends to that thread's ring.
+#define __RE_FLIGHT_RECORDER_MAX_THREADS (RE_MAX_JOB_WORKERS + 16u)
+#define __RE_FLIGHT_RING_CAPACITY 256u
+#define __RE_FLIGHT_EVENT_DATA_SIZE 104u
+
+#define __RE_FLIGHT_PATH_SIZE 260u
+#define __RE_FLIGHT_LINE_SIZE 1024u
+
+typedef struct __re_FlightEvent {
+    uint64_t timestamp_ns;
+    const __re_LogSite* site;
+
+    uint16_t length;
+    uint8_t kind;
+    uint8_t truncated;
+
+    char data[__RE_FLIGHT_EVENT_DATA_SIZE];
+} __re_FlightEvent;
+
+// ? Each ring has a single writer (its thread), so recording is a plain copy
+// ? followed by a release store of the head. A dump racing the writer can see
+// ? one torn event, which is acceptable for crash diagnostics.
+typedef struct __re_FlightRing {
+    _Alignas(RE_CACHE_LINE_SIZE) atomic_uint head;
+    uint32_t frame_index;
+
+    __re_FlightEvent events[__RE_FLIGHT_RING_CAPACITY];
+} __re_FlightRing;
+
+static __re_FlightRing __re_flight_rings[__RE_FLIGHT_RECORDER_MAX_THREADS];
+static atomic_uint __re_flight_ring_count = 0;
+
+static char __re_flight_path[__RE_FLIGHT_PATH_SIZE] = "razor_flight_recorder.log";
+static atomic_flag __re_flight_crash_dumped = ATOMIC_FLAG_INIT;
+
+static const char* const __RE_FLIGHT_EVENT_NAMES[RE_FLIGHT_EVENT_COUNT] = {
+    "LOG",
+    "MODULE",
+    "GRAPHICS",
+    "FRAME",
+    "USER"
+};
+
+// *=================================================
+// *
+// * __re_getFlightRing
+// *
+// *=================================================
+
+static inline __re_FlightRing* __re_getFlightRing() {
+    const uint32_t thread_index = __re_getThreadIndex();
+
+    if (thread_index >= __RE_FLIGHT_RECORDER_MAX_THREADS) {
+        return RE_NULL_HANDLE;
+    }
+
+    // ? Thread indices are handed out densely, so the count of rings in use
+    // ? only ever grows to one past the highest index seen.
+    uint32_t ring_count = atomic_load_explicit(&__re_flight_ring_count, memory_order_relaxed);
+    while (ring_count <= thread_index) {
+        if (atomic_compare_exchange_weak_explicit(
+            &__re_flight_ring_count,
+            &ring_count,
+            thread_index + 1u,
+            memory_order_relaxed,
+            memory_order_relaxed
+        )) {
+            break;
+        }
+    }
+
+    return &__re_flight_rings[thread_index];
+}
+
+// *=================================================
+// *
+// * __re_beginFlightEvent
+// *
+// *=================================================
+
+static inline __re_FlightEvent* __re_beginFlightEvent(
+    __re_FlightRing* ring,
+    const re_FlightEventKind kind,
+    const uint64_t timestamp_ns
+) {
+    const uint32_t head = atomic_load_explicit(&ring->head, memory_order_relaxed);
+    __re_FlightEvent* event = &ring->events[head & (__RE_FLIGHT_RING_CAPACITY - 1u)];
+
+    event->timestamp_ns = timestamp_ns;
+    event->site = RE_NULL_HANDLE;
+    event->kind = (uint8_t)kind;
+    event->truncated = 0u;
+
+    return event;
+}
+
+// *=================================================
+// *
+// * __re_endFlightEvent
+// *
+// *=================================================
+
+static inline void __re_endFlightEvent(__re_FlightRing* ring) {
+    const uint32_t head = atomic_load_explicit(&ring->head, memory_order_relaxed);
+    atomic_store_explicit(&ring->head, head + 1u, memory_order_release);
+}
+
+// *=================================================
+// *
+// * __re_recordFlightLog
+// *
+// *=================================================
+
+void __re_recordFlightLog(const __re_LogSite* site, const char* data, const uint32_t length, const uint64_t timestamp_ns) {
+    __re_FlightRing* ring = __re_getFlightRing();
+
+    if (ring == RE_NULL_HANDLE) {
+        return;
+    }
+
+    __re_FlightEvent* event = __re_beginFlightEvent(ring, RE_FLIGHT_EVENT_LOG, timestamp_ns);
+
+    // ? A binary payload can be cut mid-argument; the renderer checks every
+    // ? encoded length against the kept size and shows the rest as "...".
+    const uint32_t copy_length = length < __RE_FLIGHT_EVENT_DATA_SIZE ? length : __RE_FLIGHT_EVENT_DATA_SIZE;
+    memcpy(event->data, data, copy_length);
+
+    event->site = site;
+    event->length = (uint16_t)copy_length;
+    event->truncated = copy_length < length;
+
+    __re_endFlightEvent(ring);
+}
+
+// *=================================================
+// *
+// * re_recordFlightEvent
+// *
+// *=================================================
+
+void re_recordFlightEvent(const re_FlightEventKind kind, const char* format, ...) {
+    re_assert(kind < RE_FLIGHT_EVENT_COUNT, "Unknown flight recorder event kind: %d", kind);
+
+    __re_FlightRing* ring = __re_getFlightRing();
+
+    if (ring == RE_NULL_HANDLE) {
+        return;
+    }
+
+    __re_FlightEvent* event = __re_beginFlightEvent(ring, kind, __re_getMonotonicNs());
+
+    va_list args;
+    va_start(args, format);
+    const int length = vsnprintf(event->data, __RE_FLIGHT_EVENT_DATA_SIZE, format, args);
+    va_end(args);
+
+    if (length < 0) {
+        event->length = 0u;
+    }
+    else if ((uint32_t)length >= __RE_FLIGHT_EVENT_DATA_SIZE) {
+        event->length = __RE_FLIGHT_EVENT_DATA_SIZE - 1u;
+        event->truncated = 1u;
+    }
+    else {
+        event->length = (uint16_t)length;
+    }
+
+    __re_endFlightEvent(ring);
+}
+
+// *=================================================
+// *
+// * re_recordFlightFrame
+// *
+// *=================================================
+
+void re_recordFlightFrame() {
+    __re_FlightRing* ring = __re_getFlightRing();
+
+    if (ring == RE_NULL_HANDLE) {
+        return;
+    }
+
+    re_recordFlightEvent(RE_FLIGHT_EVENT_FRAME, "Frame %u", ring->frame_index++);
+}
+
+// *=================================================
+// *
+// * re_setFlightRecorderPath
+// *
+// *=================================================
+
+void re_setFlightRecorderPath(const char* file_path) {
+    re_assert(file_path != RE_NULL_HANDLE, "Attempting to set NULL flight recorder path!");
+
+    const size_t path_length = strlen(file_path);
+    re_assert(path_length < __RE_FLIGHT_PATH_SIZE, "Flight recorder path is too long: %s", file_path);
+
+    memcpy(__re_flight_path, file_path, path_length + 1u);
+}
+
+// *=================================================
+// *
+// * __re_appendFlightDecimal
+// *
+// *=================================================
+
+static size_t __re_appendFlightDecimal(char* buffer, uint64_t value, const uint32_t min_digits) {
+    // ? Hand-rolled so the dump's own text never goes through printf.
+    char digits[20];
+    uint32_t digit_count = 0;
+
+    do {
+        digits[digit_count++] = (char)('0' + value % 10u);
+        value /= 10u;
+    } while (value > 0 || digit_count < min_digits);
+
+    for (uint32_t idx = 0; idx < digit_count; ++idx) {
+        buffer[idx] = digits[digit_count - 1u - idx];
+    }
+
+    return digit_count;
+}
+
+// *=================================================
+// *
+// * __re_appendFlightString
+// *
+// *=================================================
+
+static size_t __re_appendFlightString(char* buffer, const char* string) {
+    const size_t length = strlen(string);
+    memcpy(buffer, string, length);
+
+    return length;
+}
+
+// *=================================================
+// *
+// * __re_writeFlightEvent
+// *
+// *=================================================
+
+static void __re_writeFlightEvent(
+    const intptr_t file,
+    const uint32_t thread_index,
+    const __re_FlightEvent* event,
+    const uint64_t start_ns
+) {
+    char line[__RE_FLIGHT_LINE_SIZE];
+    const uint64_t elapsed_ns = event->timestamp_ns - start_ns;
+
+    // ? "[+<seconds>.<microseconds>s] [thread <index>] [<kind>] ", which is
+    // ? well under the line size.
+    size_t length = __re_appendFlightString(line, "[+");
+    length += __re_appendFlightDecimal(line + length, elapsed_ns / 1000000000ull, 1u);
+    line[length++] = '.';
+    length += __re_appendFlightDecimal(line + length, (elapsed_ns % 1000000000ull) / 1000ull, 6u);
+    length += __re_appendFlightString(line + length, "s] [thread ");
+    length += __re_appendFlightDecimal(line + length, thread_index, 1u);
+    length += __re_appendFlightString(line + length, "] [");
+    length += __re_appendFlightString(line + length, event->kind < RE_FLIGHT_EVENT_COUNT ? __RE_FLIGHT_EVENT_NAMES[event->kind] : "?");
+    length += __re_appendFlightString(line + length, "] ");
+
+    // ? A torn event (see __re_FlightRing) can carry any length.
+    const uint16_t event_length = event->length < __RE_FLIGHT_EVENT_DATA_SIZE ? event->length : __RE_FLIGHT_EVENT_DATA_SIZE;
+
+    if (event->site != RE_NULL_HANDLE) {
+        length += __re_renderLogMessage(
+            line + length,
+            sizeof(line) - length,
+            event->site->format,
+            event->site->file,
+            event->site->line,
+            event->site->level,
+            (const uint8_t*)event->data,
+            event_length
+        );
+    }
+    else {
+        uint16_t data_length = event_length;
+
+        // ? Log text already ends its line.
+        while (data_length > 0 && event->data[data_length - 1u] == '\n') {
+            --data_length;
+        }
+
+        memcpy(line + length, event->data, data_length);
+        length += data_length;
+
+        if (event->truncated) {
+            memcpy(line + length, "...", 3u);
+            length += 3u;
+        }
+
+        line[length++] = '\n';
+    }
+
+    __re_writeCrashFile(file, line, length);
+}
+
+// *=================================================
+// *
+// * re_dumpFlightRecorder
+// *
+// *=================================================
+
+bool re_dumpFlightRecorder(const char* file_path) {
+    // ? Runs from crash handlers: no allocation, no locks, no stdio streams.
+    // ? The only calls outside the async-signal-safe set are the snprintf
+    // ? calls __re_renderLogMessage makes for binary log events; everything
+    // ? else is formatted by hand.
+    const intptr_t file = __re_openCrashFile(file_path != RE_NULL_HANDLE ? file_path : __re_flight_path);
+
+    if (file == -1) {
+        return false;
+    }
+
+    const uint32_t ring_count = atomic_load_explicit(&__re_flight_ring_count, memory_order_acquire);
+
+    uint32_t cursors[__RE_FLIGHT_RECORDER_MAX_THREADS];
+    uint32_t heads[__RE_FLIGHT_RECORDER_MAX_THREADS];
+    uint64_t start_ns = UINT64_MAX;
+
+    for (uint32_t idx = 0; idx < ring_count; ++idx) {
+        const uint32_t head = atomic_load_explicit(&__re_flight_rings[idx].head, memory_order_acquire);
+
+        heads[idx] = head;
+        cursors[idx] = head > __RE_FLIGHT_RING_CAPACITY ? head - __RE_FLIGHT_RING_CAPACITY : 0u;
+
+        if (cursors[idx] < head) {
+            const __re_FlightEvent* oldest = &__re_flight_rings[idx].events[cursors[idx] & (__RE_FLIGHT_RING_CAPACITY - 1u)];
+            start_ns = oldest->timestamp_ns < start_ns ? oldest->timestamp_ns : start_ns;
+        }
+    }
+
+    char header[64];
+    size_t header_length = __re_appendFlightString(header, "Razor flight recorder (");
+    header_length += __re_appendFlightDecimal(header + header_length, ring_count, 1u);
+    header_length += __re_appendFlightString(header + header_length, " threads)\n");
+    __re_writeCrashFile(file, header, header_length);
+
+    // ? Every ring is already in time order, so merging them is a repeated
+    // ? pick of the oldest event at the front of each ring.
+    for (;;) {
+        uint32_t oldest_ring = UINT32_MAX;
+        uint64_t oldest_ns = UINT64_MAX;
+
+        for (uint32_t idx = 0; idx < ring_count; ++idx) {
+            if (cursors[idx] == heads[idx]) {
+                continue;
+            }
+
+            const __re_FlightEvent* event = &__re_flight_rings[idx].events[cursors[idx] & (__RE_FLIGHT_RING_CAPACITY - 1u)];
+            if (event->timestamp_ns < oldest_ns) {
+                oldest_ns = event->timestamp_ns;
+                oldest_ring = idx;
+            }
+        }
+
+        if (oldest_ring == UINT32_MAX) {
+            break;
+        }
+
+        const uint32_t cursor = cursors[oldest_ring]++;
+        __re_writeFlightEvent(
+            file,
+            oldest_ring,
+            &__re_flight_rings[oldest_ring].events[cursor & (__RE_FLIGHT_RING_CAPACITY - 1u)],
+            start_ns
+        );
+    }
+
+    __re_closeCrashFile(file);
+    return true;
+}
+
+// *=================================================
+// *
+// * __re_dumpFlightRecorderOnCrash
+// *
+// *=================================================
+
+void __re_dumpFlightRecorderOnCrash() {
+    // ? An assert dumps before abort() raises SIGABRT; the handler must not
+    // ? overwrite that dump with one that includes its own unwinding.
+    if (atomic_flag_test_and_set_explicit(&__re_flight_crash_dumped, memory_order_acq_rel)) {
+        return;
+    }
+
+    re_dumpFlightRecorder(RE_NULL_HANDLE);
+}
+
+// *=================================================
+// *
+// * __re_initFlightRecorder
+// *
+// *=================================================
+
+void __re_initFlightRecorder() {
+    __re_installCrashHandler(__re_dumpFlightRecorderOnCrash);
+}
\ No newline at end of file
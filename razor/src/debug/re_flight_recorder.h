@@ -0,0 +1,17 @@
+#ifndef __RAZOR_DEBUG_FLIGHT_RECORDER_HEADER_FILE
+#define __RAZOR_DEBUG_FLIGHT_RECORDER_HEADER_FILE
+
+#include <re_core.h>
+#include <re_debug.h>
+
+/// @brief Copy a log record into the calling thread's flight recorder ring.
+/// @param site The binary call site (NULL if data is already formatted text).
+/// @param data The formatted text, or the site's encoded arguments.
+/// @param length The size of data (cut off if it does not fit an event).
+/// @param timestamp_ns The record's __re_getMonotonicNs timestamp.
+void __re_recordFlightLog(const __re_LogSite* site, const char* data, const uint32_t length, const uint64_t timestamp_ns);
+
+/// @brief Start dumping the flight recorder when the process crashes.
+void __re_initFlightRecorder();
+
+#endif
\ No newline at end of file
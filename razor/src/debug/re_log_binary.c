@@ -0,0 +1,902 @@
+#include "./re_log_binary.h"
+
+#include "../core/re_threads.h"
+
+#include <stdio.h>
+#include <string.h>
+#include <stddef.h>
+
+// ? Every argument is widened to one of these on the calling thread, and the
+// ? conversion spec is rewritten to match when the message is rendered.
+typedef enum __re_LogArgKind {
+    __RE_LOG_ARG_INT,
+    __RE_LOG_ARG_UINT,
+    __RE_LOG_ARG_CHAR,
+    __RE_LOG_ARG_SHORT,
+    __RE_LOG_ARG_UCHAR,
+    __RE_LOG_ARG_USHORT,
+    __RE_LOG_ARG_LONG,
+    __RE_LOG_ARG_ULONG,
+    __RE_LOG_ARG_LLONG,
+    __RE_LOG_ARG_ULLONG,
+    __RE_LOG_ARG_SIZE,
+    __RE_LOG_ARG_PTRDIFF,
+    __RE_LOG_ARG_INTMAX,
+    __RE_LOG_ARG_UINTMAX,
+    __RE_LOG_ARG_DOUBLE,
+    __RE_LOG_ARG_LONG_DOUBLE,
+    __RE_LOG_ARG_STRING,
+    __RE_LOG_ARG_POINTER,
+    __RE_LOG_ARG_UNSUPPORTED
+} __re_LogArgKind;
+
+typedef struct __re_LogSpec {
+    const char* start;
+    const char* end;
+
+    bool width_star;
+    bool precision_star;
+
+    char conversion;
+    __re_LogArgKind kind;
+} __re_LogSpec;
+
+#define __RE_LOG_SPEC_BUFFER_SIZE 32u
+
+// ? Site ids are handed out once per log call site, so no real log gets
+// ? anywhere near this. The decoder rejects ids past it instead of sizing its
+// ? site dictionary from a corrupt file.
+#define __RE_LOG_MAX_SITE_ID (1u << 20)
+
+static const char* const __RE_LOG_LEVEL_PREFIXES[RE_LOG_LEVEL_COUNT] = {
+    "[DEBUG]: ",
+    "[INFO]: ",
+    "[SUCCESS]: ",
+    "[WARN]: ",
+    "[ERROR]: ",
+    "[FATAL]: "
+};
+
+// ? Per-thread, so the writer thread, synchronous callers and the decoder
+// ? never share the cached prefix.
+typedef struct __re_LogTimeCache {
+    time_t second;
+    size_t length;
+    char prefix[__RE_LOG_TIME_BUFFER_SIZE];
+} __re_LogTimeCache;
+
+static atomic_uint __re_next_log_site_id = 1u;
+static RE_THREAD_LOCAL __re_LogTimeCache __re_log_time_cache = { (time_t)-1, 0u, {0} };
+
+// *=================================================
+// *
+// * __re_parseLogSpec
+// *
+// *=================================================
+
+static const char* __re_parseLogSpec(const char* format, __re_LogSpec* spec) {
+    // ? Returns a pointer to the next '%' conversion (or NULL), skipping "%%".
+    for (;;) {
+        format = strchr(format, '%');
+
+        if (format == RE_NULL_HANDLE) {
+            return RE_NULL_HANDLE;
+        }
+
+        if (format[1] != '%') {
+            break;
+        }
+
+        format += 2;
+    }
+
+    spec->start = format++;
+    spec->width_star = false;
+    spec->precision_star = false;
+
+    while (*format != '\0' && strchr("-+ #0'", *format) != RE_NULL_HANDLE) {
+        ++format;
+    }
+
+    if (*format == '*') {
+        spec->width_star = true;
+        ++format;
+    }
+
+    while (*format >= '0' && *format <= '9') {
+        ++format;
+    }
+
+    if (*format == '.') {
+        ++format;
+
+        if (*format == '*') {
+            spec->precision_star = true;
+            ++format;
+        }
+
+        while (*format >= '0' && *format <= '9') {
+            ++format;
+        }
+    }
+
+    uint32_t long_count = 0;
+    uint32_t short_count = 0;
+    char size_modifier = '\0';
+
+    for (;; ++format) {
+        if (*format == 'l') {
+            ++long_count;
+        }
+        else if (*format == 'h') {
+            ++short_count;
+        }
+        else if (*format == 'z' || *format == 't' || *format == 'j' || *format == 'L') {
+            size_modifier = *format;
+        }
+        else {
+            break;
+        }
+    }
+
+    spec->conversion = *format;
+    spec->end = *format != '\0' ? format + 1 : format;
+
+    switch (spec->conversion) {
+        case 'd':
+        case 'i':
+        case 'u':
+        case 'x':
+        case 'X':
+        case 'o': {
+            const bool is_signed = spec->conversion == 'd' || spec->conversion == 'i';
+
+            if (size_modifier == 'z') {
+                spec->kind = __RE_LOG_ARG_SIZE;
+            }
+            else if (size_modifier == 't') {
+                spec->kind = __RE_LOG_ARG_PTRDIFF;
+            }
+            else if (size_modifier == 'j') {
+                spec->kind = is_signed ? __RE_LOG_ARG_INTMAX : __RE_LOG_ARG_UINTMAX;
+            }
+            else if (long_count >= 2) {
+                spec->kind = is_signed ? __RE_LOG_ARG_LLONG : __RE_LOG_ARG_ULLONG;
+            }
+            else if (long_count == 1) {
+                spec->kind = is_signed ? __RE_LOG_ARG_LONG : __RE_LOG_ARG_ULONG;
+            }
+            else if (short_count >= 2) {
+                spec->kind = is_signed ? __RE_LOG_ARG_CHAR : __RE_LOG_ARG_UCHAR;
+            }
+            else if (short_count == 1) {
+                spec->kind = is_signed ? __RE_LOG_ARG_SHORT : __RE_LOG_ARG_USHORT;
+            }
+            else {
+                spec->kind = is_signed ? __RE_LOG_ARG_INT : __RE_LOG_ARG_UINT;
+            }
+            break;
+        }
+        case 'c':
+            spec->kind = long_count > 0 ? __RE_LOG_ARG_UNSUPPORTED : __RE_LOG_ARG_INT;
+            break;
+        case 'f':
+        case 'F':
+        case 'e':
+        case 'E':
+        case 'g':
+        case 'G':
+        case 'a':
+        case 'A':
+            spec->kind = size_modifier == 'L' ? __RE_LOG_ARG_LONG_DOUBLE : __RE_LOG_ARG_DOUBLE;
+            break;
+        case 's':
+            spec->kind = long_count > 0 ? __RE_LOG_ARG_UNSUPPORTED : __RE_LOG_ARG_STRING;
+            break;
+        case 'p':
+            spec->kind = __RE_LOG_ARG_POINTER;
+            break;
+        default:
+            spec->kind = __RE_LOG_ARG_UNSUPPORTED;
+            break;
+    }
+
+    return spec->start;
+}
+
+// *=================================================
+// *
+// * __re_scanLogFormat
+// *
+// *=================================================
+
+static uint8_t __re_scanLogFormat(const char* format, uint8_t* arg_kinds) {
+    // ? Returns the number of captured arguments, or __RE_LOG_SITE_REJECTED
+    // ? when the format has more than __RE_LOG_SITE_MAX_ARGS of them or a
+    // ? conversion whose argument type is unknown (and so can't be skipped).
+    uint32_t arg_count = 0;
+    __re_LogSpec spec;
+
+    while ((format = __re_parseLogSpec(format, &spec)) != RE_NULL_HANDLE) {
+        if (spec.kind == __RE_LOG_ARG_UNSUPPORTED) {
+            return __RE_LOG_SITE_REJECTED;
+        }
+
+        const uint32_t spec_arg_count = 1u + (spec.width_star ? 1u : 0u) + (spec.precision_star ? 1u : 0u);
+        if (arg_count + spec_arg_count > __RE_LOG_SITE_MAX_ARGS) {
+            return __RE_LOG_SITE_REJECTED;
+        }
+
+        if (arg_kinds == RE_NULL_HANDLE) {
+            arg_count += spec_arg_count;
+        }
+        else {
+            if (spec.width_star) {
+                arg_kinds[arg_count++] = __RE_LOG_ARG_INT;
+            }
+
+            if (spec.precision_star) {
+                arg_kinds[arg_count++] = __RE_LOG_ARG_INT;
+            }
+
+            arg_kinds[arg_count++] = (uint8_t)spec.kind;
+        }
+
+        format = spec.end;
+    }
+
+    return (uint8_t)arg_count;
+}
+
+// *=================================================
+// *
+// * __re_registerLogSite
+// *
+// *=================================================
+
+uint32_t __re_registerLogSite(__re_LogSite* site) {
+    _Atomic(uint32_t)* site_id = (_Atomic(uint32_t)*)&site->id;
+
+    uint32_t id = atomic_load_explicit(site_id, memory_order_acquire);
+    if (id != 0u && id != UINT32_MAX) {
+        return id;
+    }
+
+    // ? The first caller parses the format; racing callers wait for it.
+    uint32_t expected = 0u;
+    if (!atomic_compare_exchange_strong_explicit(site_id, &expected, UINT32_MAX, memory_order_acquire, memory_order_acquire)) {
+        while ((id = atomic_load_explicit(site_id, memory_order_acquire)) == UINT32_MAX) {
+            __re_cpuRelax();
+        }
+
+        return id;
+    }
+
+    site->arg_count = __re_scanLogFormat(site->format, site->arg_kinds);
+
+    id = atomic_fetch_add_explicit(&__re_next_log_site_id, 1u, memory_order_relaxed);
+    atomic_store_explicit(site_id, id, memory_order_release);
+
+    return id;
+}
+
+// *=================================================
+// *
+// * __re_encodeLogArgs
+// *
+// *=================================================
+
+uint32_t __re_encodeLogArgs(const __re_LogSite* site, va_list args, uint8_t* payload, const uint32_t capacity) {
+    uint32_t size = 0;
+
+    // ? The argument types of a rejected site are unknown, so none of them
+    // ? can be read; the renderer prints its format as unsupported instead.
+    if (site->arg_count == __RE_LOG_SITE_REJECTED) {
+        return 0u;
+    }
+
+    for (uint32_t idx = 0; idx < site->arg_count; ++idx) {
+        uint64_t value = 0;
+
+        switch ((__re_LogArgKind)site->arg_kinds[idx]) {
+            case __RE_LOG_ARG_INT:     value = (uint64_t)(int64_t)va_arg(args, int); break;
+            case __RE_LOG_ARG_UINT:    value = (uint64_t)va_arg(args, unsigned int); break;
+            case __RE_LOG_ARG_CHAR:    value = (uint64_t)(int64_t)(signed char)va_arg(args, int); break;
+            case __RE_LOG_ARG_SHORT:   value = (uint64_t)(int64_t)(short)va_arg(args, int); break;
+            case __RE_LOG_ARG_UCHAR:   value = (uint64_t)(unsigned char)va_arg(args, unsigned int); break;
+            case __RE_LOG_ARG_USHORT:  value = (uint64_t)(unsigned short)va_arg(args, unsigned int); break;
+            case __RE_LOG_ARG_LONG:    value = (uint64_t)(int64_t)va_arg(args, long); break;
+            case __RE_LOG_ARG_ULONG:   value = (uint64_t)va_arg(args, unsigned long); break;
+            case __RE_LOG_ARG_LLONG:   value = (uint64_t)va_arg(args, long long); break;
+            case __RE_LOG_ARG_ULLONG:  value = (uint64_t)va_arg(args, unsigned long long); break;
+            case __RE_LOG_ARG_SIZE:    value = (uint64_t)va_arg(args, size_t); break;
+            case __RE_LOG_ARG_PTRDIFF: value = (uint64_t)(int64_t)va_arg(args, ptrdiff_t); break;
+            case __RE_LOG_ARG_INTMAX:  value = (uint64_t)va_arg(args, intmax_t); break;
+            case __RE_LOG_ARG_UINTMAX: value = (uint64_t)va_arg(args, uintmax_t); break;
+            case __RE_LOG_ARG_POINTER: value = (uint64_t)(uintptr_t)va_arg(args, void*); break;
+            case __RE_LOG_ARG_DOUBLE: {
+                const double number = va_arg(args, double);
+                memcpy(&value, &number, sizeof(value));
+                break;
+            }
+            case __RE_LOG_ARG_LONG_DOUBLE: {
+                const double number = (double)va_arg(args, long double);
+                memcpy(&value, &number, sizeof(value));
+                break;
+            }
+            case __RE_LOG_ARG_STRING: {
+                const char* string = va_arg(args, const char*);
+                if (string == RE_NULL_HANDLE) {
+                    string = "(null)";
+                }
+
+                // ? Strings are copied (not referenced) since they may not
+                // ? outlive the call; long ones are cut to fit the record.
+                if (size + sizeof(uint16_t) > capacity) {
+                    return size;
+                }
+
+                size_t length = strlen(string);
+                if (length > capacity - size - sizeof(uint16_t)) {
+                    length = capacity - size - sizeof(uint16_t);
+                }
+
+                const uint16_t encoded_length = (uint16_t)length;
+                memcpy(payload + size, &encoded_length, sizeof(encoded_length));
+                memcpy(payload + size + sizeof(encoded_length), string, length);
+
+                size += (uint32_t)(sizeof(encoded_length) + length);
+                continue;
+            }
+            case __RE_LOG_ARG_UNSUPPORTED:
+                return size;
+        }
+
+        if (size + sizeof(value) > capacity) {
+            return size;
+        }
+
+        memcpy(payload + size, &value, sizeof(value));
+        size += (uint32_t)sizeof(value);
+    }
+
+    return size;
+}
+
+// *=================================================
+// *
+// * __re_readLogValue
+// *
+// *=================================================
+
+static inline bool __re_readLogValue(const uint8_t* payload, const uint32_t payload_size, uint32_t* offset, uint64_t* value) {
+    if (*offset + sizeof(uint64_t) > payload_size) {
+        return false;
+    }
+
+    memcpy(value, payload + *offset, sizeof(uint64_t));
+    *offset += (uint32_t)sizeof(uint64_t);
+
+    return true;
+}
+
+// *=================================================
+// *
+// * __re_appendLogSpec
+// *
+// *=================================================
+
+static bool __re_appendLogSpec(char* spec_buffer, size_t* length, const char* source, const size_t source_length) {
+    if (source_length >= __RE_LOG_SPEC_BUFFER_SIZE - *length) {
+        return false;
+    }
+
+    memcpy(spec_buffer + *length, source, source_length);
+    *length += source_length;
+    spec_buffer[*length] = '\0';
+
+    return true;
+}
+
+// *=================================================
+// *
+// * __re_buildLogSpec
+// *
+// *=================================================
+
+static bool __re_buildLogSpec(
+    char* spec_buffer,
+    const __re_LogSpec* spec,
+    const char* length_modifier,
+    const uint8_t* payload,
+    const uint32_t payload_size,
+    uint32_t* offset
+) {
+    // ? Rebuilds "%[flags][width][.precision]<modifier><conversion>" with any
+    // ? '*' replaced by its captured value and the original modifier swapped
+    // ? for the one matching the widened argument. Returns false only when
+    // ? the payload runs out; a spec too long for spec_buffer (the format may
+    // ? come from a decoded file) still consumes its '*' values but becomes
+    // ? "<?>", which printf prints while ignoring the surplus argument.
+    size_t length = 0;
+
+    const char* cursor = spec->start + 1;
+    const size_t flags_length = strspn(cursor, "-+ #0'");
+
+    bool fits = __re_appendLogSpec(spec_buffer, &length, spec->start, 1u + flags_length);
+    cursor += flags_length;
+
+    char star_buffer[16];
+    uint64_t star_value = 0;
+
+    if (spec->width_star) {
+        if (!__re_readLogValue(payload, payload_size, offset, &star_value)) {
+            return false;
+        }
+
+        const int star_length = snprintf(star_buffer, sizeof(star_buffer), "%d", (int)(int64_t)star_value);
+        fits = fits && __re_appendLogSpec(spec_buffer, &length, star_buffer, (size_t)star_length);
+        ++cursor;
+    }
+
+    size_t digits_length = strspn(cursor, "0123456789");
+    fits = fits && __re_appendLogSpec(spec_buffer, &length, cursor, digits_length);
+    cursor += digits_length;
+
+    if (*cursor == '.') {
+        fits = fits && __re_appendLogSpec(spec_buffer, &length, cursor++, 1u);
+
+        if (spec->precision_star) {
+            if (!__re_readLogValue(payload, payload_size, offset, &star_value)) {
+                return false;
+            }
+
+            const int star_length = snprintf(star_buffer, sizeof(star_buffer), "%d", (int)(int64_t)star_value);
+            fits = fits && __re_appendLogSpec(spec_buffer, &length, star_buffer, (size_t)star_length);
+            ++cursor;
+        }
+
+        digits_length = strspn(cursor, "0123456789");
+        fits = fits && __re_appendLogSpec(spec_buffer, &length, cursor, digits_length);
+    }
+
+    fits = fits && __re_appendLogSpec(spec_buffer, &length, length_modifier, strlen(length_modifier));
+    fits = fits && __re_appendLogSpec(spec_buffer, &length, &spec->conversion, 1u);
+
+    if (!fits) {
+        memcpy(spec_buffer, "<?>", 4u);
+    }
+
+    return true;
+}
+
+// *=================================================
+// *
+// * __re_renderLogMessage
+// *
+// *=================================================
+
+size_t __re_renderLogMessage(
+    char* output,
+    const size_t capacity,
+    const char* format,
+    const char* file,
+    const uint32_t line,
+    const uint32_t level,
+    const uint8_t* payload,
+    const uint32_t payload_size
+) {
+    // ? Keeps room for the trailing newline and terminator at all times.
+    const size_t limit = capacity - 2u;
+    size_t size = 0;
+
+    #define __RE_LOG_APPEND(source, source_length) do { \
+        size_t __append_length = (source_length); \
+        if (__append_length > limit - size) { __append_length = limit - size; } \
+        memcpy(output + size, (source), __append_length); \
+        size += __append_length; \
+    } while(0)
+
+    const char* prefix = level < RE_LOG_LEVEL_COUNT ? __RE_LOG_LEVEL_PREFIXES[level] : "[LOG]: ";
+    __RE_LOG_APPEND(prefix, strlen(prefix));
+
+    if (level >= RE_LOG_LEVEL_WARN) {
+        char location[__RE_LOG_SPEC_BUFFER_SIZE];
+        __RE_LOG_APPEND("(File: ", 7u);
+        __RE_LOG_APPEND(file, strlen(file));
+        __RE_LOG_APPEND(location, (size_t)snprintf(location, sizeof(location), "; Line: %u) ", line));
+    }
+
+    // ? Rejected sites captured no arguments, so their format is shown as is.
+    const bool is_rejected = __re_scanLogFormat(format, RE_NULL_HANDLE) == __RE_LOG_SITE_REJECTED;
+
+    if (is_rejected) {
+        __RE_LOG_APPEND("<unsupported format> ", 21u);
+        __RE_LOG_APPEND(format, strlen(format));
+    }
+
+    uint32_t offset = 0;
+    bool truncated = false;
+
+    __re_LogSpec spec;
+    const char* cursor = is_rejected ? "" : format;
+
+    while (!truncated) {
+        const char* spec_start = __re_parseLogSpec(cursor, &spec);
+        const char* literal_end = spec_start != RE_NULL_HANDLE ? spec_start : cursor + strlen(cursor);
+
+        // ? Literal text still contains "%%", which printf collapses to '%'.
+        for (const char* literal = cursor; literal < literal_end; ++literal) {
+            if (literal[0] == '%' && literal[1] == '%') {
+                ++literal;
+            }
+
+            __RE_LOG_APPEND(literal, 1u);
+        }
+
+        if (spec_start == RE_NULL_HANDLE) {
+            break;
+        }
+
+        cursor = spec.end;
+
+        char spec_buffer[__RE_LOG_SPEC_BUFFER_SIZE];
+        char value_buffer[__RE_LOG_SLOT_PAYLOAD_SIZE];
+        int value_length = 0;
+        uint64_t value = 0;
+
+        switch (spec.kind) {
+            case __RE_LOG_ARG_STRING: {
+                if (!__re_buildLogSpec(spec_buffer, &spec, "", payload, payload_size, &offset)) {
+                    truncated = true;
+                    break;
+                }
+
+                uint16_t string_length = 0;
+                if (offset + sizeof(string_length) > payload_size) {
+                    truncated = true;
+                    break;
+                }
+
+                memcpy(&string_length, payload + offset, sizeof(string_length));
+                offset += (uint32_t)sizeof(string_length);
+
+                // ? Decoded payloads come from disk, so the length is not trusted.
+                char string[__RE_LOG_SLOT_PAYLOAD_SIZE];
+                if ((size_t)offset + string_length > payload_size || string_length >= sizeof(string)) {
+                    truncated = true;
+                    break;
+                }
+
+                memcpy(string, payload + offset, string_length);
+                string[string_length] = '\0';
+                offset += string_length;
+
+                value_length = snprintf(value_buffer, sizeof(value_buffer), spec_buffer, string);
+                break;
+            }
+            case __RE_LOG_ARG_DOUBLE:
+            case __RE_LOG_ARG_LONG_DOUBLE: {
+                if (
+                    !__re_buildLogSpec(spec_buffer, &spec, "", payload, payload_size, &offset) ||
+                    !__re_readLogValue(payload, payload_size, &offset, &value)
+                ) {
+                    truncated = true;
+                    break;
+                }
+
+                double number = 0.0;
+                memcpy(&number, &value, sizeof(number));
+
+                value_length = snprintf(value_buffer, sizeof(value_buffer), spec_buffer, number);
+                break;
+            }
+            case __RE_LOG_ARG_POINTER:
+                if (
+                    !__re_buildLogSpec(spec_buffer, &spec, "", payload, payload_size, &offset) ||
+                    !__re_readLogValue(payload, payload_size, &offset, &value)
+                ) {
+                    truncated = true;
+                    break;
+                }
+
+                value_length = snprintf(value_buffer, sizeof(value_buffer), spec_buffer, (void*)(uintptr_t)value);
+                break;
+            default: {
+                const char* modifier = spec.conversion == 'c' ? "" : "ll";
+
+                if (
+                    !__re_buildLogSpec(spec_buffer, &spec, modifier, payload, payload_size, &offset) ||
+                    !__re_readLogValue(payload, payload_size, &offset, &value)
+                ) {
+                    truncated = true;
+                    break;
+                }
+
+                if (spec.conversion == 'c') {
+                    value_length = snprintf(value_buffer, sizeof(value_buffer), spec_buffer, (int)(int64_t)value);
+                }
+                else {
+                    value_length = snprintf(value_buffer, sizeof(value_buffer), spec_buffer, (long long)value);
+                }
+                break;
+            }
+        }
+
+        if (value_length > 0) {
+            __RE_LOG_APPEND(value_buffer, (size_t)value_length < sizeof(value_buffer) ? (size_t)value_length : sizeof(value_buffer) - 1u);
+        }
+    }
+
+    if (truncated) {
+        __RE_LOG_APPEND("...", 3u);
+    }
+
+    #undef __RE_LOG_APPEND
+
+    output[size++] = '\n';
+    output[size] = '\0';
+
+    return size;
+}
+
+// *=================================================
+// *
+// * __re_formatLogTime
+// *
+// *=================================================
+
+size_t __re_formatLogTime(char* buffer, const uint64_t wall_ns) {
+    const time_t second = (time_t)(wall_ns / 1000000000ull);
+    __re_LogTimeCache* cache = &__re_log_time_cache;
+
+    // ? localtime/strftime only run when the second changes; the fraction
+    // ? is appended by hand.
+    if (second != cache->second) {
+        struct tm local_time;
+
+        #if RE_PLATFORM == RE_PLATFORM_WINDOWS
+        localtime_s(&local_time, &second);
+        #else
+        localtime_r(&second, &local_time);
+        #endif
+
+        cache->second = second;
+        cache->length = strftime(cache->prefix, sizeof(cache->prefix), "%Y-%m-%d %H:%M:%S", &local_time);
+    }
+
+    memcpy(buffer, cache->prefix, cache->length);
+    size_t length = cache->length;
+
+    uint32_t microseconds = (uint32_t)((wall_ns % 1000000000ull) / 1000ull);
+    buffer[length] = '.';
+
+    for (uint32_t idx = 6; idx > 0; --idx) {
+        buffer[length + idx] = (char)('0' + microseconds % 10u);
+        microseconds /= 10u;
+    }
+
+    length += 7u;
+    buffer[length] = '\0';
+
+    return length;
+}
+
+
+// *=================================================
+// *
+// * __re_readLogBytes
+// *
+// *=================================================
+
+static inline bool __re_readLogBytes(FILE* input, void* data, const size_t size) {
+    return size == 0 || fread(data, 1, size, input) == size;
+}
+
+// *=================================================
+// *
+// * __re_readLogString
+// *
+// *=================================================
+
+static char* __re_readLogString(FILE* input, const uint16_t length) {
+    char* string = (char*)re_malloc((size_t)length + 1u);
+
+    if (!__re_readLogBytes(input, string, length)) {
+        re_free(string);
+        return RE_NULL_HANDLE;
+    }
+
+    string[length] = '\0';
+    return string;
+}
+
+// *=================================================
+// *
+// * re_decodeBinaryLog
+// *
+// *=================================================
+
+bool re_decodeBinaryLog(const char* input_path, const char* output_path) {
+    re_assert(input_path != RE_NULL_HANDLE, "Attempting to decode a binary log from a NULL path!");
+
+    FILE* input = RE_NULL_HANDLE;
+    FILE* output = stdout;
+
+    #if RE_PLATFORM == RE_PLATFORM_WINDOWS
+    fopen_s(&input, input_path, "rb");
+    #else
+    input = fopen(input_path, "rb");
+    #endif
+
+    if (input == RE_NULL_HANDLE) {
+        return false;
+    }
+
+    if (output_path != RE_NULL_HANDLE) {
+        #if RE_PLATFORM == RE_PLATFORM_WINDOWS
+        fopen_s(&output, output_path, "w");
+        #else
+        output = fopen(output_path, "w");
+        #endif
+
+        if (output == RE_NULL_HANDLE) {
+            fclose(input);
+            return false;
+        }
+    }
+
+    uint32_t magic = 0;
+    uint32_t version = 0;
+    bool success = __re_readLogBytes(input, &magic, sizeof(magic)) &&
+        __re_readLogBytes(input, &version, sizeof(version)) &&
+        magic == __RE_LOG_BINARY_MAGIC &&
+        version == __RE_LOG_BINARY_VERSION;
+
+    // ? Site ids are dense, so the dictionary is a plain array indexed by id.
+    __re_LogSite* sites = RE_NULL_HANDLE;
+    uint32_t site_capacity = 0;
+
+    char text[__RE_LOG_RENDER_BUFFER_SIZE];
+    char time_buffer[__RE_LOG_TIME_BUFFER_SIZE];
+    uint8_t payload[UINT16_MAX];
+
+    while (success) {
+        uint8_t kind = 0;
+        if (!__re_readLogBytes(input, &kind, sizeof(kind))) {
+            break;
+        }
+
+        switch (kind) {
+            case __RE_LOG_RECORD_SITE: {
+                __re_LogSite site = { 0 };
+                uint8_t level = 0;
+                uint16_t format_length = 0;
+                uint16_t file_length = 0;
+
+                success = __re_readLogBytes(input, &site.id, sizeof(site.id)) &&
+                    __re_readLogBytes(input, &site.line, sizeof(site.line)) &&
+                    __re_readLogBytes(input, &level, sizeof(level)) &&
+                    __re_readLogBytes(input, &format_length, sizeof(format_length)) &&
+                    __re_readLogBytes(input, &file_length, sizeof(file_length)) &&
+                    site.id != 0 && site.id <= __RE_LOG_MAX_SITE_ID && level < RE_LOG_LEVEL_COUNT;
+
+                if (!success) {
+                    break;
+                }
+
+                site.level = level;
+                site.format = __re_readLogString(input, format_length);
+                site.file = site.format != RE_NULL_HANDLE ? __re_readLogString(input, file_length) : RE_NULL_HANDLE;
+
+                if (site.file == RE_NULL_HANDLE) {
+                    re_free((void*)site.format);
+                    success = false;
+                    break;
+                }
+
+                if (site.id >= site_capacity) {
+                    uint64_t new_capacity = site_capacity > 0 ? site_capacity : 64u;
+                    while (new_capacity <= site.id) {
+                        new_capacity *= 2u;
+                    }
+
+                    sites = sites != RE_NULL_HANDLE ?
+                        (__re_LogSite*)re_realloc(sites, (size_t)new_capacity * sizeof(__re_LogSite)) :
+                        (__re_LogSite*)re_malloc((size_t)new_capacity * sizeof(__re_LogSite));
+                    re_memset(sites + site_capacity, 0, ((size_t)new_capacity - site_capacity) * sizeof(__re_LogSite));
+                    site_capacity = (uint32_t)new_capacity;
+                }
+
+                // ? A site is re-emitted after every re_setLogFile; keep the first copy.
+                if (sites[site.id].format == RE_NULL_HANDLE) {
+                    sites[site.id] = site;
+                }
+                else {
+                    re_free((void*)site.format);
+                    re_free((void*)site.file);
+                }
+                break;
+            }
+            case __RE_LOG_RECORD_MESSAGE: {
+                uint32_t id = 0;
+                uint64_t timestamp = 0;
+                uint16_t length = 0;
+
+                success = __re_readLogBytes(input, &id, sizeof(id)) &&
+                    __re_readLogBytes(input, &timestamp, sizeof(timestamp)) &&
+                    __re_readLogBytes(input, &length, sizeof(length)) &&
+                    __re_readLogBytes(input, payload, length) &&
+                    id < site_capacity && sites[id].format != RE_NULL_HANDLE;
+
+                if (!success) {
+                    break;
+                }
+
+                const __re_LogSite* site = &sites[id];
+                const size_t text_length = __re_renderLogMessage(
+                    text,
+                    sizeof(text),
+                    site->format,
+                    site->file,
+                    site->line,
+                    site->level,
+                    payload,
+                    length
+                );
+
+                __re_formatLogTime(time_buffer, timestamp);
+                fprintf(output, "%s - ", time_buffer);
+                fwrite(text, 1, text_length, output);
+                break;
+            }
+            case __RE_LOG_RECORD_TEXT: {
+                uint64_t timestamp = 0;
+                uint16_t length = 0;
+
+                success = __re_readLogBytes(input, &timestamp, sizeof(timestamp)) &&
+                    __re_readLogBytes(input, &length, sizeof(length)) &&
+                    __re_readLogBytes(input, payload, length);
+
+                if (!success) {
+                    break;
+                }
+
+                __re_formatLogTime(time_buffer, timestamp);
+                fprintf(output, "%s - ", time_buffer);
+                fwrite(payload, 1, length, output);
+                break;
+            }
+            case __RE_LOG_RECORD_DROPPED: {
+                uint64_t dropped_count = 0;
+
+                success = __re_readLogBytes(input, &dropped_count, sizeof(dropped_count));
+                if (success) {
+                    fprintf(output, "[WARN]: Logger ring was full, dropped %llu messages\n", (unsigned long long)dropped_count);
+                }
+                break;
+            }
+            default:
+                success = false;
+                break;
+        }
+    }
+
+    for (uint32_t idx = 0; idx < site_capacity; ++idx) {
+        if (sites[idx].format != RE_NULL_HANDLE) {
+            re_free((void*)sites[idx].format);
+            re_free((void*)sites[idx].file);
+        }
+    }
+
+    if (sites != RE_NULL_HANDLE) {
+        re_free(sites);
+    }
+
+    fclose(input);
+    if (output != stdout) {
+        fclose(output);
+    }
+
+    return success;
+}
\ No newline at end of file
@@ -0,0 +1,70 @@
+#ifndef __RAZOR_DEBUG_LOG_BINARY_HEADER_FILE
+#define __RAZOR_DEBUG_LOG_BINARY_HEADER_FILE
+
+#include <re_core.h>
+#include <re_debug.h>
+
+#include <time.h>
+#include <stdarg.h>
+
+// ? Binary log files start with this header, followed by a stream of
+// ? records that each begin with a one byte __re_LogRecordKind.
+#define __RE_LOG_BINARY_MAGIC 0x474C4552u
+#define __RE_LOG_BINARY_VERSION 2u
+
+#define __RE_LOG_TIME_BUFFER_SIZE 32u
+#define __RE_LOG_RENDER_BUFFER_SIZE 1024u
+
+// ? Bytes available in a ring slot for either a formatted line or the
+// ? encoded arguments of a binary message.
+#define __RE_LOG_SLOT_PAYLOAD_SIZE 480u
+
+typedef enum __re_LogRecordKind {
+    __RE_LOG_RECORD_SITE = 1,
+    __RE_LOG_RECORD_MESSAGE,
+    __RE_LOG_RECORD_TEXT,
+    __RE_LOG_RECORD_DROPPED
+} __re_LogRecordKind;
+
+/// @brief Parse a call site's format string and assign it a unique id (first call only).
+/// @param site The call site to register.
+/// @return The call site's id.
+uint32_t __re_registerLogSite(__re_LogSite* site);
+
+/// @brief Encode a call's raw arguments according to its registered call site.
+/// @param site The registered call site.
+/// @param args The call's arguments.
+/// @param payload The buffer to encode into.
+/// @param capacity The size of payload (arguments that don't fit are cut off).
+/// @return The number of bytes written to payload.
+uint32_t __re_encodeLogArgs(const __re_LogSite* site, va_list args, uint8_t* payload, const uint32_t capacity);
+
+/// @brief Render a binary log message as a line of text. The payload may be cut short or
+/// come from an untrusted file; arguments that run past its end render as "...".
+/// @param output The buffer to render into.
+/// @param capacity The size of output.
+/// @param format The call site's format string.
+/// @param file The call site's file.
+/// @param line The call site's line.
+/// @param level The call site's re_LogLevel.
+/// @param payload The encoded arguments.
+/// @param payload_size The size of payload.
+/// @return The number of characters written to output (excluding the terminator).
+size_t __re_renderLogMessage(
+    char* output,
+    const size_t capacity,
+    const char* format,
+    const char* file,
+    const uint32_t line,
+    const uint32_t level,
+    const uint8_t* payload,
+    const uint32_t payload_size
+);
+
+/// @brief Format a timestamp as the logger's wall-clock prefix (local time, microsecond precision).
+/// @param buffer A buffer of at least __RE_LOG_TIME_BUFFER_SIZE characters.
+/// @param wall_ns The time to format, in nanoseconds since the Unix epoch.
+/// @return The number of characters written to buffer.
+size_t __re_formatLogTime(char* buffer, const uint64_t wall_ns);
+
+#endif
\ No newline at end of file
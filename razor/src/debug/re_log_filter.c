@@ -0,0 +1,151 @@
+#include <re_debug.h>
+
+#include "../core/re_threads.h"
+#include "../core/re_time.h"
+
+#define __RE_LOG_RATE_WINDOW_NS 1000000000ull
+
+#define __RE_LOG_ALL_CATEGORIES ((1u << RE_LOG_CATEGORY_COUNT) - 1u)
+
+// ? Macros read the thresholds without synchronization; a changed filter is
+// ? picked up by each thread on its next log call, which is all it needs.
+volatile uint8_t __re_log_thresholds[RE_LOG_CATEGORY_COUNT] = {
+    RE_LOG_LEVEL_DEBUG,
+    RE_LOG_LEVEL_DEBUG,
+    RE_LOG_LEVEL_DEBUG,
+    RE_LOG_LEVEL_DEBUG
+};
+
+static re_LogLevel __re_log_category_levels[RE_LOG_CATEGORY_COUNT] = {
+    RE_LOG_LEVEL_DEBUG,
+    RE_LOG_LEVEL_DEBUG,
+    RE_LOG_LEVEL_DEBUG,
+    RE_LOG_LEVEL_DEBUG
+};
+
+static uint32_t __re_log_category_mask = __RE_LOG_ALL_CATEGORIES;
+static re_SpinLock __re_log_filter_lock = RE_SPIN_LOCK_INIT;
+
+// ? Off by default: dropping messages has to be the application's choice.
+static atomic_uint __re_log_rate_limit = 0u;
+
+// *=================================================
+// *
+// * __re_updateLogThresholds
+// *
+// *=================================================
+
+static void __re_updateLogThresholds() {
+    for (uint32_t category = 0; category < RE_LOG_CATEGORY_COUNT; ++category) {
+        const bool enabled = (__re_log_category_mask & (1u << category)) != 0;
+
+        // ? Disabled categories get a threshold no macro level can reach.
+        __re_log_thresholds[category] = (uint8_t)(enabled ? __re_log_category_levels[category] : RE_LOG_LEVEL_COUNT);
+    }
+}
+
+// *=================================================
+// *
+// * __re_checkLogRateLimit
+// *
+// *=================================================
+
+bool __re_checkLogRateLimit(__re_LogRateLimit* rate_limit, const char* file, const uint32_t line) {
+    const uint32_t limit = atomic_load_explicit(&__re_log_rate_limit, memory_order_relaxed);
+
+    if (limit == 0) {
+        return true;
+    }
+
+    // ? Windows are whole seconds of the monotonic clock, so a wall clock
+    // ? adjustment can't reopen or stretch one.
+    const uint32_t now = (uint32_t)(__re_getMonotonicNs() / __RE_LOG_RATE_WINDOW_NS);
+    uint32_t current_window = atomic_load_explicit(&rate_limit->window, memory_order_relaxed);
+
+    if (
+        current_window != now &&
+        atomic_compare_exchange_strong_explicit(&rate_limit->window, &current_window, now, memory_order_relaxed, memory_order_relaxed)
+    ) {
+        atomic_store_explicit(&rate_limit->count, 0u, memory_order_relaxed);
+
+        // ? The summary for a noisy window goes out with the site's next message.
+        const uint32_t suppressed_count = atomic_exchange_explicit(&rate_limit->suppressed, 0u, memory_order_relaxed);
+        if (suppressed_count > 0) {
+            __re_internalLog(
+                "[WARN]: (File: %s; Line: %u) Rate limit suppressed %u messages\n",
+                file,
+                line,
+                suppressed_count
+            );
+        }
+    }
+
+    if (atomic_fetch_add_explicit(&rate_limit->count, 1u, memory_order_relaxed) < limit) {
+        return true;
+    }
+
+    atomic_fetch_add_explicit(&rate_limit->suppressed, 1u, memory_order_relaxed);
+    return false;
+}
+
+// *=================================================
+// *
+// * re_setLogLevel
+// *
+// *=================================================
+
+void re_setLogLevel(const re_LogLevel level) {
+    re_assert(level < RE_LOG_LEVEL_COUNT, "Unknown log level: %d", level);
+
+    __re_lockSpinLock(&__re_log_filter_lock);
+
+    for (uint32_t category = 0; category < RE_LOG_CATEGORY_COUNT; ++category) {
+        __re_log_category_levels[category] = level;
+    }
+    __re_updateLogThresholds();
+
+    __re_unlockSpinLock(&__re_log_filter_lock);
+}
+
+// *=================================================
+// *
+// * re_setLogCategoryLevel
+// *
+// *=================================================
+
+void re_setLogCategoryLevel(const re_LogCategory category, const re_LogLevel level) {
+    re_assert(category < RE_LOG_CATEGORY_COUNT, "Unknown log category: %d", category);
+    re_assert(level < RE_LOG_LEVEL_COUNT, "Unknown log level: %d", level);
+
+    __re_lockSpinLock(&__re_log_filter_lock);
+
+    __re_log_category_levels[category] = level;
+    __re_updateLogThresholds();
+
+    __re_unlockSpinLock(&__re_log_filter_lock);
+}
+
+// *=================================================
+// *
+// * re_setLogCategoryMask
+// *
+// *=================================================
+
+void re_setLogCategoryMask(const uint32_t category_mask) {
+    __re_lockSpinLock(&__re_log_filter_lock);
+
+    __re_log_category_mask = category_mask & __RE_LOG_ALL_CATEGORIES;
+    __re_updateLogThresholds();
+
+    __re_unlockSpinLock(&__re_log_filter_lock);
+}
+
+// *=================================================
+// *
+// * re_setLogRateLimit
+// *
+// *=================================================
+
+void re_setLogRateLimit(const uint32_t messages_per_second) {
+    atomic_store_explicit(&__re_log_rate_limit, messages_per_second, memory_order_relaxed);
+}
\ No newline at end of file
@@ -1,14 +1,515 @@
 #include <re_debug.h>
+#include <re_profile.h>
+
+#include "./re_log_binary.h"
+#include "./re_flight_recorder.h"
+#include "../re_internals.h"
+#include "../core/re_time.h"
+#include "../core/re_threads.h"
 
-#include <time.h>
 #include <stdio.h>
+#include <stdlib.h>
 #include <stdarg.h>
+#include <string.h>
 
 #ifdef RE_LOGGER_ENABLED
-#define __RE_LOG_TIME_BUFFER_SIZE 20u
+// ? Callers format straight into a slot of a bounded ring (Vyukov's MPMC
+// ? queue, drained by a single writer). A full ring drops the message and
+// ? counts it instead of blocking the caller.
+#define __RE_LOG_RING_CAPACITY 1024u
+#define __RE_LOG_WRITE_BUFFER_SIZE (64u * 1024u)
+#define __RE_LOG_DRAIN_BATCH_SIZE 256u
+
+// ? Backpressure is bounded: a caller hitting a full ring yields to the
+// ? writer this many times before giving up on the message.
+#define __RE_LOG_FULL_RETRY_COUNT 8u
+
+#define __RE_LOG_WRITER_IDLE_TIMEOUT_MS 100u
+#define __RE_LOG_FLUSH_TIMEOUT_MS 250u
+
+// ? The monotonic and wall clocks drift apart (NTP slewing, manual changes),
+// ? so the writer re-pairs them this often instead of only at init.
+#define __RE_LOG_CLOCK_RESYNC_NS 1000000000ull
+
+// ? A slot holds either a formatted line (site is NULL) or the encoded
+// ? arguments of a binary call site.
+typedef struct __re_LogSlot {
+    atomic_size_t sequence;
+    uint64_t timestamp_ns;
+    __re_LogSite* site;
+    uint32_t length;
+    char data[__RE_LOG_SLOT_PAYLOAD_SIZE];
+} __re_LogSlot;
+
+typedef struct __re_LogRing {
+    _Alignas(RE_CACHE_LINE_SIZE) atomic_size_t enqueue_pos;
+    _Alignas(RE_CACHE_LINE_SIZE) atomic_size_t dequeue_pos;
+    _Alignas(RE_CACHE_LINE_SIZE) atomic_size_t written_pos;
+    _Alignas(RE_CACHE_LINE_SIZE) atomic_uint_fast64_t dropped_count;
+
+    __re_LogSlot slots[__RE_LOG_RING_CAPACITY];
+} __re_LogRing;
+
+// ? Buffered view of the current log stream, only used with the file lock held.
+typedef struct __re_LogOutput {
+    FILE* stream;
+    bool binary;
+
+    char* buffer;
+    size_t capacity;
+    size_t size;
+} __re_LogOutput;
+
+// ? Slots are stamped with the monotonic clock; this pairs one reading of it
+// ? with the wall clock so the writer can turn stamps into dates. Only the
+// ? writer touches it after init.
+typedef struct __re_LogClockBase {
+    uint64_t monotonic_ns;
+    uint64_t wall_ns;
+} __re_LogClockBase;
 
 static FILE* __re_log_file__ = RE_NULL_HANDLE;
-static char __time_buffer[__RE_LOG_TIME_BUFFER_SIZE];
+static bool __re_log_file_binary = false;
+static uint32_t __re_log_file_epoch = 0u;
+static re_SpinLock __re_log_file_lock = RE_SPIN_LOCK_INIT;
+
+static __re_LogRing __re_log_ring;
+static re_Thread __re_log_writer = RE_NULL_HANDLE;
+static re_Semaphore __re_log_wake = RE_NULL_HANDLE;
+
+static atomic_bool __re_log_running = false;
+static atomic_bool __re_log_writer_sleeping = false;
+
+static __re_LogClockBase __re_log_clock_base = { 0u, 0u };
+
+// *=================================================
+// *
+// * __re_openLogOutput
+// *
+// *=================================================
+
+static inline void __re_openLogOutput(__re_LogOutput* output, char* buffer, const size_t capacity) {
+    output->stream = __re_log_file__ != RE_NULL_HANDLE ? __re_log_file__ : stdout;
+    output->binary = __re_log_file__ != RE_NULL_HANDLE && __re_log_file_binary;
+
+    output->buffer = buffer;
+    output->capacity = capacity;
+    output->size = 0;
+}
+
+// *=================================================
+// *
+// * __re_flushLogOutput
+// *
+// *=================================================
+
+static void __re_flushLogOutput(__re_LogOutput* output) {
+    if (output->size > 0) {
+        fwrite(output->buffer, 1, output->size, output->stream);
+        output->size = 0;
+    }
+
+    fflush(output->stream);
+}
+
+// *=================================================
+// *
+// * __re_writeLogBytes
+// *
+// *=================================================
+
+static void __re_writeLogBytes(__re_LogOutput* output, const void* data, const size_t size) {
+    if (output->size + size > output->capacity) {
+        fwrite(output->buffer, 1, output->size, output->stream);
+        output->size = 0;
+    }
+
+    if (size > output->capacity) {
+        fwrite(data, 1, size, output->stream);
+        return;
+    }
+
+    memcpy(output->buffer + output->size, data, size);
+    output->size += size;
+}
+
+// *=================================================
+// *
+// * __re_writeLogTime
+// *
+// *=================================================
+
+static void __re_writeLogTime(__re_LogOutput* output, const uint64_t wall_ns) {
+    char time_buffer[__RE_LOG_TIME_BUFFER_SIZE];
+    const size_t time_length = __re_formatLogTime(time_buffer, wall_ns);
+
+    __re_writeLogBytes(output, time_buffer, time_length);
+    __re_writeLogBytes(output, " - ", 3u);
+}
+
+// *=================================================
+// *
+// * __re_writeLogEntry
+// *
+// *=================================================
+
+static void __re_writeLogEntry(
+    __re_LogOutput* output,
+    __re_LogSite* site,
+    const uint64_t wall_ns,
+    const char* data,
+    const uint32_t length
+) {
+    const uint16_t encoded_length = (uint16_t)length;
+
+    if (output->binary && site != RE_NULL_HANDLE) {
+        // ? Each log file gets the call site's dictionary record once,
+        // ? ahead of the site's first message in that file.
+        if (site->emitted_epoch != __re_log_file_epoch) {
+            site->emitted_epoch = __re_log_file_epoch;
+
+            const uint8_t kind = __RE_LOG_RECORD_SITE;
+            const uint8_t level = (uint8_t)site->level;
+            const uint16_t format_length = (uint16_t)strlen(site->format);
+            const uint16_t file_length = (uint16_t)strlen(site->file);
+
+            __re_writeLogBytes(output, &kind, sizeof(kind));
+            __re_writeLogBytes(output, &site->id, sizeof(site->id));
+            __re_writeLogBytes(output, &site->line, sizeof(site->line));
+            __re_writeLogBytes(output, &level, sizeof(level));
+            __re_writeLogBytes(output, &format_length, sizeof(format_length));
+            __re_writeLogBytes(output, &file_length, sizeof(file_length));
+            __re_writeLogBytes(output, site->format, format_length);
+            __re_writeLogBytes(output, site->file, file_length);
+        }
+
+        const uint8_t kind = __RE_LOG_RECORD_MESSAGE;
+        __re_writeLogBytes(output, &kind, sizeof(kind));
+        __re_writeLogBytes(output, &site->id, sizeof(site->id));
+        __re_writeLogBytes(output, &wall_ns, sizeof(wall_ns));
+        __re_writeLogBytes(output, &encoded_length, sizeof(encoded_length));
+        __re_writeLogBytes(output, data, length);
+    }
+    else if (output->binary) {
+        const uint8_t kind = __RE_LOG_RECORD_TEXT;
+        __re_writeLogBytes(output, &kind, sizeof(kind));
+        __re_writeLogBytes(output, &wall_ns, sizeof(wall_ns));
+        __re_writeLogBytes(output, &encoded_length, sizeof(encoded_length));
+        __re_writeLogBytes(output, data, length);
+    }
+    else if (site != RE_NULL_HANDLE) {
+        char rendered[__RE_LOG_RENDER_BUFFER_SIZE];
+        const size_t rendered_length = __re_renderLogMessage(
+            rendered,
+            sizeof(rendered),
+            site->format,
+            site->file,
+            site->line,
+            site->level,
+            (const uint8_t*)data,
+            length
+        );
+
+        __re_writeLogTime(output, wall_ns);
+        __re_writeLogBytes(output, rendered, rendered_length);
+    }
+    else {
+        __re_writeLogTime(output, wall_ns);
+        __re_writeLogBytes(output, data, length);
+    }
+}
+
+// *=================================================
+// *
+// * __re_writeLogDropped
+// *
+// *=================================================
+
+static void __re_writeLogDropped(__re_LogOutput* output, const uint64_t dropped_count) {
+    if (output->binary) {
+        const uint8_t kind = __RE_LOG_RECORD_DROPPED;
+        __re_writeLogBytes(output, &kind, sizeof(kind));
+        __re_writeLogBytes(output, &dropped_count, sizeof(dropped_count));
+        return;
+    }
+
+    char warning[__RE_LOG_RENDER_BUFFER_SIZE];
+    const int warning_length = snprintf(
+        warning,
+        sizeof(warning),
+        "[WARN]: Logger ring was full, dropped %llu messages\n",
+        (unsigned long long)dropped_count
+    );
+
+    __re_writeLogBytes(output, warning, (size_t)warning_length);
+}
+
+// *=================================================
+// *
+// * __re_isLogSlotReady
+// *
+// *=================================================
+
+static inline bool __re_isLogSlotReady(const size_t pos) {
+    const __re_LogSlot* slot = &__re_log_ring.slots[pos & (__RE_LOG_RING_CAPACITY - 1u)];
+
+    return atomic_load_explicit(&slot->sequence, memory_order_acquire) == pos + 1u;
+}
+
+// *=================================================
+// *
+// * __re_syncLogClockBase
+// *
+// *=================================================
+
+static void __re_syncLogClockBase() {
+    __re_log_clock_base.monotonic_ns = __re_getMonotonicNs();
+    __re_log_clock_base.wall_ns = __re_getRealtimeNs();
+}
+
+// *=================================================
+// *
+// * __re_drainLogRing
+// *
+// *=================================================
+
+static bool __re_drainLogRing(char* buffer) {
+    size_t pos = atomic_load_explicit(&__re_log_ring.dequeue_pos, memory_order_relaxed);
+    const uint64_t dropped_count = atomic_exchange_explicit(&__re_log_ring.dropped_count, 0u, memory_order_relaxed);
+
+    if (dropped_count == 0 && !__re_isLogSlotReady(pos)) {
+        return false;
+    }
+
+    // ? Stamps taken before a resync are converted with the new pair, which
+    // ? only moves them by the drift of one interval.
+    if (__re_getMonotonicNs() - __re_log_clock_base.monotonic_ns >= __RE_LOG_CLOCK_RESYNC_NS) {
+        __re_syncLogClockBase();
+    }
+
+    __re_lockSpinLock(&__re_log_file_lock);
+
+    __re_LogOutput output;
+    __re_openLogOutput(&output, buffer, __RE_LOG_WRITE_BUFFER_SIZE);
+
+    if (dropped_count > 0) {
+        __re_writeLogDropped(&output, dropped_count);
+    }
+
+    for (uint32_t idx = 0; idx < __RE_LOG_DRAIN_BATCH_SIZE && __re_isLogSlotReady(pos); ++idx) {
+        __re_LogSlot* slot = &__re_log_ring.slots[pos & (__RE_LOG_RING_CAPACITY - 1u)];
+
+        const uint64_t wall_ns = __re_log_clock_base.wall_ns + (slot->timestamp_ns - __re_log_clock_base.monotonic_ns);
+        __re_writeLogEntry(&output, slot->site, wall_ns, slot->data, slot->length);
+
+        atomic_store_explicit(&slot->sequence, pos + __RE_LOG_RING_CAPACITY, memory_order_release);
+        ++pos;
+    }
+
+    atomic_store_explicit(&__re_log_ring.dequeue_pos, pos, memory_order_relaxed);
+
+    __re_flushLogOutput(&output);
+    __re_unlockSpinLock(&__re_log_file_lock);
+
+    atomic_store_explicit(&__re_log_ring.written_pos, pos, memory_order_release);
+
+    return true;
+}
+
+// *=================================================
+// *
+// * __re_runLogWriter
+// *
+// *=================================================
+
+static void __re_runLogWriter(void* user_data) {
+    (void)user_data;
+
+    char* buffer = (char*)re_malloc(__RE_LOG_WRITE_BUFFER_SIZE);
+
+    for (;;) {
+        if (__re_drainLogRing(buffer)) {
+            continue;
+        }
+
+        if (!atomic_load_explicit(&__re_log_running, memory_order_acquire)) {
+            break;
+        }
+
+        // ? Announce the sleep before the final emptiness check; producers
+        // ? publish before checking the flag, so one side always sees the other.
+        atomic_store_explicit(&__re_log_writer_sleeping, true, memory_order_relaxed);
+        atomic_thread_fence(memory_order_seq_cst);
+
+        const size_t pos = atomic_load_explicit(&__re_log_ring.dequeue_pos, memory_order_relaxed);
+        if (!__re_isLogSlotReady(pos) && atomic_load_explicit(&__re_log_running, memory_order_relaxed)) {
+            __re_waitSemaphore(__re_log_wake, __RE_LOG_WRITER_IDLE_TIMEOUT_MS);
+        }
+
+        atomic_store_explicit(&__re_log_writer_sleeping, false, memory_order_relaxed);
+    }
+
+    re_free(buffer);
+}
+
+// *=================================================
+// *
+// * __re_wakeLogWriter
+// *
+// *=================================================
+
+static inline void __re_wakeLogWriter() {
+    atomic_thread_fence(memory_order_seq_cst);
+
+    if (
+        atomic_load_explicit(&__re_log_writer_sleeping, memory_order_relaxed) &&
+        atomic_exchange_explicit(&__re_log_writer_sleeping, false, memory_order_relaxed)
+    ) {
+        __re_signalSemaphore(__re_log_wake);
+    }
+}
+
+// *=================================================
+// *
+// * __re_claimLogSlot
+// *
+// *=================================================
+
+static __re_LogSlot* __re_claimLogSlot(size_t* claimed_pos) {
+    size_t pos = atomic_load_explicit(&__re_log_ring.enqueue_pos, memory_order_relaxed);
+    uint32_t full_retries = 0;
+
+    for (;;) {
+        __re_LogSlot* slot = &__re_log_ring.slots[pos & (__RE_LOG_RING_CAPACITY - 1u)];
+
+        const size_t sequence = atomic_load_explicit(&slot->sequence, memory_order_acquire);
+        const intptr_t difference = (intptr_t)sequence - (intptr_t)pos;
+
+        if (difference == 0) {
+            if (atomic_compare_exchange_weak_explicit(
+                &__re_log_ring.enqueue_pos,
+                &pos,
+                pos + 1u,
+                memory_order_relaxed,
+                memory_order_relaxed
+            )) {
+                *claimed_pos = pos;
+                return slot;
+            }
+        }
+        else if (difference < 0 && full_retries < __RE_LOG_FULL_RETRY_COUNT) {
+            ++full_retries;
+
+            __re_wakeLogWriter();
+            __re_yieldThread();
+
+            pos = atomic_load_explicit(&__re_log_ring.enqueue_pos, memory_order_relaxed);
+        }
+        else if (difference < 0) {
+            atomic_fetch_add_explicit(&__re_log_ring.dropped_count, 1u, memory_order_relaxed);
+            return RE_NULL_HANDLE;
+        }
+        else {
+            pos = atomic_load_explicit(&__re_log_ring.enqueue_pos, memory_order_relaxed);
+        }
+    }
+}
+
+// *=================================================
+// *
+// * __re_publishLogSlot
+// *
+// *=================================================
+
+static inline void __re_publishLogSlot(__re_LogSlot* slot, const size_t pos) {
+    __re_recordFlightLog(slot->site, slot->data, slot->length, slot->timestamp_ns);
+
+    atomic_store_explicit(&slot->sequence, pos + 1u, memory_order_release);
+    __re_wakeLogWriter();
+}
+
+// *=================================================
+// *
+// * __re_formatLogText
+// *
+// *=================================================
+
+static uint32_t __re_formatLogText(char* data, const char* format, va_list args) {
+    const int length = vsnprintf(data, __RE_LOG_SLOT_PAYLOAD_SIZE, format, args);
+
+    if (length < 0) {
+        return 0;
+    }
+
+    if ((size_t)length >= __RE_LOG_SLOT_PAYLOAD_SIZE) {
+        // ? Truncated messages still end their line.
+        data[__RE_LOG_SLOT_PAYLOAD_SIZE - 2u] = '\n';
+        return __RE_LOG_SLOT_PAYLOAD_SIZE - 1u;
+    }
+
+    return (uint32_t)length;
+}
+
+// *=================================================
+// *
+// * __re_logSynchronous
+// *
+// *=================================================
+
+static void __re_logSynchronous(__re_LogSite* site, const char* data, const uint32_t length) {
+    __re_recordFlightLog(site, data, length, __re_getMonotonicNs());
+
+    char buffer[__RE_LOG_RENDER_BUFFER_SIZE];
+
+    __re_lockSpinLock(&__re_log_file_lock);
+
+    __re_LogOutput output;
+    __re_openLogOutput(&output, buffer, sizeof(buffer));
+
+    __re_writeLogEntry(&output, site, __re_getRealtimeNs(), data, length);
+
+    __re_flushLogOutput(&output);
+    __re_unlockSpinLock(&__re_log_file_lock);
+}
+
+// *=================================================
+// *
+// * __re_shutdownLogger
+// *
+// *=================================================
+
+static void __re_shutdownLogger() {
+    if (!atomic_exchange_explicit(&__re_log_running, false, memory_order_acq_rel)) {
+        return;
+    }
+
+    __re_signalSemaphore(__re_log_wake);
+    __re_joinThread(&__re_log_writer);
+    __re_destroySemaphore(&__re_log_wake);
+
+    re_closeLogFile();
+}
+
+// *=================================================
+// *
+// * __re_initLogger
+// *
+// *=================================================
+
+static void __re_initLogger() {
+    for (size_t idx = 0; idx < __RE_LOG_RING_CAPACITY; ++idx) {
+        atomic_init(&__re_log_ring.slots[idx].sequence, idx);
+    }
+
+    __re_log_wake = __re_createSemaphore();
+
+    __re_syncLogClockBase();
+
+    atomic_store_explicit(&__re_log_running, true, memory_order_release);
+    __re_log_writer = __re_createThread(__re_runLogWriter, RE_NULL_HANDLE);
+
+    atexit(__re_shutdownLogger);
+}
 #endif
 
 // *=================================================
@@ -19,42 +520,103 @@ static char __time_buffer[__RE_LOG_TIME_BUFFER_SIZE];
 
 void __re_internalLog(const char* format, ...) {
     #ifdef RE_LOGGER_ENABLED
-    time_t now = time(RE_NULL_HANDLE);
-    struct tm local_time;
-    
-    #if RE_PLATFORM == RE_PLATFORM_WINDOWS
-    localtime_s(&local_time, &now);
-    #else
-    localtime_r(&now, &local_time);
+    va_list args;
+    va_start(args, format);
+
+    // ? Before re_debugInit (and after shutdown) there is no writer thread,
+    // ? so messages go out on the calling thread as before.
+    if (!atomic_load_explicit(&__re_log_running, memory_order_acquire)) {
+        char data[__RE_LOG_SLOT_PAYLOAD_SIZE];
+        const uint32_t length = __re_formatLogText(data, format, args);
+        va_end(args);
+
+        __re_logSynchronous(RE_NULL_HANDLE, data, length);
+        return;
+    }
+
+    size_t pos = 0;
+    __re_LogSlot* slot = __re_claimLogSlot(&pos);
+
+    if (slot == RE_NULL_HANDLE) {
+        va_end(args);
+        return;
+    }
+
+    slot->timestamp_ns = __re_getMonotonicNs();
+    slot->site = RE_NULL_HANDLE;
+    slot->length = __re_formatLogText(slot->data, format, args);
+    va_end(args);
+
+    __re_publishLogSlot(slot, pos);
     #endif
+}
+
+// *=================================================
+// *
+// * __re_internalLogBinary
+// *
+// *=================================================
 
-    strftime(__time_buffer, __RE_LOG_TIME_BUFFER_SIZE, "%Y-%m-%d %H:%M:%S", &local_time);
+void __re_internalLogBinary(__re_LogSite* site, ...) {
+    #ifdef RE_LOGGER_ENABLED
+    __re_registerLogSite(site);
 
     va_list args;
-    va_start(args, format);
+    va_start(args, site);
+
+    if (!atomic_load_explicit(&__re_log_running, memory_order_acquire)) {
+        uint8_t payload[__RE_LOG_SLOT_PAYLOAD_SIZE];
+        const uint32_t length = __re_encodeLogArgs(site, args, payload, sizeof(payload));
+        va_end(args);
 
-    if (__re_log_file__ == RE_NULL_HANDLE) {
-        #if RE_PLATFORM == RE_PLATFORM_WINDOWS
-        printf_s("%s - ", __time_buffer);
-        vprintf_s(format, args);
-        #else
-        printf("%s - ", __time_buffer);
-        vprintf(format, args);
-        #endif
+        __re_logSynchronous(site, (const char*)payload, length);
+        return;
     }
-    else {
-        #if RE_PLATFORM == RE_PLATFORM_WINDOWS
-        fprintf_s(__re_log_file__, "%s - ", __time_buffer);
-        vfprintf_s(__re_log_file__, format, args);
-        #else
-        fprintf(__re_log_file__, "%s - ", __time_buffer);
-        vfprintf(__re_log_file__, format, args);
-        #endif
 
-        fflush(__re_log_file__);
+    size_t pos = 0;
+    __re_LogSlot* slot = __re_claimLogSlot(&pos);
+
+    if (slot == RE_NULL_HANDLE) {
+        va_end(args);
+        return;
     }
 
+    slot->timestamp_ns = __re_getMonotonicNs();
+    slot->site = site;
+    slot->length = __re_encodeLogArgs(site, args, (uint8_t*)slot->data, __RE_LOG_SLOT_PAYLOAD_SIZE);
     va_end(args);
+
+    __re_publishLogSlot(slot, pos);
+    #else
+    (void)site;
+    #endif
+}
+
+// *=================================================
+// *
+// * re_flushLog
+// *
+// *=================================================
+
+void re_flushLog() {
+    #ifdef RE_LOGGER_ENABLED
+    if (!atomic_load_explicit(&__re_log_running, memory_order_acquire)) {
+        return;
+    }
+
+    const size_t target_pos = atomic_load_explicit(&__re_log_ring.enqueue_pos, memory_order_acquire);
+
+    atomic_store_explicit(&__re_log_writer_sleeping, false, memory_order_relaxed);
+    __re_signalSemaphore(__re_log_wake);
+
+    // ? Bounded so that a thread dying mid-message cannot hang an assert.
+    for (uint32_t waited_ms = 0; waited_ms < __RE_LOG_FLUSH_TIMEOUT_MS; ++waited_ms) {
+        if (atomic_load_explicit(&__re_log_ring.written_pos, memory_order_acquire) >= target_pos) {
+            return;
+        }
+
+        __re_sleepThread(1u);
+    }
     #endif
 }
 
@@ -66,10 +628,17 @@ void __re_internalLog(const char* format, ...) {
 
 void re_closeLogFile() {
     #ifdef RE_LOGGER_ENABLED
+    re_flushLog();
+
+    __re_lockSpinLock(&__re_log_file_lock);
+
     if (__re_log_file__ != RE_NULL_HANDLE) {
         fclose(__re_log_file__);
         __re_log_file__ = RE_NULL_HANDLE;
+        __re_log_file_binary = false;
     }
+
+    __re_unlockSpinLock(&__re_log_file_lock);
     #endif
 }
 
@@ -83,14 +652,60 @@ void re_setLogFile(const char* file_path) {
     #ifdef RE_LOGGER_ENABLED
     re_closeLogFile();
 
+    #ifdef RE_LOG_BINARY_ENABLED
+    const char* file_mode = "wb";
+    #else
+    const char* file_mode = "w";
+    #endif
+
+    FILE* log_file = RE_NULL_HANDLE;
+
     #if RE_PLATFORM == RE_PLATFORM_WINDOWS
-    fopen_s(&__re_log_file__, file_path, "w");
+    fopen_s(&log_file, file_path, file_mode);
     #else
-    fopen(file_path, "w");
+    log_file = fopen(file_path, file_mode);
     #endif
 
-    if (__re_log_file__ == RE_NULL_HANDLE) {
+    if (log_file == RE_NULL_HANDLE) {
         re_logError("Failed to open logging file: %s", file_path);
+        return;
     }
+
+    __re_lockSpinLock(&__re_log_file_lock);
+
+    __re_log_file__ = log_file;
+
+    #ifdef RE_LOG_BINARY_ENABLED
+    const uint32_t magic = __RE_LOG_BINARY_MAGIC;
+    const uint32_t version = __RE_LOG_BINARY_VERSION;
+    fwrite(&magic, sizeof(magic), 1, log_file);
+    fwrite(&version, sizeof(version), 1, log_file);
+
+    __re_log_file_binary = true;
+    ++__re_log_file_epoch;
+    #endif
+
+    __re_unlockSpinLock(&__re_log_file_lock);
     #endif
+}
+
+// *=================================================
+// *
+// * re_debugInit
+// *
+// *=================================================
+
+void re_debugInit() {
+    RE_MODULE_INIT_GUARD(RE_DEBUG_MODULE, 0u);
+    RE_MEMORY_MODULE_BEGIN(RE_DEBUG_MODULE);
+    RE_PROFILE_FUNCTION_BEGIN();
+
+    __re_initFlightRecorder();
+
+    #ifdef RE_LOGGER_ENABLED
+    __re_initLogger();
+    #endif
+
+    RE_PROFILE_END();
+    RE_MEMORY_MODULE_END();
 }
\ No newline at end of file
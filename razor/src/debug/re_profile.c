@@ -0,0 +1,581 @@
+#include <re_profile.h>
+
+#include <re_debug.h>
+#include "../re_internals.h"
+#include "../core/re_time.h"
+#include "../core/re_threads.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#define __RE_PROFILE_MAX_THREADS 64u
+#define __RE_PROFILE_MAX_DEPTH 64u
+#define __RE_PROFILE_MAX_TRACKS 16u
+
+// ? Address space reserved per thread; pages are only committed as scopes
+// ? are recorded. Scopes past the end are dropped.
+#define __RE_PROFILE_THREAD_BUFFER_SIZE (64u * 1024u * 1024u)
+
+#define __RE_PROFILE_STATS_INITIAL_CAPACITY 64u
+
+typedef struct __re_ProfileEvent {
+    const char* name;
+    uint32_t track;
+    uint64_t start_ns;
+    uint64_t duration_ns;
+    uint64_t self_ns;
+} __re_ProfileEvent;
+
+typedef struct __re_ProfileFrame {
+    const char* name;
+    uint64_t start_ns;
+    uint64_t child_ns;
+} __re_ProfileFrame;
+
+// ? Only the owning thread writes a profile. Readers see the events below
+// ? event_count (published with release) from the stable virtual buffer base.
+typedef struct __re_ProfileThread {
+    re_VirtualBuffer events;
+    atomic_size_t event_count;
+    atomic_uint epoch;
+
+    uint32_t thread_index;
+    uint32_t depth;
+    __re_ProfileFrame stack[__RE_PROFILE_MAX_DEPTH];
+} __re_ProfileThread;
+
+static _Atomic(__re_ProfileThread*) __re_profile_threads[__RE_PROFILE_MAX_THREADS];
+static RE_THREAD_LOCAL __re_ProfileThread* __re_profile_thread = RE_NULL_HANDLE;
+
+// ? Clearing bumps the epoch; each thread drops its own events the next time
+// ? it records, so clearing never races a writer.
+static atomic_uint __re_profile_epoch = 0u;
+
+// ? Track names are written before the count that publishes them.
+static const char* __re_profile_track_names[__RE_PROFILE_MAX_TRACKS];
+static atomic_uint __re_profile_track_count = 1u;
+static re_SpinLock __re_profile_track_lock = RE_SPIN_LOCK_INIT;
+
+// *=================================================
+// *
+// * __re_getProfileThread
+// *
+// *=================================================
+
+static __re_ProfileThread* __re_getProfileThread() {
+    if (__re_profile_thread != RE_NULL_HANDLE) {
+        return __re_profile_thread;
+    }
+
+    const uint32_t thread_index = __re_getThreadIndex();
+
+    if (thread_index >= __RE_PROFILE_MAX_THREADS) {
+        return RE_NULL_HANDLE;
+    }
+
+    // ? A thread reusing an exited thread's index continues its profile.
+    __re_ProfileThread* existing_profile = atomic_load_explicit(&__re_profile_threads[thread_index], memory_order_acquire);
+
+    if (existing_profile != RE_NULL_HANDLE) {
+        __re_profile_thread = existing_profile;
+        return existing_profile;
+    }
+
+    RE_MEMORY_MODULE_BEGIN(RE_DEBUG_MODULE);
+
+    // ? Profiles outlive their threads so that exports still see them.
+    __re_ProfileThread* profile = (__re_ProfileThread*)re_calloc(1, sizeof(__re_ProfileThread));
+    profile->events = re_createVirtualBuffer(__RE_PROFILE_THREAD_BUFFER_SIZE);
+    profile->thread_index = thread_index;
+    atomic_init(&profile->epoch, atomic_load_explicit(&__re_profile_epoch, memory_order_relaxed));
+
+    RE_MEMORY_MODULE_END();
+
+    atomic_store_explicit(&__re_profile_threads[thread_index], profile, memory_order_release);
+    __re_profile_thread = profile;
+
+    return profile;
+}
+
+// *=================================================
+// *
+// * __re_loadProfileEvents
+// *
+// *=================================================
+
+static const __re_ProfileEvent* __re_loadProfileEvents(const __re_ProfileThread* profile, size_t* event_count) {
+    const uint32_t epoch = atomic_load_explicit(&__re_profile_epoch, memory_order_acquire);
+
+    if (atomic_load_explicit(&profile->epoch, memory_order_acquire) != epoch) {
+        *event_count = 0;
+        return RE_NULL_HANDLE;
+    }
+
+    *event_count = atomic_load_explicit(&profile->event_count, memory_order_acquire);
+    return (const __re_ProfileEvent*)re_getVirtualBufferData(profile->events);
+}
+
+// *=================================================
+// *
+// * __re_pushProfileEvent
+// *
+// *=================================================
+
+static __re_ProfileEvent* __re_pushProfileEvent(__re_ProfileThread* profile) {
+    const uint32_t epoch = atomic_load_explicit(&__re_profile_epoch, memory_order_relaxed);
+
+    if (atomic_load_explicit(&profile->epoch, memory_order_relaxed) != epoch) {
+        re_resizeVirtualBuffer(profile->events, 0);
+
+        atomic_store_explicit(&profile->event_count, 0, memory_order_relaxed);
+        atomic_store_explicit(&profile->epoch, epoch, memory_order_release);
+    }
+
+    return (__re_ProfileEvent*)re_virtualBufferPush(profile->events, sizeof(__re_ProfileEvent));
+}
+
+// *=================================================
+// *
+// * __re_publishProfileEvent
+// *
+// *=================================================
+
+static void __re_publishProfileEvent(__re_ProfileThread* profile) {
+    const size_t event_count = atomic_load_explicit(&profile->event_count, memory_order_relaxed);
+    atomic_store_explicit(&profile->event_count, event_count + 1u, memory_order_release);
+}
+
+// *=================================================
+// *
+// * re_profileBegin
+// *
+// *=================================================
+
+void re_profileBegin(const char* name) {
+    __re_ProfileThread* profile = __re_getProfileThread();
+
+    if (profile == RE_NULL_HANDLE) {
+        return;
+    }
+
+    // ? Scopes nested past the stack are counted so that END stays balanced,
+    // ? but they are not measured.
+    if (profile->depth < __RE_PROFILE_MAX_DEPTH) {
+        __re_ProfileFrame* frame = &profile->stack[profile->depth];
+        frame->name = name;
+        frame->child_ns = 0;
+        frame->start_ns = __re_getMonotonicNs();
+    }
+
+    ++profile->depth;
+}
+
+// *=================================================
+// *
+// * re_profileEnd
+// *
+// *=================================================
+
+void re_profileEnd() {
+    const uint64_t end_ns = __re_getMonotonicNs();
+    __re_ProfileThread* profile = __re_profile_thread;
+
+    if (profile == RE_NULL_HANDLE) {
+        return;
+    }
+
+    re_assert(profile->depth > 0, "Attempting to end a profiling scope that was never begun!");
+
+    if (--profile->depth >= __RE_PROFILE_MAX_DEPTH) {
+        return;
+    }
+
+    const __re_ProfileFrame* frame = &profile->stack[profile->depth];
+    const uint64_t duration_ns = end_ns - frame->start_ns;
+
+    if (profile->depth > 0) {
+        profile->stack[profile->depth - 1u].child_ns += duration_ns;
+    }
+
+    __re_ProfileEvent* event = __re_pushProfileEvent(profile);
+
+    if (event == RE_NULL_HANDLE) {
+        return;
+    }
+
+    event->name = frame->name;
+    event->track = RE_PROFILE_TRACK_THREAD;
+    event->start_ns = frame->start_ns;
+    event->duration_ns = duration_ns;
+    event->self_ns = duration_ns - frame->child_ns;
+
+    __re_publishProfileEvent(profile);
+}
+
+// *=================================================
+// *
+// * re_createProfileTrack
+// *
+// *=================================================
+
+uint32_t re_createProfileTrack(const char* name) {
+    re_assert(name != RE_NULL_HANDLE, "Attempting to create a profile track without a name!");
+
+    __re_lockSpinLock(&__re_profile_track_lock);
+
+    const uint32_t track = atomic_load_explicit(&__re_profile_track_count, memory_order_relaxed);
+
+    if (track == __RE_PROFILE_MAX_TRACKS) {
+        __re_unlockSpinLock(&__re_profile_track_lock);
+        re_logWarn("Out of profile tracks, \"%s\" is recorded on its thread instead", name);
+
+        return RE_PROFILE_TRACK_THREAD;
+    }
+
+    __re_profile_track_names[track] = name;
+    atomic_store_explicit(&__re_profile_track_count, track + 1u, memory_order_release);
+
+    __re_unlockSpinLock(&__re_profile_track_lock);
+
+    return track;
+}
+
+// *=================================================
+// *
+// * re_profileRecord
+// *
+// *=================================================
+
+void re_profileRecord(
+    const char* name,
+    const uint32_t track,
+    const uint64_t start_ns,
+    const uint64_t duration_ns,
+    const uint64_t self_ns
+) {
+    re_assert(track < __RE_PROFILE_MAX_TRACKS, "Unknown profile track: %u", track);
+
+    __re_ProfileThread* profile = __re_getProfileThread();
+
+    if (profile == RE_NULL_HANDLE) {
+        return;
+    }
+
+    __re_ProfileEvent* event = __re_pushProfileEvent(profile);
+
+    if (event == RE_NULL_HANDLE) {
+        return;
+    }
+
+    event->name = name;
+    event->track = track;
+    event->start_ns = start_ns;
+    event->duration_ns = duration_ns;
+    event->self_ns = self_ns;
+
+    __re_publishProfileEvent(profile);
+}
+
+// *=================================================
+// *
+// * re_getProfileTime
+// *
+// *=================================================
+
+uint64_t re_getProfileTime() {
+    return __re_getMonotonicNs();
+}
+
+// *=================================================
+// *
+// * re_clearProfile
+// *
+// *=================================================
+
+void re_clearProfile() {
+    atomic_fetch_add_explicit(&__re_profile_epoch, 1u, memory_order_acq_rel);
+}
+
+// *=================================================
+// *
+// * __re_findProfileStats
+// *
+// *=================================================
+
+static uint32_t __re_findProfileStats(
+    const re_ProfileScopeStats* stats,
+    const uint32_t stats_count,
+    const char* name,
+    const uint32_t track
+) {
+    // ? Call sites usually share one string literal, so compare pointers first.
+    for (uint32_t idx = 0; idx < stats_count; ++idx) {
+        if (stats[idx].name == name && stats[idx].track == track) {
+            return idx;
+        }
+    }
+
+    for (uint32_t idx = 0; idx < stats_count; ++idx) {
+        if (stats[idx].track == track && strcmp(stats[idx].name, name) == 0) {
+            return idx;
+        }
+    }
+
+    return UINT32_MAX;
+}
+
+// *=================================================
+// *
+// * re_getProfileStats
+// *
+// *=================================================
+
+uint32_t re_getProfileStats(re_ProfileScopeStats* stats, const uint32_t max_count) {
+    re_assert(stats != RE_NULL_HANDLE || max_count == 0, "Attempting to get profile stats into NULL array!");
+
+    RE_MEMORY_MODULE_BEGIN(RE_DEBUG_MODULE);
+
+    uint32_t stats_capacity = __RE_PROFILE_STATS_INITIAL_CAPACITY;
+    uint32_t stats_count = 0;
+    re_ProfileScopeStats* all_stats = (re_ProfileScopeStats*)re_malloc(stats_capacity * sizeof(re_ProfileScopeStats));
+
+    for (uint32_t thread_idx = 0; thread_idx < __RE_PROFILE_MAX_THREADS; ++thread_idx) {
+        const __re_ProfileThread* profile = atomic_load_explicit(&__re_profile_threads[thread_idx], memory_order_acquire);
+
+        if (profile == RE_NULL_HANDLE) {
+            continue;
+        }
+
+        size_t event_count = 0;
+        const __re_ProfileEvent* events = __re_loadProfileEvents(profile, &event_count);
+
+        for (size_t event_idx = 0; event_idx < event_count; ++event_idx) {
+            const __re_ProfileEvent* event = &events[event_idx];
+            uint32_t stats_idx = __re_findProfileStats(all_stats, stats_count, event->name, event->track);
+
+            if (stats_idx == UINT32_MAX) {
+                if (stats_count == stats_capacity) {
+                    stats_capacity *= 2u;
+                    all_stats = (re_ProfileScopeStats*)re_realloc(all_stats, stats_capacity * sizeof(re_ProfileScopeStats));
+                }
+
+                stats_idx = stats_count++;
+                re_memset(&all_stats[stats_idx], 0, sizeof(re_ProfileScopeStats));
+
+                all_stats[stats_idx].name = event->name;
+                all_stats[stats_idx].track = event->track;
+                all_stats[stats_idx].min_ns = UINT64_MAX;
+            }
+
+            re_ProfileScopeStats* scope_stats = &all_stats[stats_idx];
+
+            ++scope_stats->call_count;
+            scope_stats->total_ns += event->duration_ns;
+            scope_stats->self_ns += event->self_ns;
+
+            if (event->duration_ns < scope_stats->min_ns) {
+                scope_stats->min_ns = event->duration_ns;
+            }
+            if (event->duration_ns > scope_stats->max_ns) {
+                scope_stats->max_ns = event->duration_ns;
+            }
+        }
+    }
+
+    if (stats_count > 0 && max_count > 0) {
+        re_memcpy(stats, all_stats, (stats_count < max_count ? stats_count : max_count) * sizeof(re_ProfileScopeStats));
+    }
+
+    re_free(all_stats);
+
+    RE_MEMORY_MODULE_END();
+
+    return stats_count;
+}
+
+// *=================================================
+// *
+// * re_logProfileReport
+// *
+// *=================================================
+
+void re_logProfileReport() {
+    const uint32_t max_count = re_getProfileStats(RE_NULL_HANDLE, 0);
+
+    if (max_count == 0) {
+        re_logInfo("Profile report: no scopes recorded");
+        return;
+    }
+
+    RE_MEMORY_MODULE_BEGIN(RE_DEBUG_MODULE);
+
+    re_ProfileScopeStats* stats = (re_ProfileScopeStats*)re_malloc(max_count * sizeof(re_ProfileScopeStats));
+
+    // ? Scopes recorded in between the two calls are left out.
+    const uint32_t __stats_count = re_getProfileStats(stats, max_count);
+    const uint32_t stats_count = __stats_count < max_count ? __stats_count : max_count;
+
+    for (uint32_t idx = 1; idx < stats_count; ++idx) {
+        const re_ProfileScopeStats scope_stats = stats[idx];
+
+        uint32_t jdx = idx;
+        for (; jdx > 0 && stats[jdx - 1u].total_ns < scope_stats.total_ns; --jdx) {
+            stats[jdx] = stats[jdx - 1u];
+        }
+
+        stats[jdx] = scope_stats;
+    }
+
+    re_logInfo("Profile report (%u scopes):", stats_count);
+    re_logInfo("  %-40s %12s %12s %8s  %s", "Scope", "Total (ms)", "Self (ms)", "Calls", "Track");
+
+    for (uint32_t idx = 0; idx < stats_count; ++idx) {
+        const re_ProfileScopeStats* scope_stats = &stats[idx];
+
+        re_logInfo(
+            "  %-40s %12.3f %12.3f %8llu  %s",
+            scope_stats->name,
+            (double)scope_stats->total_ns / 1000000.0,
+            (double)scope_stats->self_ns / 1000000.0,
+            (unsigned long long)scope_stats->call_count,
+            scope_stats->track == RE_PROFILE_TRACK_THREAD ? "Thread" : __re_profile_track_names[scope_stats->track]
+        );
+    }
+
+    re_free(stats);
+
+    RE_MEMORY_MODULE_END();
+}
+
+// *=================================================
+// *
+// * __re_writeProfileString
+// *
+// *=================================================
+
+static void __re_writeProfileString(FILE* file, const char* str) {
+    fputc('"', file);
+
+    for (const char* ch = str; *ch != '\0'; ++ch) {
+        if (*ch == '"' || *ch == '\\') {
+            fputc('\\', file);
+            fputc(*ch, file);
+        }
+        else if ((unsigned char)*ch < 0x20u) {
+            fprintf(file, "\\u%04x", (unsigned int)(unsigned char)*ch);
+        }
+        else {
+            fputc(*ch, file);
+        }
+    }
+
+    fputc('"', file);
+}
+
+// *=================================================
+// *
+// * re_exportProfileTrace
+// *
+// *=================================================
+
+bool re_exportProfileTrace(const char* file_path) {
+    re_assert(file_path != RE_NULL_HANDLE, "Attempting to export profile trace to NULL path!");
+
+    FILE* file = RE_NULL_HANDLE;
+
+    #if RE_PLATFORM == RE_PLATFORM_WINDOWS
+    fopen_s(&file, file_path, "w");
+    #else
+    file = fopen(file_path, "w");
+    #endif
+
+    if (file == RE_NULL_HANDLE) {
+        re_logError("Failed to open profile trace file: %s", file_path);
+        return false;
+    }
+
+    // ? Trace timestamps are microseconds; starting them at the earliest scope
+    // ? keeps the numbers readable.
+    uint64_t base_ns = UINT64_MAX;
+
+    for (uint32_t thread_idx = 0; thread_idx < __RE_PROFILE_MAX_THREADS; ++thread_idx) {
+        const __re_ProfileThread* profile = atomic_load_explicit(&__re_profile_threads[thread_idx], memory_order_acquire);
+
+        if (profile == RE_NULL_HANDLE) {
+            continue;
+        }
+
+        size_t event_count = 0;
+        const __re_ProfileEvent* events = __re_loadProfileEvents(profile, &event_count);
+
+        for (size_t event_idx = 0; event_idx < event_count; ++event_idx) {
+            if (events[event_idx].start_ns < base_ns) {
+                base_ns = events[event_idx].start_ns;
+            }
+        }
+    }
+
+    fputs("{\"displayTimeUnit\":\"ns\",\"traceEvents\":[", file);
+    bool first_event = true;
+
+    for (uint32_t thread_idx = 0; thread_idx < __RE_PROFILE_MAX_THREADS; ++thread_idx) {
+        const __re_ProfileThread* profile = atomic_load_explicit(&__re_profile_threads[thread_idx], memory_order_acquire);
+
+        if (profile == RE_NULL_HANDLE) {
+            continue;
+        }
+
+        fprintf(
+            file,
+            "%s\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%u,\"args\":{\"name\":\"Thread %u\"}}",
+            first_event ? "" : ",",
+            profile->thread_index,
+            profile->thread_index
+        );
+        first_event = false;
+
+        size_t event_count = 0;
+        const __re_ProfileEvent* events = __re_loadProfileEvents(profile, &event_count);
+
+        for (size_t event_idx = 0; event_idx < event_count; ++event_idx) {
+            const __re_ProfileEvent* event = &events[event_idx];
+            const uint64_t start_ns = event->start_ns - base_ns;
+
+            // ? Tracks get thread IDs past every real thread's.
+            const bool on_thread = event->track == RE_PROFILE_TRACK_THREAD;
+
+            fputs(",\n{\"name\":", file);
+            __re_writeProfileString(file, event->name);
+            fprintf(
+                file,
+                ",\"cat\":\"%s\",\"ph\":\"X\",\"pid\":1,\"tid\":%u,\"ts\":%llu.%03llu,\"dur\":%llu.%03llu}",
+                on_thread ? "cpu" : "track",
+                on_thread ? profile->thread_index : __RE_PROFILE_MAX_THREADS + event->track,
+                (unsigned long long)(start_ns / 1000u),
+                (unsigned long long)(start_ns % 1000u),
+                (unsigned long long)(event->duration_ns / 1000u),
+                (unsigned long long)(event->duration_ns % 1000u)
+            );
+        }
+    }
+
+    const uint32_t track_count = atomic_load_explicit(&__re_profile_track_count, memory_order_acquire);
+
+    for (uint32_t track = 1; track < track_count; ++track) {
+        fprintf(
+            file,
+            "%s\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%u,\"args\":{\"name\":",
+            first_event ? "" : ",",
+            __RE_PROFILE_MAX_THREADS + track
+        );
+        __re_writeProfileString(file, __re_profile_track_names[track]);
+        fputs("}}", file);
+
+        first_event = false;
+    }
+
+    fputs("\n]}\n", file);
+    fclose(file);
+
+    return true;
+}
\ No newline at end of file
@@ -1,6 +1,7 @@
 #include <re_graphics.h>
 
 #include <re_debug.h>
+#include <re_profile.h>
 #include "./re_rhi.h"
 #include "../re_internals.h"
 #include "./re_graphics_types.h"
@@ -9,8 +10,12 @@
 #include "./vulkan/re_vulkan.h"
 #endif
 
+#define __RE_GRAPHICS_INSTANCE_POOL_BLOCK_SIZE 8u
+
 re_RHIVirtualTable RE_GRAPHICS_RHI = {0};
 
+static re_Pool __re_graphics_instance_pool = RE_NULL_HANDLE;
+
 // *=================================================
 // *
 // * __re_selectRenderBackend
@@ -40,9 +45,20 @@ bool __re_selectRenderBackend() {
 
 void re_graphicsInit() {
     RE_MODULE_INIT_GUARD(RE_GRAPHICS_MODULE, RE_CORE_MODULE);
+    RE_MEMORY_MODULE_BEGIN(RE_GRAPHICS_MODULE);
+    RE_PROFILE_FUNCTION_BEGIN();
 
     const bool backend_selected = __re_selectRenderBackend();
     re_assert(backend_selected, "No rendering backend available!");
+
+    re_PoolCreateInfo pool_create_info = {0};
+    pool_create_info.slot_size = sizeof(re_GraphicsInstance_T);
+    pool_create_info.slots_per_block = __RE_GRAPHICS_INSTANCE_POOL_BLOCK_SIZE;
+
+    __re_graphics_instance_pool = re_createPool(&pool_create_info);
+
+    RE_PROFILE_END();
+    RE_MEMORY_MODULE_END();
 }
 
 // *=================================================
@@ -52,10 +68,15 @@ void re_graphicsInit() {
 // *=================================================
 
 re_GraphicsInstance re_createGraphicsInstance(const re_GraphicsInstanceCreateInfo* create_info) {
-    re_GraphicsInstance instance = (re_GraphicsInstance)re_calloc(1, sizeof(re_GraphicsInstance_T));
+    RE_MEMORY_MODULE_BEGIN(RE_GRAPHICS_MODULE);
+    RE_PROFILE_FUNCTION_BEGIN();
+
+    re_GraphicsInstance instance = (re_GraphicsInstance)re_poolCalloc(__re_graphics_instance_pool);
 
     instance->backend_context = RE_GRAPHICS_RHI.createInternalGraphicsContext(create_info);
 
+    RE_PROFILE_END();
+    RE_MEMORY_MODULE_END();
     return instance;
 }
 
@@ -73,6 +94,6 @@ void re_destroyGraphicsInstance(re_GraphicsInstance* instance) {
 
     RE_GRAPHICS_RHI.destroyInternalGraphicsContext(&instance_data->backend_context);
 
-    re_free(instance_data);
+    re_poolFree(__re_graphics_instance_pool, instance_data);
     *instance = RE_NULL_HANDLE;
 }
\ No newline at end of file
@@ -3,18 +3,33 @@
 #include "./re_vulkan.h"
 
 #include <re_debug.h>
+#include <re_profile.h>
 #include <re_utils.h>
 #include "./re_vulkan_types.h"
 #include "./re_vulkan_utils.h"
+#include "./re_vulkan_timestamps.h"
+#include "./re_vulkan_gpu_cache.h"
+#include "./re_vulkan_extensions.h"
+#include "../../re_internals.h"
+#include "../../core/re_files.h"
+#include "../../core/re_threads.h"
 #include "../../core/re_vulkan_window.h"
 
+#include <stdlib.h>
+
+#define __RE_VULKAN_CONTEXT_POOL_BLOCK_SIZE 4u
+
+static re_Pool __re_vulkan_context_pool = RE_NULL_HANDLE;
+static re_OnceFlag __re_vulkan_context_pool_once = RE_ONCE_INIT;
+static re_VkContext __re_vulkan_probe_context = RE_NULL_HANDLE;
+
 // *=================================================
 // *
-// * __re_vulkanAvailable
+// * __re_hasVulkanInstanceExtensions
 // *
 // *=================================================
 
-bool __re_vulkanAvailable() {
+static bool __re_hasVulkanInstanceExtensions() {
     uint32_t req_extension_count = 0;
     const char* const* req_extensions = __re_getVulkanWindowExtensions(&req_extension_count);
 
@@ -31,63 +46,236 @@ bool __re_vulkanAvailable() {
 
     if (__instance_extension_count > 0) {
         const uint32_t instance_extension_count = __instance_extension_count;
-        VkExtensionProperties* instance_extensions = (VkExtensionProperties*)re_malloc(sizeof(VkExtensionProperties) * instance_extension_count);
+        const re_ArenaMark scratch_mark = re_getArenaMark(RE_SCRATCH_ARENA);
+        VkExtensionProperties* instance_extensions = (VkExtensionProperties*)re_arenaPush(
+            RE_SCRATCH_ARENA,
+            sizeof(VkExtensionProperties) * instance_extension_count,
+            _Alignof(VkExtensionProperties)
+        );
+        re_assert(instance_extensions != RE_NULL_HANDLE, "Scratch arena out of memory!");
         vkEnumerateInstanceExtensionProperties(
             VK_NULL_HANDLE,
             &__instance_extension_count,
             instance_extensions
         );
 
-        for (uint32_t idx = 0; idx < req_extension_count; ++idx) {
-            const char* req_extension = req_extensions[idx];
+        const bool has_extensions = __re_hasVulkanExtensions(
+            req_extensions,
+            req_extension_count,
+            instance_extensions,
+            instance_extension_count
+        );
 
-            bool is_present = false;
-            for (uint32_t jdx = 0; jdx < instance_extension_count; ++jdx) {
-                const char* instance_extension = instance_extensions[jdx].extensionName;
+        re_rewindArena(RE_SCRATCH_ARENA, scratch_mark);
 
-                if (re_isStrEqual(req_extension, instance_extension)) {
-                    is_present = true;
-                    break;
-                }
-            }
+        return has_extensions;
+    }
 
-            if (!is_present) {
-                re_free(instance_extensions);
-                return false;
-            }
-        }
+    return true;
+}
 
-        re_free(instance_extensions);
-    }
+// *=================================================
+// *
+// * __re_createVulkanContextPool
+// *
+// *=================================================
 
-    VkApplicationInfo app_info = {0};
-    app_info.sType = VK_STRUCTURE_TYPE_APPLICATION_INFO;
-    app_info.pApplicationName = "Razor Engine Vulkan Check";
-    app_info.applicationVersion = VK_MAKE_VERSION(1, 0, 0);
-    app_info.pEngineName = RE_ENGINE_NAME;
-    app_info.engineVersion = VK_MAKE_VERSION(
-        RE_ENGINE_MAJOR_VER,
-        RE_ENGINE_MINOR_VER,
-        RE_ENGINE_PATCH_VER
-    );
-    app_info.apiVersion = __RE_VULKAN_API_VER;
+static void __re_createVulkanContextPool() {
+    re_PoolCreateInfo pool_create_info = {0};
+    pool_create_info.slot_size = sizeof(re_VkContext_T);
+    pool_create_info.slots_per_block = __RE_VULKAN_CONTEXT_POOL_BLOCK_SIZE;
+
+    __re_vulkan_context_pool = re_createPool(&pool_create_info);
+}
+
+// *=================================================
+// *
+// * __re_allocVulkanContext
+// *
+// *=================================================
+
+static re_VkContext __re_allocVulkanContext() {
+    // ? Contexts may be created from several threads at once.
+    __re_callOnce(&__re_vulkan_context_pool_once, __re_createVulkanContextPool);
+
+    re_VkContext context = (re_VkContext)re_poolCalloc(__re_vulkan_context_pool);
+    context->allocator = __re_initVulkanHostAllocator(&context->host_allocator);
+
+    return context;
+}
 
-    VkInstanceCreateInfo instance_create_info = {0};
-    instance_create_info.sType = VK_STRUCTURE_TYPE_INSTANCE_CREATE_INFO;
-    instance_create_info.pApplicationInfo = &app_info;
+// *=================================================
+// *
+// * __re_probeVulkanContext
+// *
+// *=================================================
 
-    VkInstance instance = VK_NULL_HANDLE;
-    const VkResult instance_create_result = vkCreateInstance(&instance_create_info, VK_NULL_HANDLE, &instance);
+static bool __re_probeVulkanContext(re_VkContext context) {
+    if (!__re_hasVulkanInstanceExtensions()) {
+        return false;
+    }
 
-    if (instance_create_result != VK_SUCCESS) {
+    const VkInstance instance = __re_createVulkanInstance(context->allocator);
+
+    if (instance == VK_NULL_HANDLE) {
         return false;
     }
 
+    context->instance = instance;
+    re_recordFlightEvent(RE_FLIGHT_EVENT_GRAPHICS, "Created VkInstance %p", (void*)instance);
+
     uint32_t __gpu_count = 0;
     const VkResult get_gpus_result = vkEnumeratePhysicalDevices(instance, &__gpu_count, VK_NULL_HANDLE);
-    vkDestroyInstance(instance, VK_NULL_HANDLE);
 
-    return __gpu_count > 0 && get_gpus_result == VK_SUCCESS;
+    if (get_gpus_result != VK_SUCCESS || __gpu_count == 0) {
+        return false;
+    }
+
+    const uint32_t gpu_count = __gpu_count;
+    const re_ArenaMark scratch_mark = re_getArenaMark(RE_SCRATCH_ARENA);
+    VkPhysicalDevice* gpus = (VkPhysicalDevice*)re_arenaPush(
+        RE_SCRATCH_ARENA,
+        gpu_count * sizeof(VkPhysicalDevice),
+        _Alignof(VkPhysicalDevice)
+    );
+    re_assert(gpus != RE_NULL_HANDLE, "Scratch arena out of memory!");
+    vkEnumeratePhysicalDevices(instance, &__gpu_count, gpus);
+
+    context->candidate_gpus = (VkPhysicalDevice*)re_malloc(gpu_count * sizeof(VkPhysicalDevice));
+    context->candidate_gpu_scores = (size_t*)re_malloc(gpu_count * sizeof(size_t));
+    context->candidate_gpu_capabilities = (re_VkCapabilityFlags*)re_malloc(gpu_count * sizeof(re_VkCapabilityFlags));
+
+    // ? Known devices are scored from the cache; the cache is rewritten only
+    // ? when a device, driver or the engine version changed.
+    // ? Without a cache directory every launch queries every device.
+    char cache_path[RE_MAX_FILE_PATH_SIZE];
+    const bool has_cache_path = __re_getCacheFilePath(RE_VK_GPU_CACHE_FILE_NAME, cache_path, sizeof(cache_path));
+
+    re_VkGPUCache cache = {0};
+    if (has_cache_path) {
+        __re_loadVulkanGPUCache(&cache, cache_path);
+    }
+
+    re_VkGPUCache launch_cache = {0};
+    launch_cache.infos = (re_VkGPUInfo*)re_malloc(gpu_count * sizeof(re_VkGPUInfo));
+    launch_cache.info_count = gpu_count;
+
+    bool is_cache_stale = cache.info_count != gpu_count;
+
+    for (uint32_t idx = 0; idx < gpu_count; ++idx) {
+        re_VkGPUInfo* info = &launch_cache.infos[idx];
+
+        re_VkGPU gpu = {0};
+        __re_getVulkanGPUIdentity(gpus[idx], info, &gpu.properties);
+
+        const re_VkGPUInfo* cached_info = __re_findVulkanGPUInfo(&cache, info);
+
+        if (cached_info != RE_NULL_HANDLE) {
+            *info = *cached_info;
+        }
+        else {
+            __re_queryVulkanGPUInfo(gpus[idx], &gpu.properties, info);
+            is_cache_stale = true;
+        }
+
+        if ((info->capabilities & RE_VK_REQUIRED_CAPABILITIES) != RE_VK_REQUIRED_CAPABILITIES) {
+            continue;
+        }
+
+        gpu.mem_properties = info->mem_properties;
+        gpu.capability_flags = info->capabilities;
+
+        const uint32_t candidate_idx = context->candidate_gpu_count++;
+        context->candidate_gpus[candidate_idx] = gpus[idx];
+        context->candidate_gpu_scores[candidate_idx] = __re_scoreVulkanGPU(&gpu);
+        context->candidate_gpu_capabilities[candidate_idx] = info->capabilities;
+    }
+
+    if (is_cache_stale && has_cache_path) {
+        __re_saveVulkanGPUCache(&launch_cache, cache_path);
+    }
+
+    __re_clearVulkanGPUCache(&launch_cache);
+    __re_clearVulkanGPUCache(&cache);
+
+    re_rewindArena(RE_SCRATCH_ARENA, scratch_mark);
+
+    return context->candidate_gpu_count > 0;
+}
+
+// *=================================================
+// *
+// * __re_releaseVulkanProbe
+// *
+// *=================================================
+
+static void __re_releaseVulkanProbe(re_VkContext context) {
+    if (context->candidate_gpus != RE_NULL_HANDLE) {
+        re_free(context->candidate_gpus);
+        re_free(context->candidate_gpu_scores);
+        re_free(context->candidate_gpu_capabilities);
+
+        context->candidate_gpus = RE_NULL_HANDLE;
+        context->candidate_gpu_scores = RE_NULL_HANDLE;
+        context->candidate_gpu_capabilities = RE_NULL_HANDLE;
+    }
+
+    if (context->instance != VK_NULL_HANDLE) {
+        vkDestroyInstance(context->instance, context->allocator);
+    }
+
+    __re_clearVulkanHostAllocator(&context->host_allocator);
+    re_poolFree(__re_vulkan_context_pool, context);
+}
+
+// *=================================================
+// *
+// * __re_releaseVulkanProbeContext
+// *
+// *=================================================
+
+static void __re_releaseVulkanProbeContext() {
+    // ? Only set when the application probed for Vulkan but never created a
+    // ? context to adopt the probe's instance.
+    if (__re_vulkan_probe_context != RE_NULL_HANDLE) {
+        __re_releaseVulkanProbe(__re_vulkan_probe_context);
+        __re_vulkan_probe_context = RE_NULL_HANDLE;
+    }
+}
+
+// *=================================================
+// *
+// * __re_vulkanAvailable
+// *
+// *=================================================
+
+bool __re_vulkanAvailable() {
+    if (__re_vulkan_probe_context != RE_NULL_HANDLE) {
+        return true;
+    }
+
+    RE_PROFILE_FUNCTION_BEGIN();
+
+    re_VkContext context = __re_allocVulkanContext();
+    const bool is_available = __re_probeVulkanContext(context);
+
+    if (is_available) {
+        static bool is_release_registered = false;
+
+        if (!is_release_registered) {
+            atexit(__re_releaseVulkanProbeContext);
+            is_release_registered = true;
+        }
+
+        __re_vulkan_probe_context = context;
+    }
+    else {
+        __re_releaseVulkanProbe(context);
+    }
+
+    RE_PROFILE_END();
+
+    return is_available;
 }
 
 // *=================================================
@@ -97,25 +285,65 @@ bool __re_vulkanAvailable() {
 // *=================================================
 
 re_VkContext __re_createVulkanContext(const re_GraphicsInstanceCreateInfo* create_info) {
-    re_VkContext context = (re_VkContext)re_calloc(1, sizeof(re_VkContext_T));
+    RE_PROFILE_FUNCTION_BEGIN();
 
-    // ? Set to NULL for now, but may change later for efficiency or debug purposes.
-    VkAllocationCallbacks* allocator = VK_NULL_HANDLE;
-    context->allocator = allocator;
+    // ? The first context adopts the instance and GPU list of the availability
+    // ? probe rather than paying for a second instance.
+    re_VkContext context = __re_vulkan_probe_context;
+    __re_vulkan_probe_context = RE_NULL_HANDLE;
 
-    const VkInstance instance = __re_createVulkanInstance(allocator);
-    context->instance = instance;
+    if (context == RE_NULL_HANDLE) {
+        context = __re_allocVulkanContext();
+
+        RE_PROFILE_BEGIN("__re_probeVulkanContext");
+        const bool is_available = __re_probeVulkanContext(context);
+        RE_PROFILE_END();
 
+        re_assert(is_available, "Failed to create Vulkan instance!");
+    }
+
+    const VkInstance instance = context->instance;
+    VkAllocationCallbacks* allocator = context->allocator;
+
+    RE_PROFILE_BEGIN("__re_createVulkanSurface");
     const VkSurfaceKHR surface = __re_createVulkanSurface(create_info->window, instance, allocator);
+    RE_PROFILE_END();
+
     context->surface = surface;
+    re_recordFlightEvent(RE_FLIGHT_EVENT_GRAPHICS, "Created VkSurfaceKHR %p", (void*)surface);
+
+    RE_PROFILE_BEGIN("__re_selectVulkanGPU");
+    context->gpu = __re_selectVulkanGPU(
+        context->candidate_gpus,
+        context->candidate_gpu_scores,
+        context->candidate_gpu_capabilities,
+        context->candidate_gpu_count,
+        surface
+    );
+    RE_PROFILE_END();
+
+    re_free(context->candidate_gpus);
+    re_free(context->candidate_gpu_scores);
+    re_free(context->candidate_gpu_capabilities);
+
+    context->candidate_gpus = RE_NULL_HANDLE;
+    context->candidate_gpu_scores = RE_NULL_HANDLE;
+    context->candidate_gpu_capabilities = RE_NULL_HANDLE;
+    context->candidate_gpu_count = 0;
 
-    context->gpu = __re_selectVulkanGPU(instance, surface);
     const re_VkGPU* gpu = &context->gpu;
+    re_recordFlightEvent(RE_FLIGHT_EVENT_GRAPHICS, "Selected GPU: %s", gpu->properties.deviceName);
 
     VkPhysicalDeviceFeatures enabled_features = {0}; // TODO: Set enabled features
 
+    RE_PROFILE_BEGIN("__re_createVulkanLogicalDevice");
     const VkDevice logical_device = __re_createVulkanLogicalDevice(gpu, &enabled_features, allocator);
+    RE_PROFILE_END();
+
     context->logical_device = logical_device;
+    re_recordFlightEvent(RE_FLIGHT_EVENT_GRAPHICS, "Created VkDevice %p", (void*)logical_device);
+
+    RE_PROFILE_BEGIN("__re_getVulkanQueues");
 
     uint32_t queue_count_offset = 0;
     for (uint32_t idx = 0; idx < gpu->queue_family_count; ++idx) {
@@ -130,15 +358,31 @@ re_VkContext __re_createVulkanContext(const re_GraphicsInstanceCreateInfo* creat
         queue_count_offset += queue_family->queue_count;
     }
 
+    RE_PROFILE_END();
+
+    RE_PROFILE_BEGIN("__re_createVulkanCommandPools");
     __re_createVulkanCommandPools(
         context->cmd_pools,
         logical_device,
         gpu,
         allocator
     );
+    RE_PROFILE_END();
 
+    #ifdef RE_PROFILER_ENABLED
+    RE_PROFILE_BEGIN("__re_initVulkanTimestamps");
+    __re_initVulkanTimestamps(context);
+    RE_PROFILE_END();
+    #endif
+
+    RE_PROFILE_BEGIN("__re_createVulkanDescriptorPool");
     const VkDescriptorPool desc_pool = __re_createVulkanDescriptorPool(logical_device, create_info->profile, allocator);
+    RE_PROFILE_END();
+
     context->desc_pool = desc_pool;
+    re_recordFlightEvent(RE_FLIGHT_EVENT_GRAPHICS, "Created VkDescriptorPool %p", (void*)desc_pool);
+
+    RE_PROFILE_END();
 
     return context;
 }
@@ -158,8 +402,11 @@ void __re_destroyVulkanContext(re_VkContext* context) {
     VkDevice logical_device = context_data->logical_device;
     VkAllocationCallbacks* allocator = context_data->allocator;
 
+    re_recordFlightEvent(RE_FLIGHT_EVENT_GRAPHICS, "Destroying Vulkan context (VkDevice %p)", (void*)logical_device);
+
     vkDeviceWaitIdle(logical_device);
 
+    __re_clearVulkanTimestamps(context_data);
     __re_clearVulkanGPU(&context_data->gpu);
 
     VkCommandPool* cmd_pools = context_data->cmd_pools;
@@ -188,11 +435,9 @@ void __re_destroyVulkanContext(re_VkContext* context) {
     vkDestroySurfaceKHR(context_data->instance, context_data->surface, allocator);
     vkDestroyInstance(context_data->instance, allocator);
 
-    if (allocator != VK_NULL_HANDLE) {
-        re_free(allocator);
-    }
+    __re_clearVulkanHostAllocator(&context_data->host_allocator);
 
-    re_free(context_data);
+    re_poolFree(__re_vulkan_context_pool, context_data);
     *context = RE_NULL_HANDLE;
 }
 
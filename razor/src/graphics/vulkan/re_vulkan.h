@@ -5,6 +5,8 @@
 
 #define __RE_VULKAN_API_VER VK_API_VERSION_1_3
 
+#define RE_VULKAN_FRAMES_IN_FLIGHT 2u
+
 #include <re_core.h>
 #include <re_graphics.h>
 #include <vulkan/vulkan.h>
@@ -0,0 +1,225 @@
+#ifdef RE_VULKAN_AVAILABLE
+
+#include "./re_vulkan_extensions.h"
+
+#include <re_debug.h>
+#include <re_utils.h>
+#include "../../re_internals.h"
+
+// ? Slots pack the upper half of the name's hash with its extension index
+// ? plus one, 0 marking an empty slot.
+#define __re_packVulkanExtensionSlot(hash, idx) (((hash) & 0xffffffff00000000ull) | ((uint64_t)(idx) + 1u))
+#define __re_getVulkanExtensionSlotIndex(slot) ((uint32_t)((slot) & 0xffffffffu) - 1u)
+
+// ? Indexed by re_VkCapability.
+static const char* __RE_VULKAN_DEVICE_EXTENSIONS[RE_VK_CAPABILITY_EXTENSION_COUNT] = {
+    VK_KHR_SWAPCHAIN_EXTENSION_NAME,
+    // ? Must be enabled whenever a (non-conformant, e.g. MoltenVK) device exposes it.
+    "VK_KHR_portability_subset",
+    VK_EXT_MEMORY_BUDGET_EXTENSION_NAME
+};
+
+// *=================================================
+// *
+// * __re_initVulkanExtensionSet
+// *
+// *=================================================
+
+void __re_initVulkanExtensionSet(
+    re_VkExtensionSet* set,
+    const VkExtensionProperties* extensions,
+    const uint32_t extension_count
+) {
+    // ? At most half full, so probe sequences stay short.
+    uint32_t slot_count = 16u;
+    while (slot_count < extension_count * 2u) {
+        slot_count *= 2u;
+    }
+
+    set->extensions = extensions;
+    set->slot_mask = slot_count - 1u;
+    set->slots = (uint64_t*)re_arenaPushZero(RE_SCRATCH_ARENA, slot_count * sizeof(uint64_t), _Alignof(uint64_t));
+    re_assert(set->slots != RE_NULL_HANDLE, "Scratch arena out of memory!");
+
+    for (uint32_t idx = 0; idx < extension_count; ++idx) {
+        const char* name = extensions[idx].extensionName;
+        const uint64_t hash = re_hashStr(name, re_getStrLength(name));
+
+        uint32_t slot_idx = (uint32_t)hash & set->slot_mask;
+        while (set->slots[slot_idx] != 0) {
+            slot_idx = (slot_idx + 1u) & set->slot_mask;
+        }
+
+        set->slots[slot_idx] = __re_packVulkanExtensionSlot(hash, idx);
+    }
+}
+
+// *=================================================
+// *
+// * __re_hasVulkanExtension
+// *
+// *=================================================
+
+bool __re_hasVulkanExtension(const re_VkExtensionSet* set, const char* name) {
+    const uint64_t hash = re_hashStr(name, re_getStrLength(name));
+
+    for (uint32_t slot_idx = (uint32_t)hash & set->slot_mask;; slot_idx = (slot_idx + 1u) & set->slot_mask) {
+        const uint64_t slot = set->slots[slot_idx];
+
+        if (slot == 0) {
+            return false;
+        }
+
+        if ((slot ^ hash) >> 32u != 0) {
+            continue;
+        }
+
+        if (re_isStrEqual(set->extensions[__re_getVulkanExtensionSlotIndex(slot)].extensionName, name)) {
+            return true;
+        }
+    }
+}
+
+// *=================================================
+// *
+// * __re_hasVulkanExtensions
+// *
+// *=================================================
+
+bool __re_hasVulkanExtensions(
+    const char* const* req_extensions,
+    const uint32_t req_extension_count,
+    const VkExtensionProperties* extensions,
+    const uint32_t extension_count
+) {
+    const re_ArenaMark scratch_mark = re_getArenaMark(RE_SCRATCH_ARENA);
+
+    re_VkExtensionSet set = {0};
+    __re_initVulkanExtensionSet(&set, extensions, extension_count);
+
+    bool has_extensions = true;
+    for (uint32_t idx = 0; idx < req_extension_count && has_extensions; ++idx) {
+        has_extensions = __re_hasVulkanExtension(&set, req_extensions[idx]);
+    }
+
+    re_rewindArena(RE_SCRATCH_ARENA, scratch_mark);
+
+    return has_extensions;
+}
+
+// *=================================================
+// *
+// * __re_resolveVulkanCapabilities
+// *
+// *=================================================
+
+re_VkCapabilityFlags __re_resolveVulkanCapabilities(
+    const VkPhysicalDevice physical_device,
+    const VkPhysicalDeviceProperties* properties
+) {
+    re_VkCapabilityFlags capabilities = 0;
+
+    uint32_t __extension_count = 0;
+    vkEnumerateDeviceExtensionProperties(physical_device, VK_NULL_HANDLE, &__extension_count, VK_NULL_HANDLE);
+
+    if (__extension_count > 0) {
+        const uint32_t extension_count = __extension_count;
+        const re_ArenaMark scratch_mark = re_getArenaMark(RE_SCRATCH_ARENA);
+        VkExtensionProperties* extensions = (VkExtensionProperties*)re_arenaPush(
+            RE_SCRATCH_ARENA,
+            extension_count * sizeof(VkExtensionProperties),
+            _Alignof(VkExtensionProperties)
+        );
+        re_assert(extensions != RE_NULL_HANDLE, "Scratch arena out of memory!");
+        vkEnumerateDeviceExtensionProperties(physical_device, VK_NULL_HANDLE, &__extension_count, extensions);
+
+        re_VkExtensionSet set = {0};
+        __re_initVulkanExtensionSet(&set, extensions, extension_count);
+
+        for (uint32_t idx = 0; idx < RE_VK_CAPABILITY_EXTENSION_COUNT; ++idx) {
+            if (__re_hasVulkanExtension(&set, __RE_VULKAN_DEVICE_EXTENSIONS[idx])) {
+                capabilities |= RE_VK_CAPABILITY_BIT(idx);
+            }
+        }
+
+        re_rewindArena(RE_SCRATCH_ARENA, scratch_mark);
+    }
+
+    VkPhysicalDeviceFeatures features = {0};
+    vkGetPhysicalDeviceFeatures(physical_device, &features);
+
+    if (features.samplerAnisotropy) {
+        capabilities |= RE_VK_CAPABILITY_BIT(RE_VK_CAPABILITY_SAMPLER_ANISOTROPY);
+    }
+
+    if (properties->limits.timestampComputeAndGraphics) {
+        capabilities |= RE_VK_CAPABILITY_BIT(RE_VK_CAPABILITY_TIMESTAMPS);
+    }
+
+    return capabilities;
+}
+
+// *=================================================
+// *
+// * __re_getVulkanDeviceExtensionNames
+// *
+// *=================================================
+
+uint32_t __re_getVulkanDeviceExtensionNames(const re_VkCapabilityFlags capabilities, const char** extension_names) {
+    uint32_t extension_count = 0;
+
+    for (uint32_t idx = 0; idx < RE_VK_CAPABILITY_EXTENSION_COUNT; ++idx) {
+        const re_VkCapabilityFlags capability = RE_VK_CAPABILITY_BIT(idx);
+        const bool is_present = (capabilities & capability) != 0;
+
+        re_assert(
+            is_present || !(RE_VK_REQUIRED_CAPABILITIES & capability),
+            "Vulkan device is missing required extension: %s",
+            __RE_VULKAN_DEVICE_EXTENSIONS[idx]
+        );
+
+        if (is_present) {
+            extension_names[extension_count++] = __RE_VULKAN_DEVICE_EXTENSIONS[idx];
+        }
+    }
+
+    return extension_count;
+}
+
+// *=================================================
+// *
+// * __re_getVulkanCapabilityLayoutHash
+// *
+// *=================================================
+
+#define __RE_VK_LAYOUT_HASH_OFFSET 2166136261u
+#define __RE_VK_LAYOUT_HASH_PRIME 16777619u
+
+static uint32_t __re_hashVulkanLayoutBytes(uint32_t hash, const void* data, const size_t size) {
+    const uint8_t* bytes = (const uint8_t*)data;
+
+    for (size_t idx = 0; idx < size; ++idx) {
+        hash = (hash ^ bytes[idx]) * __RE_VK_LAYOUT_HASH_PRIME;
+    }
+
+    return hash;
+}
+
+uint32_t __re_getVulkanCapabilityLayoutHash() {
+    // ? Persisted, so this is FNV-1a rather than re_hashStr (which may change
+    // ? between builds). Names keep their terminators so that moving a
+    // ? character from one name to the next changes the hash.
+    uint32_t hash = __RE_VK_LAYOUT_HASH_OFFSET;
+
+    const uint32_t capability_count = RE_VK_CAPABILITY_COUNT;
+    hash = __re_hashVulkanLayoutBytes(hash, &capability_count, sizeof(capability_count));
+
+    for (uint32_t idx = 0; idx < RE_VK_CAPABILITY_EXTENSION_COUNT; ++idx) {
+        const char* name = __RE_VULKAN_DEVICE_EXTENSIONS[idx];
+        hash = __re_hashVulkanLayoutBytes(hash, name, re_getStrLength(name) + 1u);
+    }
+
+    return hash;
+}
+
+#endif
\ No newline at end of file
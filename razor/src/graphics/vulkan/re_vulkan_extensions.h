@@ -0,0 +1,91 @@
+#ifdef RE_VULKAN_AVAILABLE
+
+#ifndef __RAZOR_GRAPHICS_VULKAN_EXTENSIONS_HEADER_FILE
+#define __RAZOR_GRAPHICS_VULKAN_EXTENSIONS_HEADER_FILE
+
+#include <re_core.h>
+#include <vulkan/vulkan.h>
+
+// ? Everything the engine asks of a device, one bit each. The first block are
+// ? device extensions (in the order of the extension table), the rest are
+// ? core features and limits.
+typedef enum re_VkCapability {
+    RE_VK_CAPABILITY_SWAPCHAIN,
+    RE_VK_CAPABILITY_PORTABILITY_SUBSET,
+    RE_VK_CAPABILITY_MEMORY_BUDGET,
+
+    RE_VK_CAPABILITY_EXTENSION_COUNT,
+
+    RE_VK_CAPABILITY_SAMPLER_ANISOTROPY = RE_VK_CAPABILITY_EXTENSION_COUNT,
+    RE_VK_CAPABILITY_TIMESTAMPS,
+
+    RE_VK_CAPABILITY_COUNT
+} re_VkCapability;
+
+typedef uint32_t re_VkCapabilityFlags;
+
+#define RE_VK_CAPABILITY_BIT(capability) ((re_VkCapabilityFlags)1u << (capability))
+
+// ? A device missing any of these is never a candidate.
+#define RE_VK_REQUIRED_CAPABILITIES RE_VK_CAPABILITY_BIT(RE_VK_CAPABILITY_SWAPCHAIN)
+
+// ? Enumerated extension names hashed once into an open-addressed table, so
+// ? that every later query is a hash probe rather than a scan. The slots live
+// ? in the scratch arena; the caller marks and rewinds around the set's use.
+typedef struct re_VkExtensionSet {
+    const VkExtensionProperties* extensions;
+    uint64_t* slots;
+    uint32_t slot_mask;
+} re_VkExtensionSet;
+
+/// @brief Build an extension set on the scratch arena.
+/// @param set The set to fill.
+/// @param extensions The enumerated extensions (must outlive the set).
+/// @param extension_count The length of extensions.
+void __re_initVulkanExtensionSet(
+    re_VkExtensionSet* set,
+    const VkExtensionProperties* extensions,
+    const uint32_t extension_count
+);
+
+/// @brief Determine if an extension set holds some extension.
+/// @param set The extension set.
+/// @param name The extension's name.
+/// @return A flag indicating if the extension is in the set.
+bool __re_hasVulkanExtension(const re_VkExtensionSet* set, const char* name);
+
+/// @brief Determine if every required extension name appears in a list of enumerated extensions.
+/// @param req_extensions The required extension names.
+/// @param req_extension_count The length of req_extensions.
+/// @param extensions The enumerated extensions.
+/// @param extension_count The length of extensions.
+/// @return A flag indicating if every required extension is present.
+bool __re_hasVulkanExtensions(
+    const char* const* req_extensions,
+    const uint32_t req_extension_count,
+    const VkExtensionProperties* extensions,
+    const uint32_t extension_count
+);
+
+/// @brief Resolve everything the engine asks of a device in one pass over its extensions.
+/// @param physical_device The Vulkan physical device handle.
+/// @param properties The device's properties.
+/// @return The device's capabilities.
+re_VkCapabilityFlags __re_resolveVulkanCapabilities(
+    const VkPhysicalDevice physical_device,
+    const VkPhysicalDeviceProperties* properties
+);
+
+/// @brief Get the names of the device extensions to enable for some capabilities (every one present, required or not).
+/// @param capabilities The device's capabilities.
+/// @param extension_names The array (of RE_VK_CAPABILITY_EXTENSION_COUNT names) to store the names in.
+/// @return The number of extension names stored.
+uint32_t __re_getVulkanDeviceExtensionNames(const re_VkCapabilityFlags capabilities, const char** extension_names);
+
+/// @brief Hash the layout of re_VkCapabilityFlags (the capability count and the extension table, in order).
+/// @return A hash that is stable across builds and changes whenever a capability bit changes meaning.
+uint32_t __re_getVulkanCapabilityLayoutHash();
+
+#endif
+
+#endif
\ No newline at end of file
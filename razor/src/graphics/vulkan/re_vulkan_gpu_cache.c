@@ -0,0 +1,244 @@
+#ifdef RE_VULKAN_AVAILABLE
+
+#include "./re_vulkan_gpu_cache.h"
+
+#include <re_debug.h>
+#include <re_utils.h>
+#include "./re_vulkan_utils.h"
+#include "../../re_internals.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#define __RE_VK_GPU_CACHE_MAGIC 0x55504752u // "RGPU"
+#define __RE_VK_GPU_CACHE_VERSION 3u
+
+// ? Far more GPUs than any machine has; a larger count means a corrupt file.
+#define __RE_VK_GPU_CACHE_MAX_INFOS 64u
+
+#define __RE_VK_GPU_CACHE_ENGINE_VERSION VK_MAKE_VERSION( \
+    RE_ENGINE_MAJOR_VER, \
+    RE_ENGINE_MINOR_VER, \
+    RE_ENGINE_PATCH_VER \
+)
+
+// ? Any header mismatch (including a differently laid out re_VkGPUInfo from
+// ? another build) discards the whole file. The capability bits are positions
+// ? in the extension table, so the table's hash is checked as well.
+typedef struct __re_VkGPUCacheHeader {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t engine_version;
+    uint32_t capability_layout_hash;
+    uint32_t info_size;
+    uint32_t info_count;
+} __re_VkGPUCacheHeader;
+
+// *=================================================
+// *
+// * __re_openVulkanGPUCacheFile
+// *
+// *=================================================
+
+static FILE* __re_openVulkanGPUCacheFile(const char* file_path, const char* file_mode) {
+    FILE* file = RE_NULL_HANDLE;
+
+    #if RE_PLATFORM == RE_PLATFORM_WINDOWS
+    fopen_s(&file, file_path, file_mode);
+    #else
+    file = fopen(file_path, file_mode);
+    #endif
+
+    return file;
+}
+
+// *=================================================
+// *
+// * __re_loadVulkanGPUCache
+// *
+// *=================================================
+
+void __re_loadVulkanGPUCache(re_VkGPUCache* cache, const char* file_path) {
+    re_assert(cache != RE_NULL_HANDLE, "Attempting to load into NULL Vulkan GPU cache!");
+
+    cache->infos = RE_NULL_HANDLE;
+    cache->info_count = 0;
+
+    FILE* file = __re_openVulkanGPUCacheFile(file_path, "rb");
+
+    if (file == RE_NULL_HANDLE) {
+        return;
+    }
+
+    __re_VkGPUCacheHeader header = {0};
+    const bool is_valid = fread(&header, sizeof(header), 1, file) == 1 &&
+        header.magic == __RE_VK_GPU_CACHE_MAGIC &&
+        header.version == __RE_VK_GPU_CACHE_VERSION &&
+        header.engine_version == __RE_VK_GPU_CACHE_ENGINE_VERSION &&
+        header.capability_layout_hash == __re_getVulkanCapabilityLayoutHash() &&
+        header.info_size == sizeof(re_VkGPUInfo) &&
+        header.info_count > 0 &&
+        header.info_count <= __RE_VK_GPU_CACHE_MAX_INFOS;
+
+    if (!is_valid) {
+        fclose(file);
+        return;
+    }
+
+    // ? The infos must fill the rest of the file exactly, so a truncated or
+    // ? padded file is rejected before anything is allocated for it.
+    const long infos_offset = ftell(file);
+    const bool is_sized = infos_offset >= 0 &&
+        fseek(file, 0, SEEK_END) == 0 &&
+        ftell(file) - infos_offset == (long)(header.info_count * sizeof(re_VkGPUInfo)) &&
+        fseek(file, infos_offset, SEEK_SET) == 0;
+
+    if (!is_sized) {
+        fclose(file);
+        return;
+    }
+
+    re_VkGPUInfo* infos = (re_VkGPUInfo*)re_malloc(header.info_count * sizeof(re_VkGPUInfo));
+
+    if (fread(infos, sizeof(re_VkGPUInfo), header.info_count, file) != header.info_count) {
+        re_free(infos);
+        fclose(file);
+
+        return;
+    }
+
+    fclose(file);
+
+    cache->infos = infos;
+    cache->info_count = header.info_count;
+}
+
+// *=================================================
+// *
+// * __re_saveVulkanGPUCache
+// *
+// *=================================================
+
+bool __re_saveVulkanGPUCache(const re_VkGPUCache* cache, const char* file_path) {
+    re_assert(cache != RE_NULL_HANDLE, "Attempting to save NULL Vulkan GPU cache!");
+
+    FILE* file = __re_openVulkanGPUCacheFile(file_path, "wb");
+
+    if (file == RE_NULL_HANDLE) {
+        re_logWarn("Failed to open Vulkan GPU cache file: %s", file_path);
+        return false;
+    }
+
+    __re_VkGPUCacheHeader header = {0};
+    header.magic = __RE_VK_GPU_CACHE_MAGIC;
+    header.version = __RE_VK_GPU_CACHE_VERSION;
+    header.engine_version = __RE_VK_GPU_CACHE_ENGINE_VERSION;
+    header.capability_layout_hash = __re_getVulkanCapabilityLayoutHash();
+    header.info_size = sizeof(re_VkGPUInfo);
+    header.info_count = cache->info_count;
+
+    const bool is_written = fwrite(&header, sizeof(header), 1, file) == 1 &&
+        fwrite(cache->infos, sizeof(re_VkGPUInfo), cache->info_count, file) == cache->info_count;
+
+    fclose(file);
+
+    if (!is_written) {
+        // ? A truncated file would only be rejected on the next load anyway.
+        remove(file_path);
+        re_logWarn("Failed to write Vulkan GPU cache file: %s", file_path);
+    }
+
+    return is_written;
+}
+
+// *=================================================
+// *
+// * __re_clearVulkanGPUCache
+// *
+// *=================================================
+
+void __re_clearVulkanGPUCache(re_VkGPUCache* cache) {
+    if (cache->infos != RE_NULL_HANDLE) {
+        re_free(cache->infos);
+        cache->infos = RE_NULL_HANDLE;
+    }
+
+    cache->info_count = 0;
+}
+
+// *=================================================
+// *
+// * __re_getVulkanGPUIdentity
+// *
+// *=================================================
+
+void __re_getVulkanGPUIdentity(
+    const VkPhysicalDevice physical_device,
+    re_VkGPUInfo* info,
+    VkPhysicalDeviceProperties* properties
+) {
+    re_memset(info, 0, sizeof(re_VkGPUInfo));
+    vkGetPhysicalDeviceProperties(physical_device, properties);
+
+    info->vendor_id = properties->vendorID;
+    info->device_id = properties->deviceID;
+    info->driver_version = properties->driverVersion;
+    info->api_version = properties->apiVersion;
+
+    // ? Devices older than Vulkan 1.1 have no UUID; two identical ones then
+    // ? share an entry, which is harmless since they report the same data.
+    if (properties->apiVersion < VK_API_VERSION_1_1) {
+        return;
+    }
+
+    VkPhysicalDeviceIDProperties id_properties = {0};
+    id_properties.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_ID_PROPERTIES;
+
+    VkPhysicalDeviceProperties2 properties2 = {0};
+    properties2.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROPERTIES_2;
+    properties2.pNext = &id_properties;
+
+    vkGetPhysicalDeviceProperties2(physical_device, &properties2);
+    re_memcpy(info->device_uuid, id_properties.deviceUUID, VK_UUID_SIZE);
+}
+
+// *=================================================
+// *
+// * __re_findVulkanGPUInfo
+// *
+// *=================================================
+
+const re_VkGPUInfo* __re_findVulkanGPUInfo(const re_VkGPUCache* cache, const re_VkGPUInfo* identity) {
+    for (uint32_t idx = 0; idx < cache->info_count; ++idx) {
+        const re_VkGPUInfo* info = &cache->infos[idx];
+
+        const bool is_match = info->vendor_id == identity->vendor_id &&
+            info->device_id == identity->device_id &&
+            info->driver_version == identity->driver_version &&
+            info->api_version == identity->api_version &&
+            memcmp(info->device_uuid, identity->device_uuid, VK_UUID_SIZE) == 0;
+
+        if (is_match) {
+            return info;
+        }
+    }
+
+    return RE_NULL_HANDLE;
+}
+
+// *=================================================
+// *
+// * __re_queryVulkanGPUInfo
+// *
+// *=================================================
+
+void __re_queryVulkanGPUInfo(
+    const VkPhysicalDevice physical_device,
+    const VkPhysicalDeviceProperties* properties,
+    re_VkGPUInfo* info
+) {
+    info->capabilities = __re_resolveVulkanCapabilities(physical_device, properties);
+    vkGetPhysicalDeviceMemoryProperties(physical_device, &info->mem_properties);
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,76 @@
+#ifdef RE_VULKAN_AVAILABLE
+
+#ifndef __RAZOR_GRAPHICS_VULKAN_GPU_CACHE_HEADER_FILE
+#define __RAZOR_GRAPHICS_VULKAN_GPU_CACHE_HEADER_FILE
+
+#include <re_core.h>
+#include <vulkan/vulkan.h>
+#include "./re_vulkan_extensions.h"
+
+// ? Lives in the engine's per-user cache directory (see __re_getCacheFilePath),
+// ? so every launch finds the same file whatever its working directory.
+#define RE_VK_GPU_CACHE_FILE_NAME "gpu_cache.bin"
+
+// ? The surface-independent part of a GPU's description. The first five
+// ? fields identify the device and driver; the rest is what ruling the GPU
+// ? out and scoring it takes, so a known GPU skips those queries.
+typedef struct re_VkGPUInfo {
+    uint8_t device_uuid[VK_UUID_SIZE];
+    uint32_t vendor_id;
+    uint32_t device_id;
+    uint32_t driver_version;
+    uint32_t api_version;
+
+    re_VkCapabilityFlags capabilities;
+    VkPhysicalDeviceMemoryProperties mem_properties;
+} re_VkGPUInfo;
+
+typedef struct re_VkGPUCache {
+    re_VkGPUInfo* infos;
+    uint32_t info_count;
+} re_VkGPUCache;
+
+/// @brief Load a GPU cache file (a missing, stale or corrupt file yields an empty cache).
+/// @param cache The cache to fill.
+/// @param file_path The path of the cache file.
+void __re_loadVulkanGPUCache(re_VkGPUCache* cache, const char* file_path);
+
+/// @brief Write a GPU cache file.
+/// @param cache The cache to write.
+/// @param file_path The path of the cache file.
+/// @return A flag determining if the file could be written.
+bool __re_saveVulkanGPUCache(const re_VkGPUCache* cache, const char* file_path);
+
+/// @brief Clear the internals of a GPU cache.
+/// @param cache The cache to clear.
+void __re_clearVulkanGPUCache(re_VkGPUCache* cache);
+
+/// @brief Read a GPU's identity (the cache key) along with its properties.
+/// @param physical_device The Vulkan physical device handle.
+/// @param info The GPU info to store the identity in.
+/// @param properties The properties to fill.
+void __re_getVulkanGPUIdentity(
+    const VkPhysicalDevice physical_device,
+    re_VkGPUInfo* info,
+    VkPhysicalDeviceProperties* properties
+);
+
+/// @brief Find the cached info of a GPU.
+/// @param cache The cache to search.
+/// @param identity A GPU info holding the identity to look for.
+/// @return The cached info, or NULL if the GPU (or its driver) is not cached.
+const re_VkGPUInfo* __re_findVulkanGPUInfo(const re_VkGPUCache* cache, const re_VkGPUInfo* identity);
+
+/// @brief Query the cacheable part of a GPU's description.
+/// @param physical_device The Vulkan physical device handle.
+/// @param properties The device's properties (as read along with its identity).
+/// @param info The GPU info (its identity already filled) to complete.
+void __re_queryVulkanGPUInfo(
+    const VkPhysicalDevice physical_device,
+    const VkPhysicalDeviceProperties* properties,
+    re_VkGPUInfo* info
+);
+
+#endif
+
+#endif
\ No newline at end of file
@@ -0,0 +1,379 @@
+#ifdef RE_VULKAN_AVAILABLE
+
+#include "./re_vulkan_memory.h"
+
+#include <re_debug.h>
+#include "../../re_internals.h"
+
+// ? re_malloc blocks are always aligned to this, so stricter requests go
+// ? through the aligned allocator instead.
+#define __RE_VULKAN_HEAP_ALIGNMENT 16u
+
+typedef enum __re_VkHostAllocKind {
+    __RE_VK_HOST_ALLOC_HEAP,
+    __RE_VK_HOST_ALLOC_ALIGNED,
+    __RE_VK_HOST_ALLOC_COMMAND
+} __re_VkHostAllocKind;
+
+// ? Sits directly in front of every pointer handed to the driver.
+typedef struct __re_VkHostAllocHeader {
+    void* base;
+    size_t size;
+    uint32_t scope;
+    uint32_t kind;
+} __re_VkHostAllocHeader;
+
+static const char* const __RE_VULKAN_HOST_SCOPE_NAMES[RE_VK_HOST_SCOPE_COUNT] = {
+    "Command",
+    "Object",
+    "Cache",
+    "Device",
+    "Instance"
+};
+
+// *=================================================
+// *
+// * __re_getVulkanHostHeaderPadding
+// *
+// *=================================================
+
+static inline size_t __re_getVulkanHostHeaderPadding(const size_t alignment) {
+    return (sizeof(__re_VkHostAllocHeader) + alignment - 1) & ~(alignment - 1);
+}
+
+// *=================================================
+// *
+// * __re_getVulkanHostHeader
+// *
+// *=================================================
+
+static inline __re_VkHostAllocHeader* __re_getVulkanHostHeader(void* src) {
+    return (__re_VkHostAllocHeader*)((uint8_t*)src - sizeof(__re_VkHostAllocHeader));
+}
+
+// *=================================================
+// *
+// * __re_addVulkanHostBytes
+// *
+// *=================================================
+
+static inline void __re_addVulkanHostBytes(re_VkHostScopeStats* stats, const size_t size) {
+    const uint64_t live_bytes = atomic_fetch_add_explicit(&stats->live_bytes, size, memory_order_relaxed) + size;
+
+    uint64_t peak_bytes = atomic_load_explicit(&stats->peak_bytes, memory_order_relaxed);
+    while (live_bytes > peak_bytes) {
+        if (atomic_compare_exchange_weak_explicit(
+            &stats->peak_bytes,
+            &peak_bytes,
+            live_bytes,
+            memory_order_relaxed,
+            memory_order_relaxed
+        )) {
+            break;
+        }
+    }
+}
+
+// *=================================================
+// *
+// * __re_pushVulkanCommandMemory
+// *
+// *=================================================
+
+static void* __re_pushVulkanCommandMemory(re_VkHostAllocator* host_allocator, const size_t size, const size_t alignment) {
+    void* base = RE_NULL_HANDLE;
+
+    __re_lockSpinLock(&host_allocator->command_lock);
+
+    const size_t arena_capacity = RE_VK_COMMAND_ARENA_CAPACITY;
+    const size_t arena_top = (size_t)re_getArenaMark(host_allocator->command_arena);
+
+    // ? Alignment padding is at most alignment - 1 bytes on top of the size.
+    if (size + alignment <= arena_capacity - arena_top) {
+        base = re_arenaPush(host_allocator->command_arena, size, alignment);
+        ++host_allocator->command_allocation_count;
+    }
+
+    __re_unlockSpinLock(&host_allocator->command_lock);
+
+    return base;
+}
+
+// *=================================================
+// *
+// * __re_popVulkanCommandMemory
+// *
+// *=================================================
+
+static void __re_popVulkanCommandMemory(re_VkHostAllocator* host_allocator) {
+    __re_lockSpinLock(&host_allocator->command_lock);
+
+    re_assert(host_allocator->command_allocation_count > 0, "Vulkan command arena freed more often than allocated!");
+
+    if (--host_allocator->command_allocation_count == 0) {
+        re_resetArena(host_allocator->command_arena);
+    }
+
+    __re_unlockSpinLock(&host_allocator->command_lock);
+}
+
+// *=================================================
+// *
+// * __re_allocateVulkanHostMemory
+// *
+// *=================================================
+
+static void* VKAPI_PTR __re_allocateVulkanHostMemory(
+    void* user_data,
+    size_t size,
+    size_t alignment,
+    VkSystemAllocationScope scope
+) {
+    if (size == 0) {
+        return RE_NULL_HANDLE;
+    }
+
+    RE_MEMORY_MODULE_BEGIN(RE_GRAPHICS_MODULE);
+
+    re_VkHostAllocator* host_allocator = (re_VkHostAllocator*)user_data;
+
+    const size_t header_alignment = alignment < __RE_VULKAN_HEAP_ALIGNMENT ? __RE_VULKAN_HEAP_ALIGNMENT : alignment;
+    const size_t padding = __re_getVulkanHostHeaderPadding(header_alignment);
+
+    __re_VkHostAllocKind kind = __RE_VK_HOST_ALLOC_HEAP;
+    uint8_t* base = RE_NULL_HANDLE;
+
+    if (scope == VK_SYSTEM_ALLOCATION_SCOPE_COMMAND) {
+        base = (uint8_t*)__re_pushVulkanCommandMemory(host_allocator, padding + size, header_alignment);
+        kind = __RE_VK_HOST_ALLOC_COMMAND;
+    }
+
+    // ? Small, loosely aligned objects land in re_malloc's size-class caches.
+    if (base == RE_NULL_HANDLE) {
+        if (header_alignment <= __RE_VULKAN_HEAP_ALIGNMENT) {
+            base = (uint8_t*)re_malloc(padding + size);
+            kind = __RE_VK_HOST_ALLOC_HEAP;
+        }
+        else {
+            base = (uint8_t*)re_mallocAlign(padding + size, header_alignment);
+            kind = __RE_VK_HOST_ALLOC_ALIGNED;
+        }
+    }
+
+    RE_MEMORY_MODULE_END();
+
+    if (base == RE_NULL_HANDLE) {
+        return RE_NULL_HANDLE;
+    }
+
+    uint8_t* ptr = base + padding;
+
+    __re_VkHostAllocHeader* header = __re_getVulkanHostHeader(ptr);
+    header->base = base;
+    header->size = size;
+    header->scope = (uint32_t)scope;
+    header->kind = (uint32_t)kind;
+
+    re_VkHostScopeStats* stats = &host_allocator->scope_stats[scope];
+    atomic_fetch_add_explicit(&stats->total_allocations, 1u, memory_order_relaxed);
+    __re_addVulkanHostBytes(stats, size);
+
+    return ptr;
+}
+
+// *=================================================
+// *
+// * __re_freeVulkanHostMemory
+// *
+// *=================================================
+
+static void VKAPI_PTR __re_freeVulkanHostMemory(void* user_data, void* memory) {
+    if (memory == RE_NULL_HANDLE) {
+        return;
+    }
+
+    re_VkHostAllocator* host_allocator = (re_VkHostAllocator*)user_data;
+    __re_VkHostAllocHeader* header = __re_getVulkanHostHeader(memory);
+
+    atomic_fetch_sub_explicit(&host_allocator->scope_stats[header->scope].live_bytes, header->size, memory_order_relaxed);
+
+    switch ((__re_VkHostAllocKind)header->kind) {
+        case __RE_VK_HOST_ALLOC_HEAP:
+            re_free(header->base);
+            break;
+        case __RE_VK_HOST_ALLOC_ALIGNED:
+            re_freeAlign(header->base);
+            break;
+        case __RE_VK_HOST_ALLOC_COMMAND:
+            __re_popVulkanCommandMemory(host_allocator);
+            break;
+    }
+}
+
+// *=================================================
+// *
+// * __re_reallocateVulkanHostMemory
+// *
+// *=================================================
+
+static void* VKAPI_PTR __re_reallocateVulkanHostMemory(
+    void* user_data,
+    void* original,
+    size_t size,
+    size_t alignment,
+    VkSystemAllocationScope scope
+) {
+    if (original == RE_NULL_HANDLE) {
+        return __re_allocateVulkanHostMemory(user_data, size, alignment, scope);
+    }
+
+    if (size == 0) {
+        __re_freeVulkanHostMemory(user_data, original);
+        return RE_NULL_HANDLE;
+    }
+
+    re_VkHostAllocator* host_allocator = (re_VkHostAllocator*)user_data;
+    __re_VkHostAllocHeader* header = __re_getVulkanHostHeader(original);
+
+    // ? The spec requires the same alignment as the original allocation, so
+    // ? heap blocks can be resized in place with the same header padding.
+    if (header->kind == __RE_VK_HOST_ALLOC_HEAP && header->scope == (uint32_t)scope) {
+        const size_t padding = (size_t)((uint8_t*)original - (uint8_t*)header->base);
+        const size_t old_size = header->size;
+
+        RE_MEMORY_MODULE_BEGIN(RE_GRAPHICS_MODULE);
+        uint8_t* base = (uint8_t*)re_realloc(header->base, padding + size);
+        RE_MEMORY_MODULE_END();
+
+        if (base == RE_NULL_HANDLE) {
+            return RE_NULL_HANDLE;
+        }
+
+        header = (__re_VkHostAllocHeader*)(base + padding - sizeof(__re_VkHostAllocHeader));
+        header->base = base;
+        header->size = size;
+
+        re_VkHostScopeStats* stats = &host_allocator->scope_stats[scope];
+        if (size >= old_size) {
+            __re_addVulkanHostBytes(stats, size - old_size);
+        }
+        else {
+            atomic_fetch_sub_explicit(&stats->live_bytes, old_size - size, memory_order_relaxed);
+        }
+
+        return base + padding;
+    }
+
+    void* ptr = __re_allocateVulkanHostMemory(user_data, size, alignment, scope);
+
+    if (ptr == RE_NULL_HANDLE) {
+        return RE_NULL_HANDLE;
+    }
+
+    re_memcpy(ptr, original, header->size < size ? header->size : size);
+    __re_freeVulkanHostMemory(user_data, original);
+
+    return ptr;
+}
+
+// *=================================================
+// *
+// * __re_notifyVulkanInternalAllocation
+// *
+// *=================================================
+
+static void VKAPI_PTR __re_notifyVulkanInternalAllocation(
+    void* user_data,
+    size_t size,
+    VkInternalAllocationType type,
+    VkSystemAllocationScope scope
+) {
+    (void)type;
+
+    re_VkHostAllocator* host_allocator = (re_VkHostAllocator*)user_data;
+    atomic_fetch_add_explicit(&host_allocator->scope_stats[scope].internal_bytes, size, memory_order_relaxed);
+}
+
+// *=================================================
+// *
+// * __re_notifyVulkanInternalFree
+// *
+// *=================================================
+
+static void VKAPI_PTR __re_notifyVulkanInternalFree(
+    void* user_data,
+    size_t size,
+    VkInternalAllocationType type,
+    VkSystemAllocationScope scope
+) {
+    (void)type;
+
+    re_VkHostAllocator* host_allocator = (re_VkHostAllocator*)user_data;
+    atomic_fetch_sub_explicit(&host_allocator->scope_stats[scope].internal_bytes, size, memory_order_relaxed);
+}
+
+// *=================================================
+// *
+// * __re_initVulkanHostAllocator
+// *
+// *=================================================
+
+VkAllocationCallbacks* __re_initVulkanHostAllocator(re_VkHostAllocator* host_allocator) {
+    re_assert(host_allocator != RE_NULL_HANDLE, "Attempting to initialize NULL Vulkan host allocator!");
+
+    re_memset(host_allocator, 0, sizeof(re_VkHostAllocator));
+
+    atomic_flag_clear(&host_allocator->command_lock);
+    host_allocator->command_arena = re_createArena(RE_VK_COMMAND_ARENA_CAPACITY);
+
+    VkAllocationCallbacks* callbacks = &host_allocator->callbacks;
+    callbacks->pUserData = host_allocator;
+    callbacks->pfnAllocation = __re_allocateVulkanHostMemory;
+    callbacks->pfnReallocation = __re_reallocateVulkanHostMemory;
+    callbacks->pfnFree = __re_freeVulkanHostMemory;
+    callbacks->pfnInternalAllocation = __re_notifyVulkanInternalAllocation;
+    callbacks->pfnInternalFree = __re_notifyVulkanInternalFree;
+
+    return callbacks;
+}
+
+// *=================================================
+// *
+// * __re_clearVulkanHostAllocator
+// *
+// *=================================================
+
+void __re_clearVulkanHostAllocator(re_VkHostAllocator* host_allocator) {
+    re_assert(host_allocator != RE_NULL_HANDLE, "Attempting to clear NULL Vulkan host allocator!");
+
+    for (uint32_t scope = 0; scope < RE_VK_HOST_SCOPE_COUNT; ++scope) {
+        re_VkHostScopeStats* stats = &host_allocator->scope_stats[scope];
+
+        const uint64_t total_allocations = atomic_load_explicit(&stats->total_allocations, memory_order_relaxed);
+        const uint64_t live_bytes = atomic_load_explicit(&stats->live_bytes, memory_order_relaxed);
+        const uint64_t peak_bytes = atomic_load_explicit(&stats->peak_bytes, memory_order_relaxed);
+
+        if (total_allocations == 0) {
+            continue;
+        }
+
+        re_logInfo(
+            "Vulkan %s host memory: %llu allocations; peak: %llu bytes",
+            __RE_VULKAN_HOST_SCOPE_NAMES[scope],
+            (unsigned long long)total_allocations,
+            (unsigned long long)peak_bytes
+        );
+
+        if (live_bytes != 0) {
+            re_logWarn(
+                "Vulkan %s host memory still live after teardown: %llu bytes",
+                __RE_VULKAN_HOST_SCOPE_NAMES[scope],
+                (unsigned long long)live_bytes
+            );
+        }
+    }
+
+    re_destroyArena(&host_allocator->command_arena);
+}
+
+#endif
\ No newline at end of file
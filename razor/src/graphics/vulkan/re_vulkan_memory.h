@@ -0,0 +1,49 @@
+#ifdef RE_VULKAN_AVAILABLE
+
+#ifndef __RAZOR_GRAPHICS_VULKAN_MEMORY_HEADER_FILE
+#define __RAZOR_GRAPHICS_VULKAN_MEMORY_HEADER_FILE
+
+#include <re_core.h>
+#include <stdatomic.h>
+#include <vulkan/vulkan.h>
+#include "../../core/re_threads.h"
+
+#define RE_VK_HOST_SCOPE_COUNT (VK_SYSTEM_ALLOCATION_SCOPE_INSTANCE + 1)
+
+// ? Command-scope allocations only live for the duration of a single Vulkan
+// ? call, so they are bump-allocated and the arena resets once all are freed.
+#define RE_VK_COMMAND_ARENA_CAPACITY (256u * 1024u)
+
+typedef struct re_VkHostScopeStats {
+    _Alignas(RE_CACHE_LINE_SIZE) atomic_uint_fast64_t live_bytes;
+    atomic_uint_fast64_t peak_bytes;
+    atomic_uint_fast64_t total_allocations;
+
+    // ? Driver-internal allocations (e.g. executable memory) are reported
+    // ? through notifications only; they never pass through the callbacks.
+    atomic_uint_fast64_t internal_bytes;
+} re_VkHostScopeStats;
+
+typedef struct re_VkHostAllocator {
+    VkAllocationCallbacks callbacks;
+
+    re_SpinLock command_lock;
+    re_Arena command_arena;
+    uint32_t command_allocation_count;
+
+    re_VkHostScopeStats scope_stats[RE_VK_HOST_SCOPE_COUNT];
+} re_VkHostAllocator;
+
+/// @brief Initialize the engine's Vulkan host allocator.
+/// @param host_allocator The host allocator to initialize.
+/// @return The allocation callbacks to hand to Vulkan (owned by host_allocator).
+VkAllocationCallbacks* __re_initVulkanHostAllocator(re_VkHostAllocator* host_allocator);
+
+/// @brief Release the resources owned by a Vulkan host allocator, logging its per-scope summary.
+/// Every Vulkan object created with its callbacks must already be destroyed.
+/// @param host_allocator The host allocator to clear.
+void __re_clearVulkanHostAllocator(re_VkHostAllocator* host_allocator);
+
+#endif
+
+#endif
\ No newline at end of file
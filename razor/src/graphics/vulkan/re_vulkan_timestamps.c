@@ -0,0 +1,406 @@
+#ifdef RE_VULKAN_AVAILABLE
+
+#include "./re_vulkan_timestamps.h"
+
+#include <re_debug.h>
+#include <re_profile.h>
+#include <re_utils.h>
+#include "./re_vulkan_types.h"
+#include "../../re_internals.h"
+
+#define __RE_VK_UNMEASURED_TIMESTAMP_SCOPE UINT32_MAX
+
+static const char* __RE_VK_TIMESTAMP_TRACK_NAMES[RE_VK_QUEUE_ROLE_COUNT] = {
+    "GPU Present",
+    "GPU Compute",
+    "GPU Graphics",
+    "GPU Transfer"
+};
+
+// *=================================================
+// *
+// * __re_getVulkanRoleQueue
+// *
+// *=================================================
+
+static VkQueue __re_getVulkanRoleQueue(const re_VkContext context, const re_VkQueueRole queue_role) {
+    const re_VkGPU* gpu = &context->gpu;
+    const uint32_t family_slot = gpu->queue_role_indices[queue_role];
+
+    // ? Queues are stored family after family, in the order they were selected.
+    uint32_t queue_offset = 0;
+    for (uint32_t idx = 0; idx < family_slot; ++idx) {
+        queue_offset += gpu->queue_families[idx].queue_count;
+    }
+
+    return context->queues[queue_offset];
+}
+
+// *=================================================
+// *
+// * __re_calibrateVulkanTimestamps
+// *
+// *=================================================
+
+static void __re_calibrateVulkanTimestamps(re_VkContext context, const re_VkQueueRole queue_role) {
+    re_VkTimestamps* timestamps = &context->timestamps;
+    const re_VkTimestampQueue* timestamp_queue = &timestamps->queues[queue_role];
+
+    const VkDevice logical_device = context->logical_device;
+    const VkCommandPool cmd_pool = context->cmd_pools[__re_getVulkanCmdPoolIndex(0, queue_role, RE_VK_CMD_POOL_ONE_SHOT)];
+
+    VkCommandBufferAllocateInfo cmd_alloc_info = {0};
+    cmd_alloc_info.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+    cmd_alloc_info.commandPool = cmd_pool;
+    cmd_alloc_info.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+    cmd_alloc_info.commandBufferCount = 1;
+
+    VkCommandBuffer cmd = VK_NULL_HANDLE;
+    const VkResult cmd_alloc_result = vkAllocateCommandBuffers(logical_device, &cmd_alloc_info, &cmd);
+    re_assert(cmd_alloc_result == VK_SUCCESS, "Failed to allocate Vulkan timestamp calibration command buffer!");
+
+    VkCommandBufferBeginInfo cmd_begin_info = {0};
+    cmd_begin_info.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+    cmd_begin_info.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+
+    vkBeginCommandBuffer(cmd, &cmd_begin_info);
+    vkCmdResetQueryPool(cmd, timestamp_queue->query_pool, 0, 1);
+    vkCmdWriteTimestamp(cmd, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, timestamp_queue->query_pool, 0);
+    vkEndCommandBuffer(cmd);
+
+    VkSubmitInfo submit_info = {0};
+    submit_info.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+    submit_info.commandBufferCount = 1;
+    submit_info.pCommandBuffers = &cmd;
+
+    const VkQueue queue = __re_getVulkanRoleQueue(context, queue_role);
+
+    // ? VK_EXT_calibrated_timestamps would sample both clocks at once; without
+    // ? it the GPU write lands somewhere between submit and idle, so the
+    // ? midpoint is off by at most half of that round trip. This is the only
+    // ? time the timestamps ever wait on the GPU.
+    const uint64_t submit_ns = re_getProfileTime();
+    const VkResult submit_result = vkQueueSubmit(queue, 1, &submit_info, VK_NULL_HANDLE);
+    re_assert(submit_result == VK_SUCCESS, "Failed to submit Vulkan timestamp calibration!");
+
+    vkQueueWaitIdle(queue);
+    const uint64_t idle_ns = re_getProfileTime();
+
+    uint64_t gpu_ticks = 0;
+    vkGetQueryPoolResults(
+        logical_device,
+        timestamp_queue->query_pool,
+        0,
+        1,
+        sizeof(uint64_t),
+        &gpu_ticks,
+        sizeof(uint64_t),
+        VK_QUERY_RESULT_64_BIT | VK_QUERY_RESULT_WAIT_BIT
+    );
+
+    vkFreeCommandBuffers(logical_device, cmd_pool, 1, &cmd);
+
+    timestamps->gpu_base_ticks = gpu_ticks & timestamp_queue->valid_mask;
+    timestamps->cpu_base_ns = submit_ns + (idle_ns - submit_ns) / 2u;
+}
+
+// *=================================================
+// *
+// * __re_initVulkanTimestamps
+// *
+// *=================================================
+
+void __re_initVulkanTimestamps(re_VkContext context) {
+    re_assert(context != RE_NULL_HANDLE, "Attempting to initialize timestamps of NULL Vulkan context!");
+
+    re_VkTimestamps* timestamps = &context->timestamps;
+    const re_VkGPU* gpu = &context->gpu;
+
+    re_memset(timestamps, 0, sizeof(re_VkTimestamps));
+    timestamps->ns_per_tick = (double)gpu->properties.limits.timestampPeriod;
+
+    uint32_t __family_count = 0;
+    vkGetPhysicalDeviceQueueFamilyProperties(gpu->physical_device, &__family_count, VK_NULL_HANDLE);
+
+    const uint32_t family_count = __family_count;
+    const re_ArenaMark scratch_mark = re_getArenaMark(RE_SCRATCH_ARENA);
+    VkQueueFamilyProperties* families = (VkQueueFamilyProperties*)re_arenaPush(
+        RE_SCRATCH_ARENA,
+        family_count * sizeof(VkQueueFamilyProperties),
+        _Alignof(VkQueueFamilyProperties)
+    );
+    re_assert(families != RE_NULL_HANDLE, "Scratch arena out of memory!");
+    vkGetPhysicalDeviceQueueFamilyProperties(gpu->physical_device, &__family_count, families);
+
+    VkQueryPoolCreateInfo query_pool_create_info = {0};
+    query_pool_create_info.sType = VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO;
+    query_pool_create_info.queryType = VK_QUERY_TYPE_TIMESTAMP;
+    query_pool_create_info.queryCount = RE_VK_TIMESTAMP_QUERIES_PER_FRAME * RE_VULKAN_FRAMES_IN_FLIGHT;
+
+    // ? Nothing is recorded for presentation, so it gets no pool.
+    for (uint32_t queue_role = RE_VK_QUEUE_PRESENT + 1; queue_role < RE_VK_QUEUE_ROLE_COUNT; ++queue_role) {
+        re_VkTimestampQueue* timestamp_queue = &timestamps->queues[queue_role];
+
+        const re_VkQueueFamily* queue_family = &gpu->queue_families[gpu->queue_role_indices[queue_role]];
+        const uint32_t valid_bits = families[queue_family->family_index].timestampValidBits;
+
+        if (valid_bits == 0) {
+            re_logWarn("GPU timestamps are not supported on the %s queue", __RE_VK_TIMESTAMP_TRACK_NAMES[queue_role]);
+            continue;
+        }
+
+        timestamp_queue->valid_mask = valid_bits >= 64u ? UINT64_MAX : (1ull << valid_bits) - 1ull;
+
+        const VkResult query_pool_create_result = vkCreateQueryPool(
+            context->logical_device,
+            &query_pool_create_info,
+            context->allocator,
+            &timestamp_queue->query_pool
+        );
+
+        re_assert(query_pool_create_result == VK_SUCCESS, "Failed to create Vulkan timestamp query pool!");
+
+        timestamp_queue->profile_track = re_createProfileTrack(__RE_VK_TIMESTAMP_TRACK_NAMES[queue_role]);
+    }
+
+    re_rewindArena(RE_SCRATCH_ARENA, scratch_mark);
+
+    // ? Every queue of a device shares one timestamp clock, so a single
+    // ? calibration covers all of them. Without it GPU scopes could not be
+    // ? placed on the timeline at all.
+    if (timestamps->queues[RE_VK_QUEUE_GRAPHICS].query_pool != VK_NULL_HANDLE) {
+        __re_calibrateVulkanTimestamps(context, RE_VK_QUEUE_GRAPHICS);
+    }
+    else {
+        __re_clearVulkanTimestamps(context);
+    }
+}
+
+// *=================================================
+// *
+// * __re_clearVulkanTimestamps
+// *
+// *=================================================
+
+void __re_clearVulkanTimestamps(re_VkContext context) {
+    re_assert(context != RE_NULL_HANDLE, "Attempting to clear timestamps of NULL Vulkan context!");
+
+    re_VkTimestamps* timestamps = &context->timestamps;
+
+    for (uint32_t queue_role = 0; queue_role < RE_VK_QUEUE_ROLE_COUNT; ++queue_role) {
+        re_VkTimestampQueue* timestamp_queue = &timestamps->queues[queue_role];
+
+        if (timestamp_queue->query_pool == VK_NULL_HANDLE) {
+            continue;
+        }
+
+        vkDestroyQueryPool(context->logical_device, timestamp_queue->query_pool, context->allocator);
+        timestamp_queue->query_pool = VK_NULL_HANDLE;
+    }
+}
+
+// *=================================================
+// *
+// * __re_resolveVulkanTimestampFrame
+// *
+// *=================================================
+
+static void __re_resolveVulkanTimestampFrame(
+    const re_VkTimestamps* timestamps,
+    const re_VkTimestampQueue* timestamp_queue,
+    const re_VkTimestampFrame* frame,
+    const uint32_t frame_index,
+    const VkDevice logical_device
+) {
+    const uint32_t scope_count = frame->scope_count;
+
+    // ? Each query yields its ticks followed by its availability, so a scope
+    // ? whose commands have not finished is simply skipped.
+    uint64_t results[RE_VK_TIMESTAMP_QUERIES_PER_FRAME][2];
+
+    const VkResult results_result = vkGetQueryPoolResults(
+        logical_device,
+        timestamp_queue->query_pool,
+        frame_index * RE_VK_TIMESTAMP_QUERIES_PER_FRAME,
+        scope_count * 2u,
+        scope_count * sizeof(results[0]) * 2u,
+        results,
+        sizeof(results[0]),
+        VK_QUERY_RESULT_64_BIT | VK_QUERY_RESULT_WITH_AVAILABILITY_BIT
+    );
+
+    if (results_result != VK_SUCCESS && results_result != VK_NOT_READY) {
+        return;
+    }
+
+    const uint64_t valid_mask = timestamp_queue->valid_mask;
+    const double ns_per_tick = timestamps->ns_per_tick;
+
+    bool resolved[RE_VK_MAX_TIMESTAMP_SCOPES];
+    uint64_t duration_ns[RE_VK_MAX_TIMESTAMP_SCOPES];
+    uint64_t child_ns[RE_VK_MAX_TIMESTAMP_SCOPES] = {0};
+
+    for (uint32_t idx = 0; idx < scope_count; ++idx) {
+        const uint64_t* begin = results[idx * 2u];
+        const uint64_t* end = results[idx * 2u + 1u];
+
+        resolved[idx] = begin[1] != 0 && end[1] != 0;
+
+        if (!resolved[idx]) {
+            continue;
+        }
+
+        duration_ns[idx] = (uint64_t)((double)((end[0] - begin[0]) & valid_mask) * ns_per_tick);
+
+        // ? Parents always precede their children.
+        const uint32_t parent = frame->scopes[idx].parent;
+        if (parent != __RE_VK_UNMEASURED_TIMESTAMP_SCOPE) {
+            child_ns[parent] += duration_ns[idx];
+        }
+    }
+
+    for (uint32_t idx = 0; idx < scope_count; ++idx) {
+        if (!resolved[idx]) {
+            continue;
+        }
+
+        const uint64_t begin_ticks = (results[idx * 2u][0] - timestamps->gpu_base_ticks) & valid_mask;
+        const uint64_t start_ns = timestamps->cpu_base_ns + (uint64_t)((double)begin_ticks * ns_per_tick);
+
+        re_profileRecord(
+            frame->scopes[idx].name,
+            timestamp_queue->profile_track,
+            start_ns,
+            duration_ns[idx],
+            duration_ns[idx] > child_ns[idx] ? duration_ns[idx] - child_ns[idx] : 0
+        );
+    }
+}
+
+// *=================================================
+// *
+// * __re_beginVulkanTimestampFrame
+// *
+// *=================================================
+
+void __re_beginVulkanTimestampFrame(re_VkContext context) {
+    re_assert(context != RE_NULL_HANDLE, "Attempting to begin timestamp frame of NULL Vulkan context!");
+
+    re_VkTimestamps* timestamps = &context->timestamps;
+
+    const uint32_t frame_index = (timestamps->frame_index + 1u) % RE_VULKAN_FRAMES_IN_FLIGHT;
+    timestamps->frame_index = frame_index;
+
+    for (uint32_t queue_role = 0; queue_role < RE_VK_QUEUE_ROLE_COUNT; ++queue_role) {
+        const re_VkTimestampQueue* timestamp_queue = &timestamps->queues[queue_role];
+
+        if (timestamp_queue->query_pool == VK_NULL_HANDLE) {
+            continue;
+        }
+
+        re_VkTimestampFrame* frame = &timestamps->queues[queue_role].frames[frame_index];
+
+        if (frame->scope_count > 0) {
+            __re_resolveVulkanTimestampFrame(timestamps, timestamp_queue, frame, frame_index, context->logical_device);
+        }
+
+        frame->scope_count = 0;
+        frame->depth = 0;
+        frame->queries_reset = false;
+    }
+}
+
+// *=================================================
+// *
+// * __re_beginVulkanTimestampScope
+// *
+// *=================================================
+
+void __re_beginVulkanTimestampScope(
+    re_VkContext context,
+    const VkCommandBuffer cmd,
+    const re_VkQueueRole queue_role,
+    const char* name
+) {
+    re_assert(queue_role < RE_VK_QUEUE_ROLE_COUNT, "Unknown Vulkan queue role: %d", queue_role);
+
+    re_VkTimestamps* timestamps = &context->timestamps;
+    const re_VkTimestampQueue* timestamp_queue = &timestamps->queues[queue_role];
+
+    if (timestamp_queue->query_pool == VK_NULL_HANDLE) {
+        return;
+    }
+
+    const uint32_t frame_index = timestamps->frame_index;
+    const uint32_t first_query = frame_index * RE_VK_TIMESTAMP_QUERIES_PER_FRAME;
+    re_VkTimestampFrame* frame = &timestamps->queues[queue_role].frames[frame_index];
+
+    if (!frame->queries_reset) {
+        vkCmdResetQueryPool(cmd, timestamp_queue->query_pool, first_query, RE_VK_TIMESTAMP_QUERIES_PER_FRAME);
+        frame->queries_reset = true;
+    }
+
+    // ? Scopes past the limits are counted so that END stays balanced, but
+    // ? they are not measured.
+    const uint32_t depth = frame->depth++;
+
+    if (depth >= RE_VK_MAX_TIMESTAMP_DEPTH) {
+        return;
+    }
+
+    if (frame->scope_count == RE_VK_MAX_TIMESTAMP_SCOPES) {
+        frame->stack[depth] = __RE_VK_UNMEASURED_TIMESTAMP_SCOPE;
+        return;
+    }
+
+    const uint32_t scope_idx = frame->scope_count++;
+    re_VkTimestampScope* scope = &frame->scopes[scope_idx];
+
+    scope->name = name;
+    scope->parent = depth > 0 ? frame->stack[depth - 1u] : __RE_VK_UNMEASURED_TIMESTAMP_SCOPE;
+    frame->stack[depth] = scope_idx;
+
+    vkCmdWriteTimestamp(cmd, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, timestamp_queue->query_pool, first_query + scope_idx * 2u);
+}
+
+// *=================================================
+// *
+// * __re_endVulkanTimestampScope
+// *
+// *=================================================
+
+void __re_endVulkanTimestampScope(
+    re_VkContext context,
+    const VkCommandBuffer cmd,
+    const re_VkQueueRole queue_role
+) {
+    re_assert(queue_role < RE_VK_QUEUE_ROLE_COUNT, "Unknown Vulkan queue role: %d", queue_role);
+
+    re_VkTimestamps* timestamps = &context->timestamps;
+    const re_VkTimestampQueue* timestamp_queue = &timestamps->queues[queue_role];
+
+    if (timestamp_queue->query_pool == VK_NULL_HANDLE) {
+        return;
+    }
+
+    const uint32_t frame_index = timestamps->frame_index;
+    re_VkTimestampFrame* frame = &timestamps->queues[queue_role].frames[frame_index];
+
+    re_assert(frame->depth > 0, "Attempting to end a GPU timing scope that was never begun!");
+
+    const uint32_t depth = --frame->depth;
+
+    if (depth >= RE_VK_MAX_TIMESTAMP_DEPTH || frame->stack[depth] == __RE_VK_UNMEASURED_TIMESTAMP_SCOPE) {
+        return;
+    }
+
+    const uint32_t first_query = frame_index * RE_VK_TIMESTAMP_QUERIES_PER_FRAME;
+    vkCmdWriteTimestamp(
+        cmd,
+        VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT,
+        timestamp_queue->query_pool,
+        first_query + frame->stack[depth] * 2u + 1u
+    );
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,90 @@
+#ifdef RE_VULKAN_AVAILABLE
+
+#ifndef __RAZOR_GRAPHICS_VULKAN_TIMESTAMPS_HEADER_FILE
+#define __RAZOR_GRAPHICS_VULKAN_TIMESTAMPS_HEADER_FILE
+
+#include <re_core.h>
+#include <vulkan/vulkan.h>
+#include "./re_vulkan.h"
+#include "./re_vulkan_queues.h"
+
+#define RE_VK_MAX_TIMESTAMP_SCOPES 128u
+#define RE_VK_MAX_TIMESTAMP_DEPTH 16u
+
+// ? Every scope owns two queries (begin and end) in its frame's partition of
+// ? the queue's pool.
+#define RE_VK_TIMESTAMP_QUERIES_PER_FRAME (RE_VK_MAX_TIMESTAMP_SCOPES * 2u)
+
+typedef struct re_VkTimestampScope {
+    const char* name;
+    uint32_t parent;
+} re_VkTimestampScope;
+
+typedef struct re_VkTimestampFrame {
+    re_VkTimestampScope scopes[RE_VK_MAX_TIMESTAMP_SCOPES];
+    uint32_t scope_count;
+
+    uint32_t depth;
+    uint32_t stack[RE_VK_MAX_TIMESTAMP_DEPTH];
+
+    bool queries_reset;
+} re_VkTimestampFrame;
+
+typedef struct re_VkTimestampQueue {
+    VkQueryPool query_pool;
+    uint64_t valid_mask;
+    uint32_t profile_track;
+
+    re_VkTimestampFrame frames[RE_VULKAN_FRAMES_IN_FLIGHT];
+} re_VkTimestampQueue;
+
+typedef struct re_VkTimestamps {
+    re_VkTimestampQueue queues[RE_VK_QUEUE_ROLE_COUNT];
+    uint32_t frame_index;
+
+    // ? GPU ticks map onto the profiler's clock through one (ticks, ns) pair
+    // ? sampled at creation.
+    double ns_per_tick;
+    uint64_t gpu_base_ticks;
+    uint64_t cpu_base_ns;
+} re_VkTimestamps;
+
+/// @brief Create the timestamp query pools of every queue role that supports timestamps and calibrate them against the profiler's clock.
+/// @param context The Vulkan context (its device, queues and command pools must exist).
+void __re_initVulkanTimestamps(re_VkContext context);
+
+/// @brief Destroy the timestamp query pools of a Vulkan context.
+/// @param context The Vulkan context.
+void __re_clearVulkanTimestamps(re_VkContext context);
+
+/// @brief Advance to the next frame in flight, handing the results of the frame that last used it to the profiler.
+/// @param context The Vulkan context.
+/// @note Call once that frame's submissions have completed (e.g. after waiting on its fence). Results still pending are dropped rather than waited on.
+void __re_beginVulkanTimestampFrame(re_VkContext context);
+
+/// @brief Record the start of a GPU timing scope.
+/// @param context The Vulkan context.
+/// @param cmd The command buffer to write the timestamp in.
+/// @param queue_role The role of the queue cmd is submitted to.
+/// @param name The scope's name (must outlive the profile, e.g. a string literal).
+/// @note The first scope of a frame on each queue role resets its queries, so it must be recorded outside a render pass.
+void __re_beginVulkanTimestampScope(
+    re_VkContext context,
+    const VkCommandBuffer cmd,
+    const re_VkQueueRole queue_role,
+    const char* name
+);
+
+/// @brief Record the end of the innermost GPU timing scope.
+/// @param context The Vulkan context.
+/// @param cmd The command buffer to write the timestamp in.
+/// @param queue_role The role of the queue cmd is submitted to.
+void __re_endVulkanTimestampScope(
+    re_VkContext context,
+    const VkCommandBuffer cmd,
+    const re_VkQueueRole queue_role
+);
+
+#endif
+
+#endif
\ No newline at end of file
@@ -6,6 +6,9 @@
 #include <vulkan/vulkan.h>
 #include "./re_vulkan.h"
 #include "./re_vulkan_queues.h"
+#include "./re_vulkan_memory.h"
+#include "./re_vulkan_timestamps.h"
+#include "./re_vulkan_extensions.h"
 
 #define RE_MAX_VULKAN_THREADS 1
 
@@ -19,6 +22,7 @@ typedef enum re_VkCmdPoolRole {
 
 typedef struct re_VkGPU {
     VkPhysicalDevice physical_device;
+    re_VkCapabilityFlags capability_flags;
 
     VkPhysicalDeviceFeatures features;
     VkPhysicalDeviceProperties properties;
@@ -50,6 +54,14 @@ typedef struct re_VkContext_T {
     VkInstance instance;
     VkSurfaceKHR surface;
 
+    // ? GPUs with the engine's required capabilities, along with their scores
+    // ? and capabilities, gathered by the availability probe and released once
+    // ? one is selected.
+    VkPhysicalDevice* candidate_gpus;
+    size_t* candidate_gpu_scores;
+    re_VkCapabilityFlags* candidate_gpu_capabilities;
+    uint32_t candidate_gpu_count;
+
     re_VkGPU gpu;
     VkDevice logical_device;
     VkDescriptorPool desc_pool;
@@ -57,6 +69,9 @@ typedef struct re_VkContext_T {
     VkQueue queues[RE_VULKAN_MAX_DEVICE_QUEUES];
     VkCommandPool cmd_pools[RE_VULKAN_MAX_CMD_POOLS];
 
+    re_VkTimestamps timestamps;
+
+    re_VkHostAllocator host_allocator;
     VkAllocationCallbacks* allocator;
 } re_VulkanContext_T;
 
@@ -23,12 +23,8 @@ static const char* __RE_VULKAN_ENABLED_INSTANCE_LAYERS = RE_NULL_HANDLE;
 
 #endif
 
-#define __RE_VULKAN_ENABLED_DEVICE_EXTENSION_COUNT 1u
-static const char* __RE_VULKAN_ENABLED_DEVICE_EXTENSIONS[__RE_VULKAN_ENABLED_DEVICE_EXTENSION_COUNT] = {
-    VK_KHR_SWAPCHAIN_EXTENSION_NAME
-};
-
 #define __RE_VULKAN_DISCRETE_GPU_SCORE 5000u
+#define __RE_VULKAN_OPTIONAL_CAPABILITY_SCORE 1000u
 
 #define __RE_DESCRIPTOR_SIZE_COUNT 7u
 
@@ -68,38 +64,6 @@ bool __re_fillVulkanGPU(
 ) {
     gpu->physical_device = physical_device;
 
-    if (__RE_VULKAN_ENABLED_DEVICE_EXTENSION_COUNT > 0) {
-        uint32_t __extension_count = 0;
-        vkEnumerateDeviceExtensionProperties(physical_device, VK_NULL_HANDLE, &__extension_count, VK_NULL_HANDLE);
-
-        if (__extension_count < __RE_VULKAN_ENABLED_DEVICE_EXTENSION_COUNT) {
-            return false;
-        }
-
-        const uint32_t extension_count = __extension_count;
-        VkExtensionProperties* extensions = (VkExtensionProperties*)re_malloc(extension_count * sizeof(VkExtensionProperties));
-        vkEnumerateDeviceExtensionProperties(physical_device, VK_NULL_HANDLE, &__extension_count, extensions);
-
-        for (uint32_t idx = 0; idx < __RE_VULKAN_ENABLED_DEVICE_EXTENSION_COUNT; ++idx) {
-            const char* enabled_extension = __RE_VULKAN_ENABLED_DEVICE_EXTENSIONS[idx];
-
-            bool found_extension = false;
-            for (uint32_t jdx = 0; jdx < extension_count; ++jdx) {
-                if (re_isStrEqual(enabled_extension, extensions[jdx].extensionName)) {
-                    found_extension = true;
-                    break;
-                }
-            }
-
-            if (!found_extension) {
-                re_free(extensions);
-                return false;
-            }
-        }
-
-        re_free(extensions);
-    }
-
     vkGetPhysicalDeviceFeatures(physical_device, &gpu->features);
     vkGetPhysicalDeviceProperties(physical_device, &gpu->properties);
     vkGetPhysicalDeviceMemoryProperties(physical_device, &gpu->mem_properties);
@@ -131,7 +95,13 @@ bool __re_fillVulkanGPU(
     }
     
     const uint32_t family_count = __family_count;
-    VkQueueFamilyProperties* families = (VkQueueFamilyProperties*)re_malloc(sizeof(VkQueueFamilyProperties) * family_count);
+    const re_ArenaMark scratch_mark = re_getArenaMark(RE_SCRATCH_ARENA);
+    VkQueueFamilyProperties* families = (VkQueueFamilyProperties*)re_arenaPush(
+        RE_SCRATCH_ARENA,
+        sizeof(VkQueueFamilyProperties) * family_count,
+        _Alignof(VkQueueFamilyProperties)
+    );
+    re_assert(families != RE_NULL_HANDLE, "Scratch arena out of memory!");
     vkGetPhysicalDeviceQueueFamilyProperties(physical_device, &__family_count, families);
     
     uint32_t selected_queue_family_count = 0;
@@ -194,7 +164,7 @@ bool __re_fillVulkanGPU(
     }
 
     gpu->queue_family_count = selected_queue_family_count;
-    re_free(families);
+    re_rewindArena(RE_SCRATCH_ARENA, scratch_mark);
 
     if (!queues_assigned[RE_VK_QUEUE_GRAPHICS]) {
         return false;
@@ -236,6 +206,11 @@ size_t __re_scoreVulkanGPU(const re_VkGPU* gpu) {
 
     score += gpu->properties.limits.maxImageDimension2D;
 
+    // ? Ties between otherwise equal devices go to the one offering more.
+    for (re_VkCapabilityFlags optional = gpu->capability_flags & ~RE_VK_REQUIRED_CAPABILITIES; optional != 0; optional &= optional - 1u) {
+        score += __RE_VULKAN_OPTIONAL_CAPABILITY_SCORE;
+    }
+
     return score;
 }
 
@@ -274,7 +249,9 @@ VkInstance __re_createVulkanInstance(const VkAllocationCallbacks* allocator) {
     VkInstance instance = VK_NULL_HANDLE;
     const VkResult instance_create_result = vkCreateInstance(&instance_create_info, allocator, &instance);
 
-    re_assert(instance_create_result == VK_SUCCESS, "Failed to create Vulkan instance!");
+    if (instance_create_result != VK_SUCCESS) {
+        return VK_NULL_HANDLE;
+    }
 
     return instance;
 }
@@ -286,60 +263,47 @@ VkInstance __re_createVulkanInstance(const VkAllocationCallbacks* allocator) {
 // *=================================================
 
 re_VkGPU __re_selectVulkanGPU(
-    const VkInstance instance,
+    const VkPhysicalDevice* gpus,
+    const size_t* gpu_scores,
+    const re_VkCapabilityFlags* gpu_capabilities,
+    const uint32_t gpu_count,
     const VkSurfaceKHR surface
 ) {
-    uint32_t __gpu_count = 0;
-    vkEnumeratePhysicalDevices(instance, &__gpu_count, VK_NULL_HANDLE);
-
-    re_assert(__gpu_count > 0, "No available GPU devices for Vulkan!");
+    re_assert(gpu_count > 0, "No available GPU devices for Vulkan!");
 
-    const uint32_t gpu_count = __gpu_count;
-    VkPhysicalDevice* gpus = (VkPhysicalDevice*)re_malloc(gpu_count * sizeof(VkPhysicalDevice));
-    vkEnumeratePhysicalDevices(instance, &__gpu_count, gpus);
+    const re_ArenaMark scratch_mark = re_getArenaMark(RE_SCRATCH_ARENA);
+    bool* is_tried = (bool*)re_arenaPush(RE_SCRATCH_ARENA, gpu_count * sizeof(bool), _Alignof(bool));
+    re_assert(is_tried != RE_NULL_HANDLE, "Scratch arena out of memory!");
+    re_memset(is_tried, 0, gpu_count * sizeof(bool));
 
-    uint32_t gpu_idx = 0;
-    re_VkGPU best_gpu = {0};
-    size_t best_gpu_score = 0;
+    re_VkGPU gpu = {0};
 
-    for (; gpu_idx < gpu_count; ++gpu_idx) {
-        const bool is_suitable = __re_fillVulkanGPU(gpus[gpu_idx], surface, &best_gpu);
+    // ? Candidates were scored without a surface; only the best one still
+    // ? standing gets the full (surface-dependent) query.
+    for (uint32_t attempt = 0; attempt < gpu_count; ++attempt) {
+        uint32_t best_gpu_idx = UINT32_MAX;
 
-        if (is_suitable) {
-            best_gpu_score = __re_scoreVulkanGPU(&best_gpu);
-            break;
-        }
-
-        __re_clearVulkanGPU(&best_gpu);
-    }
-
-    re_assert(best_gpu_score > 0, "No suitable GPU devices found for Vulkan!");
-
-    for (; gpu_idx < gpu_count; ++gpu_idx) {
-        re_VkGPU cur_gpu = {0};
-        const bool is_suitable = __re_fillVulkanGPU(gpus[gpu_idx], surface, &cur_gpu);
-
-        if (!is_suitable) {
-            __re_clearVulkanGPU(&cur_gpu);
-            continue;
+        for (uint32_t idx = 0; idx < gpu_count; ++idx) {
+            if (!is_tried[idx] && (best_gpu_idx == UINT32_MAX || gpu_scores[idx] > gpu_scores[best_gpu_idx])) {
+                best_gpu_idx = idx;
+            }
         }
 
-        const size_t cur_gpu_score = __re_scoreVulkanGPU(&cur_gpu);
+        is_tried[best_gpu_idx] = true;
 
-        if (cur_gpu_score <= best_gpu_score) {
-            __re_clearVulkanGPU(&cur_gpu);
-            continue;
+        if (__re_fillVulkanGPU(gpus[best_gpu_idx], surface, &gpu)) {
+            gpu.capability_flags = gpu_capabilities[best_gpu_idx];
+            re_rewindArena(RE_SCRATCH_ARENA, scratch_mark);
+            return gpu;
         }
 
-        __re_clearVulkanGPU(&best_gpu);
-
-        best_gpu = cur_gpu;
-        best_gpu_score = cur_gpu_score;
+        __re_clearVulkanGPU(&gpu);
     }
 
-    re_free(gpus);
+    re_rewindArena(RE_SCRATCH_ARENA, scratch_mark);
+    re_assert(false, "No suitable GPU devices found for Vulkan!");
 
-    return best_gpu;
+    return gpu;
 }
 
 // *=================================================
@@ -350,6 +314,7 @@ re_VkGPU __re_selectVulkanGPU(
 
 void __re_clearVulkanGPU(re_VkGPU* gpu) {
     gpu->physical_device = VK_NULL_HANDLE;
+    gpu->capability_flags = 0;
 
     if (gpu->formats != RE_NULL_HANDLE) {
         re_free(gpu->formats);
@@ -399,8 +364,9 @@ VkDevice __re_createVulkanLogicalDevice(
     device_create_info.sType = VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO;
     device_create_info.queueCreateInfoCount = queue_family_count;
     device_create_info.pQueueCreateInfos = queue_create_infos;
-    device_create_info.enabledExtensionCount = __RE_VULKAN_ENABLED_DEVICE_EXTENSION_COUNT;
-    device_create_info.ppEnabledExtensionNames = __RE_VULKAN_ENABLED_DEVICE_EXTENSIONS;
+    const char* extension_names[RE_VK_CAPABILITY_EXTENSION_COUNT];
+    device_create_info.enabledExtensionCount = __re_getVulkanDeviceExtensionNames(gpu->capability_flags, extension_names);
+    device_create_info.ppEnabledExtensionNames = extension_names;
 
     __re_VkPhysicalDeviceFeaturesIterable enabled_features_iterable = {0};
     enabled_features_iterable.features_struct = *enabled_features;
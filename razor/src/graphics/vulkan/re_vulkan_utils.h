@@ -5,17 +5,30 @@
 
 #include <vulkan/vulkan.h>
 #include "./re_vulkan_types.h"
+#include "./re_vulkan_extensions.h"
 
 /// @brief Create a Vulkan instance.
 /// @param allocator Vulkan allocation callbacks.
-/// @return A handle to the new Vulkan instance.
+/// @return A handle to the new Vulkan instance (VK_NULL_HANDLE on failure).
 VkInstance __re_createVulkanInstance(const VkAllocationCallbacks* allocator);
 
-/// @brief Select the most appropriate Vulkan GPU.
+/// @brief Score a Vulkan GPU (only its properties, memory properties and capabilities are read).
+/// @param gpu The GPU to score.
+/// @return The GPU's score, higher is better.
+size_t __re_scoreVulkanGPU(const re_VkGPU* gpu);
+
+/// @brief Select the most appropriate Vulkan GPU, fully querying only the candidates it has to.
+/// @param gpus The candidate GPUs (already known to have the engine's required capabilities).
+/// @param gpu_scores The scores of the candidate GPUs.
+/// @param gpu_capabilities The capabilities of the candidate GPUs.
+/// @param gpu_count The length of gpus, gpu_scores and gpu_capabilities.
 /// @param surface The window surface to check the capabilities against.
-/// @return The most appropriate Vulkan GPU.
+/// @return The highest scoring GPU that is suitable for the surface.
 re_VkGPU __re_selectVulkanGPU(
-    const VkInstance instance,
+    const VkPhysicalDevice* gpus,
+    const size_t* gpu_scores,
+    const re_VkCapabilityFlags* gpu_capabilities,
+    const uint32_t gpu_count,
     const VkSurfaceKHR surface
 );
 
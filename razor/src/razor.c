@@ -4,6 +4,22 @@
 
 static re_EngineModuleFlag modules_init_flag = 0u;
 
+// *=================================================
+// *
+// * __re_getModuleName
+// *
+// *=================================================
+
+static const char* __re_getModuleName(const re_EngineModuleBits module) {
+    switch (module) {
+        case RE_ALL_MODULES: return "all";
+        case RE_CORE_MODULE: return "core";
+        case RE_DEBUG_MODULE: return "debug";
+        case RE_GRAPHICS_MODULE: return "graphics";
+        default: return "unknown";
+    }
+}
+
 // *=================================================
 // *
 // * __re_checkModuleInit
@@ -22,6 +38,8 @@ bool __re_checkModuleInit(const re_EngineModuleFlag modules_flag) {
 
 void __re_setModuleInit(const re_EngineModuleBits module) {
     modules_init_flag |= module;
+
+    re_recordFlightEvent(RE_FLIGHT_EVENT_MODULE, "Initialized module: %s", __re_getModuleName(module));
 }
 
 // *=================================================
@@ -35,6 +53,11 @@ void re_init(const re_InitParams* params) {
 
     re_assert(params != RE_NULL_HANDLE, "Attempted to initialize engine modules with NULL parameters!");
 
+    RE_PROFILE_FUNCTION_BEGIN();
+
+    re_debugInit();
     re_coreInit(&params->core);
     re_graphicsInit();
+
+    RE_PROFILE_END();
 }
\ No newline at end of file
@@ -33,6 +33,27 @@ void __re_setModuleInit(const re_EngineModuleBits module);
     __re_setModuleInit( module ); \
 } while(0)
 
+// *=================================================
+// *
+// * Allocation Tagging
+// *
+// *=================================================
+
+#ifdef RE_MEMORY_TRACKING_ENABLED
+    /// @brief Set the engine module the calling thread's re_malloc allocations are tagged with.
+    /// @param module The module to tag allocations with (0 tags them as application memory).
+    /// @return The previously set module.
+    re_EngineModuleFlag __re_setMemoryModule(const re_EngineModuleFlag module);
+
+    // ? BEGIN/END must be paired within the same block; END restores the module
+    // ? that was active at BEGIN, so scopes nest across engine calls.
+    #define RE_MEMORY_MODULE_BEGIN(module) const re_EngineModuleFlag __re_prev_memory_module = __re_setMemoryModule( module )
+    #define RE_MEMORY_MODULE_END() ((void)__re_setMemoryModule( __re_prev_memory_module ))
+#else
+    #define RE_MEMORY_MODULE_BEGIN(module) ((void)(0))
+    #define RE_MEMORY_MODULE_END() ((void)(0))
+#endif
+
 // *=================================================
 // *
 // * Global Variables
@@ -44,4 +65,17 @@ extern uint8_t RE_APP_MAJOR_VER;
 extern uint8_t RE_APP_MINOR_VER;
 extern uint8_t RE_APP_PATCH_VER;
 
+// ? Scratch arena for short-lived buffers. Callers take a mark before pushing
+// ? and rewind to it before returning. Each thread gets its own arena on first
+// ? use, so engine calls made from jobs never share one.
+#define RE_SCRATCH_ARENA_CAPACITY (1024u * 1024u)
+#define RE_SCRATCH_ARENA __re_getScratchArena()
+
+/// @brief Get the calling thread's scratch arena, creating it on first use.
+/// @return The calling thread's scratch arena.
+re_Arena __re_getScratchArena();
+
+/// @brief Destroy the calling thread's scratch arena (does nothing if it was never used).
+void __re_releaseScratchArena();
+
 #endif
\ No newline at end of file
@@ -0,0 +1,328 @@
+#include <re_containers.h>
+
+#include <re_debug.h>
+
+#include <string.h>
+
+typedef struct re_Array_T {
+    uint8_t* data;
+    size_t element_size;
+    size_t alignment;
+
+    uint32_t count;
+    uint32_t capacity;
+
+    re_Allocator allocator;
+} re_Array_T;
+
+// *=================================================
+// *
+// * __re_reallocateArray
+// *
+// *=================================================
+
+static bool __re_reallocateArray(re_Array array, const uint32_t min_capacity) {
+    // ? Rounding the storage up to the alignment is free capacity, so it is
+    // ? handed out as extra elements rather than left as padding.
+    const size_t min_size = (size_t)min_capacity * array->element_size;
+    const size_t size = (min_size + array->alignment - 1) & ~(array->alignment - 1);
+    const size_t capacity = size / array->element_size;
+
+    uint8_t* data = (uint8_t*)array->allocator.alloc(array->allocator.user_data, size, array->alignment);
+
+    if (data == RE_NULL_HANDLE) {
+        return false;
+    }
+
+    if (array->data != RE_NULL_HANDLE) {
+        if (array->count > 0) {
+            re_memcpy(data, array->data, (size_t)array->count * array->element_size);
+        }
+
+        array->allocator.free(array->allocator.user_data, array->data);
+    }
+
+    array->data = data;
+    array->capacity = capacity < UINT32_MAX ? (uint32_t)capacity : UINT32_MAX;
+
+    return true;
+}
+
+// *=================================================
+// *
+// * __re_growArray
+// *
+// *=================================================
+
+static bool __re_growArray(re_Array array, const uint64_t min_capacity) {
+    if (min_capacity <= array->capacity) {
+        return true;
+    }
+
+    re_assert(min_capacity <= UINT32_MAX, "Array cannot hold %llu elements!", (unsigned long long)min_capacity);
+
+    if (min_capacity > UINT32_MAX) {
+        return false;
+    }
+
+    // ? Doubling keeps a run of pushes amortized to a constant number of copies per element.
+    const uint64_t doubled_capacity = (uint64_t)array->capacity * 2u;
+    const uint64_t capacity = doubled_capacity > min_capacity ? doubled_capacity : min_capacity;
+
+    return __re_reallocateArray(array, capacity < UINT32_MAX ? (uint32_t)capacity : UINT32_MAX);
+}
+
+// *=================================================
+// *
+// * re_createArray
+// *
+// *=================================================
+
+re_Array re_createArray(const re_ArrayCreateInfo* create_info) {
+    re_assert(create_info != RE_NULL_HANDLE, "Attempting to create array with NULL create info!");
+    re_assert(create_info->element_size > 0, "Cannot create an array of 0 byte elements!");
+
+    const size_t alignment = create_info->alignment > 0 ? create_info->alignment : RE_CONTAINER_DEFAULT_ALIGNMENT;
+    re_assert((alignment & (alignment - 1)) == 0, "Alignment must be power-of-two!");
+
+    const re_Allocator allocator = create_info->allocator != RE_NULL_HANDLE ? *create_info->allocator : re_getHeapAllocator();
+    re_Array array = (re_Array)allocator.alloc(allocator.user_data, sizeof(re_Array_T), _Alignof(re_Array_T));
+
+    if (array == RE_NULL_HANDLE) {
+        return RE_NULL_HANDLE;
+    }
+
+    re_memset(array, 0, sizeof(re_Array_T));
+    array->element_size = create_info->element_size;
+    array->alignment = alignment;
+    array->allocator = allocator;
+
+    if (create_info->capacity > 0 && !__re_reallocateArray(array, create_info->capacity)) {
+        allocator.free(allocator.user_data, array);
+        return RE_NULL_HANDLE;
+    }
+
+    return array;
+}
+
+// *=================================================
+// *
+// * re_destroyArray
+// *
+// *=================================================
+
+void re_destroyArray(re_Array* array) {
+    re_assert(array != RE_NULL_HANDLE, "Attempting to destroy NULL array!");
+
+    re_Array array_data = *array;
+    re_assert(array_data != RE_NULL_HANDLE, "Attempting to destroy NULL array!");
+
+    const re_Allocator allocator = array_data->allocator;
+
+    if (array_data->data != RE_NULL_HANDLE) {
+        allocator.free(allocator.user_data, array_data->data);
+    }
+
+    allocator.free(allocator.user_data, array_data);
+    *array = RE_NULL_HANDLE;
+}
+
+// *=================================================
+// *
+// * re_getArrayData
+// *
+// *=================================================
+
+void* re_getArrayData(const re_Array array) {
+    re_assert(array != RE_NULL_HANDLE, "Attempting to get data of NULL array!");
+
+    return array->data;
+}
+
+// *=================================================
+// *
+// * re_getArrayElement
+// *
+// *=================================================
+
+void* re_getArrayElement(const re_Array array, const uint32_t index) {
+    re_assert(array != RE_NULL_HANDLE, "Attempting to get element of NULL array!");
+    re_assert(index < array->count, "Array index %u out of bounds (count %u)!", index, array->count);
+
+    return array->data + (size_t)index * array->element_size;
+}
+
+// *=================================================
+// *
+// * re_getArrayCount
+// *
+// *=================================================
+
+uint32_t re_getArrayCount(const re_Array array) {
+    re_assert(array != RE_NULL_HANDLE, "Attempting to get count of NULL array!");
+
+    return array->count;
+}
+
+// *=================================================
+// *
+// * re_getArrayCapacity
+// *
+// *=================================================
+
+uint32_t re_getArrayCapacity(const re_Array array) {
+    re_assert(array != RE_NULL_HANDLE, "Attempting to get capacity of NULL array!");
+
+    return array->capacity;
+}
+
+// *=================================================
+// *
+// * re_reserveArray
+// *
+// *=================================================
+
+bool re_reserveArray(re_Array array, const uint32_t capacity) {
+    re_assert(array != RE_NULL_HANDLE, "Attempting to reserve NULL array!");
+
+    if (capacity <= array->capacity) {
+        return true;
+    }
+
+    // ? An explicit reserve asks for an exact size, so it skips the doubling.
+    return __re_reallocateArray(array, capacity);
+}
+
+// *=================================================
+// *
+// * re_resizeArray
+// *
+// *=================================================
+
+bool re_resizeArray(re_Array array, const uint32_t count) {
+    re_assert(array != RE_NULL_HANDLE, "Attempting to resize NULL array!");
+
+    if (count > array->count) {
+        if (!__re_growArray(array, count)) {
+            return false;
+        }
+
+        re_memset(array->data + (size_t)array->count * array->element_size, 0, (size_t)(count - array->count) * array->element_size);
+    }
+
+    array->count = count;
+
+    return true;
+}
+
+// *=================================================
+// *
+// * re_arrayPush
+// *
+// *=================================================
+
+void* re_arrayPush(re_Array array, const void* element) {
+    return re_arrayPushMany(array, element, 1);
+}
+
+// *=================================================
+// *
+// * re_arrayPushMany
+// *
+// *=================================================
+
+void* re_arrayPushMany(re_Array array, const void* elements, const uint32_t count) {
+    re_assert(array != RE_NULL_HANDLE, "Attempting to push onto NULL array!");
+    re_assert(count > 0, "Cannot push 0 elements!");
+
+    if (!__re_growArray(array, (uint64_t)array->count + count)) {
+        return RE_NULL_HANDLE;
+    }
+
+    uint8_t* dst = array->data + (size_t)array->count * array->element_size;
+    const size_t size = (size_t)count * array->element_size;
+
+    if (elements != RE_NULL_HANDLE) {
+        re_memcpy(dst, elements, size);
+    }
+    else {
+        re_memset(dst, 0, size);
+    }
+
+    array->count += count;
+
+    return dst;
+}
+
+// *=================================================
+// *
+// * re_arrayPop
+// *
+// *=================================================
+
+void re_arrayPop(re_Array array, void* element) {
+    re_assert(array != RE_NULL_HANDLE, "Attempting to pop from NULL array!");
+    re_assert(array->count > 0, "Attempting to pop from empty array!");
+
+    --array->count;
+
+    if (element != RE_NULL_HANDLE) {
+        re_memcpy(element, array->data + (size_t)array->count * array->element_size, array->element_size);
+    }
+}
+
+// *=================================================
+// *
+// * re_arrayRemove
+// *
+// *=================================================
+
+void re_arrayRemove(re_Array array, const uint32_t index) {
+    re_assert(array != RE_NULL_HANDLE, "Attempting to remove from NULL array!");
+    re_assert(index < array->count, "Array index %u out of bounds (count %u)!", index, array->count);
+
+    uint8_t* dst = array->data + (size_t)index * array->element_size;
+    const size_t tail_size = (size_t)(array->count - index - 1u) * array->element_size;
+
+    if (tail_size > 0) {
+        // ? The ranges overlap, which re_memcpy does not allow.
+        memmove(dst, dst + array->element_size, tail_size);
+    }
+
+    --array->count;
+}
+
+// *=================================================
+// *
+// * re_arrayRemoveSwap
+// *
+// *=================================================
+
+void re_arrayRemoveSwap(re_Array array, const uint32_t index) {
+    re_assert(array != RE_NULL_HANDLE, "Attempting to remove from NULL array!");
+    re_assert(index < array->count, "Array index %u out of bounds (count %u)!", index, array->count);
+
+    const uint32_t last_index = array->count - 1u;
+
+    if (index != last_index) {
+        re_memcpy(
+            array->data + (size_t)index * array->element_size,
+            array->data + (size_t)last_index * array->element_size,
+            array->element_size
+        );
+    }
+
+    array->count = last_index;
+}
+
+// *=================================================
+// *
+// * re_clearArray
+// *
+// *=================================================
+
+void re_clearArray(re_Array array) {
+    re_assert(array != RE_NULL_HANDLE, "Attempting to clear NULL array!");
+
+    array->count = 0;
+}
\ No newline at end of file
@@ -0,0 +1,581 @@
+#include <re_containers.h>
+
+#include <re_debug.h>
+#include <re_utils.h>
+
+#include <string.h>
+
+// ? Control bytes are either a full slot's 7-bit hash (high bit clear) or one
+// ? of the markers below (high bit set), so one sign test finds free slots.
+#define __RE_HASH_MAP_CTRL_EMPTY ((int8_t)-128)
+#define __RE_HASH_MAP_CTRL_DELETED ((int8_t)-2)
+
+#define __RE_HASH_MAP_GROUP_SIZE 16u
+#define __RE_HASH_MAP_STORAGE_ALIGNMENT 64u
+
+#if defined(__SSE2__) || defined(_M_X64)
+    #include <emmintrin.h>
+    #define __RE_HASH_MAP_SIMD_SSE2
+#elif defined(__ARM_NEON) || defined(_M_ARM64)
+    #include <arm_neon.h>
+    #define __RE_HASH_MAP_SIMD_NEON
+#endif
+
+#ifdef _MSC_VER
+    #include <intrin.h>
+#endif
+
+typedef struct re_HashMap_T {
+    int8_t* ctrl;
+    uint8_t* keys;
+    uint8_t* values;
+
+    size_t key_size;
+    size_t value_size;
+
+    uint32_t capacity;
+    uint32_t count;
+
+    // ? Inserts left before the map must grow. Tombstones use up growth just
+    // ? like entries, since only empty slots end a probe.
+    uint32_t growth_left;
+
+    re_HashMapHashFn hash_fn;
+    re_HashMapEqualFn equal_fn;
+
+    re_Allocator allocator;
+} re_HashMap_T;
+
+// *=================================================
+// *
+// * Group Primitives
+// *
+// *=================================================
+
+// ? Masks hold __RE_HASH_MAP_MASK_BITS bits per slot with only the top one
+// ? set (NEON has no movemask, so its narrowing trick yields a nibble per
+// ? byte), slot 0 in the lowest bits.
+
+#if defined(__RE_HASH_MAP_SIMD_SSE2)
+
+#define __RE_HASH_MAP_MASK_BITS 1u
+
+typedef __m128i __re_HashMapGroup;
+
+static inline __re_HashMapGroup __re_loadHashMapGroup(const int8_t* ctrl) {
+    return _mm_load_si128((const __m128i*)ctrl);
+}
+
+static inline uint64_t __re_matchHashMapGroup(const __re_HashMapGroup group, const int8_t ctrl) {
+    return (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(group, _mm_set1_epi8(ctrl)));
+}
+
+static inline uint64_t __re_matchHashMapGroupFree(const __re_HashMapGroup group) {
+    return (uint32_t)_mm_movemask_epi8(group);
+}
+
+#elif defined(__RE_HASH_MAP_SIMD_NEON)
+
+#define __RE_HASH_MAP_MASK_BITS 4u
+
+typedef int8x16_t __re_HashMapGroup;
+
+static inline __re_HashMapGroup __re_loadHashMapGroup(const int8_t* ctrl) {
+    return vld1q_s8(ctrl);
+}
+
+static inline uint64_t __re_getHashMapGroupMask(const uint8x16_t cmp) {
+    const uint8x8_t narrowed = vshrn_n_u16(vreinterpretq_u16_u8(cmp), 4);
+    return vget_lane_u64(vreinterpret_u64_u8(narrowed), 0) & 0x8888888888888888ull;
+}
+
+static inline uint64_t __re_matchHashMapGroup(const __re_HashMapGroup group, const int8_t ctrl) {
+    return __re_getHashMapGroupMask(vceqq_s8(group, vdupq_n_s8(ctrl)));
+}
+
+static inline uint64_t __re_matchHashMapGroupFree(const __re_HashMapGroup group) {
+    return __re_getHashMapGroupMask(vcltzq_s8(group));
+}
+
+#else
+
+#define __RE_HASH_MAP_MASK_BITS 1u
+
+typedef const int8_t* __re_HashMapGroup;
+
+static inline __re_HashMapGroup __re_loadHashMapGroup(const int8_t* ctrl) {
+    return ctrl;
+}
+
+static inline uint64_t __re_matchHashMapGroup(const __re_HashMapGroup group, const int8_t ctrl) {
+    uint64_t mask = 0;
+
+    for (uint32_t idx = 0; idx < __RE_HASH_MAP_GROUP_SIZE; ++idx) {
+        mask |= (uint64_t)(group[idx] == ctrl) << idx;
+    }
+
+    return mask;
+}
+
+static inline uint64_t __re_matchHashMapGroupFree(const __re_HashMapGroup group) {
+    uint64_t mask = 0;
+
+    for (uint32_t idx = 0; idx < __RE_HASH_MAP_GROUP_SIZE; ++idx) {
+        mask |= (uint64_t)(group[idx] < 0) << idx;
+    }
+
+    return mask;
+}
+
+#endif
+
+static inline uint64_t __re_matchHashMapGroupEmpty(const __re_HashMapGroup group) {
+    return __re_matchHashMapGroup(group, __RE_HASH_MAP_CTRL_EMPTY);
+}
+
+static inline uint32_t __re_getFirstHashMapMaskSlot(const uint64_t mask) {
+    #ifdef _MSC_VER
+    unsigned long idx = 0;
+    _BitScanForward64(&idx, mask);
+
+    return (uint32_t)idx / __RE_HASH_MAP_MASK_BITS;
+    #else
+    return (uint32_t)__builtin_ctzll(mask) / __RE_HASH_MAP_MASK_BITS;
+    #endif
+}
+
+// *=================================================
+// *
+// * Default Key Functions
+// *
+// *=================================================
+
+static uint64_t __re_hashHashMapKey(const void* key, const size_t key_size) {
+    return re_hashStr((const char*)key, key_size);
+}
+
+static bool __re_isHashMapKeyEqual(const void* key_a, const void* key_b, const size_t key_size) {
+    return memcmp(key_a, key_b, key_size) == 0;
+}
+
+// *=================================================
+// *
+// * __re_getHashMapGrowth
+// *
+// *=================================================
+
+// ? The map is kept at most 7/8 full; with at least one group, every probe
+// ? therefore meets an empty slot.
+static inline uint32_t __re_getHashMapGrowth(const uint32_t capacity) {
+    return capacity - capacity / 8u;
+}
+
+// *=================================================
+// *
+// * __re_getHashMapCapacity
+// *
+// *=================================================
+
+static uint64_t __re_getHashMapCapacity(const uint32_t count) {
+    uint64_t capacity = __RE_HASH_MAP_GROUP_SIZE;
+
+    while (capacity - capacity / 8u < count) {
+        capacity *= 2u;
+    }
+
+    return capacity;
+}
+
+// *=================================================
+// *
+// * __re_findHashMapSlot
+// *
+// *=================================================
+
+// ? Groups are probed triangularly (1, 2, 3, ... groups apart), which visits
+// ? every group once the group count is a power of two.
+static uint32_t __re_findHashMapSlot(const re_HashMap map, const void* key, const uint64_t hash) {
+    const int8_t h2 = (int8_t)(hash & 0x7fu);
+    const uint32_t group_mask = map->capacity / __RE_HASH_MAP_GROUP_SIZE - 1u;
+
+    uint32_t group_idx = (uint32_t)(hash >> 7) & group_mask;
+
+    for (uint32_t step = 1;; ++step) {
+        const uint32_t base = group_idx * __RE_HASH_MAP_GROUP_SIZE;
+        const __re_HashMapGroup group = __re_loadHashMapGroup(map->ctrl + base);
+
+        for (uint64_t mask = __re_matchHashMapGroup(group, h2); mask != 0; mask &= mask - 1u) {
+            const uint32_t slot = base + __re_getFirstHashMapMaskSlot(mask);
+
+            if (map->equal_fn(map->keys + (size_t)slot * map->key_size, key, map->key_size)) {
+                return slot;
+            }
+        }
+
+        if (__re_matchHashMapGroupEmpty(group) != 0) {
+            return UINT32_MAX;
+        }
+
+        group_idx = (group_idx + step) & group_mask;
+    }
+}
+
+// *=================================================
+// *
+// * __re_findHashMapFreeSlot
+// *
+// *=================================================
+
+static uint32_t __re_findHashMapFreeSlot(const re_HashMap map, const uint64_t hash) {
+    const uint32_t group_mask = map->capacity / __RE_HASH_MAP_GROUP_SIZE - 1u;
+
+    uint32_t group_idx = (uint32_t)(hash >> 7) & group_mask;
+
+    for (uint32_t step = 1;; ++step) {
+        const uint32_t base = group_idx * __RE_HASH_MAP_GROUP_SIZE;
+        const uint64_t mask = __re_matchHashMapGroupFree(__re_loadHashMapGroup(map->ctrl + base));
+
+        if (mask != 0) {
+            return base + __re_getFirstHashMapMaskSlot(mask);
+        }
+
+        group_idx = (group_idx + step) & group_mask;
+    }
+}
+
+// *=================================================
+// *
+// * __re_rehashHashMap
+// *
+// *=================================================
+
+// ? Rehashing always moves to a fresh block (even at the same capacity, when
+// ? it only clears tombstones), so entries never have to be shuffled in place.
+static bool __re_rehashHashMap(re_HashMap map, const uint32_t capacity) {
+    const size_t keys_offset = capacity;
+    const size_t keys_size = ((size_t)capacity * map->key_size + __RE_HASH_MAP_GROUP_SIZE - 1) & ~((size_t)__RE_HASH_MAP_GROUP_SIZE - 1);
+    const size_t values_offset = keys_offset + keys_size;
+    const size_t size = values_offset + (size_t)capacity * map->value_size;
+
+    uint8_t* data = (uint8_t*)map->allocator.alloc(map->allocator.user_data, size, __RE_HASH_MAP_STORAGE_ALIGNMENT);
+
+    if (data == RE_NULL_HANDLE) {
+        return false;
+    }
+
+    re_HashMap_T old_map = *map;
+
+    map->ctrl = (int8_t*)data;
+    map->keys = data + keys_offset;
+    map->values = data + values_offset;
+    map->capacity = capacity;
+    map->growth_left = __re_getHashMapGrowth(capacity) - old_map.count;
+
+    memset(map->ctrl, (uint8_t)__RE_HASH_MAP_CTRL_EMPTY, capacity);
+
+    for (uint32_t idx = 0; idx < old_map.capacity; ++idx) {
+        if (old_map.ctrl[idx] < 0) {
+            continue;
+        }
+
+        const uint8_t* key = old_map.keys + (size_t)idx * map->key_size;
+        const uint32_t slot = __re_findHashMapFreeSlot(map, map->hash_fn(key, map->key_size));
+
+        map->ctrl[slot] = old_map.ctrl[idx];
+        memcpy(map->keys + (size_t)slot * map->key_size, key, map->key_size);
+
+        if (map->value_size > 0) {
+            memcpy(map->values + (size_t)slot * map->value_size, old_map.values + (size_t)idx * map->value_size, map->value_size);
+        }
+    }
+
+    if (old_map.ctrl != RE_NULL_HANDLE) {
+        map->allocator.free(map->allocator.user_data, old_map.ctrl);
+    }
+
+    return true;
+}
+
+// *=================================================
+// *
+// * __re_getHashMapValue
+// *
+// *=================================================
+
+static inline void* __re_getHashMapValue(const re_HashMap map, const uint32_t slot) {
+    if (map->value_size == 0) {
+        return map->keys + (size_t)slot * map->key_size;
+    }
+
+    return map->values + (size_t)slot * map->value_size;
+}
+
+// *=================================================
+// *
+// * re_createHashMap
+// *
+// *=================================================
+
+re_HashMap re_createHashMap(const re_HashMapCreateInfo* create_info) {
+    re_assert(create_info != RE_NULL_HANDLE, "Attempting to create hash map with NULL create info!");
+    re_assert(create_info->key_size > 0, "Cannot create a hash map of 0 byte keys!");
+
+    const re_Allocator allocator = create_info->allocator != RE_NULL_HANDLE ? *create_info->allocator : re_getHeapAllocator();
+    re_HashMap map = (re_HashMap)allocator.alloc(allocator.user_data, sizeof(re_HashMap_T), _Alignof(re_HashMap_T));
+
+    if (map == RE_NULL_HANDLE) {
+        return RE_NULL_HANDLE;
+    }
+
+    re_memset(map, 0, sizeof(re_HashMap_T));
+    map->key_size = create_info->key_size;
+    map->value_size = create_info->value_size;
+    map->hash_fn = create_info->hash_fn != RE_NULL_HANDLE ? create_info->hash_fn : __re_hashHashMapKey;
+    map->equal_fn = create_info->equal_fn != RE_NULL_HANDLE ? create_info->equal_fn : __re_isHashMapKeyEqual;
+    map->allocator = allocator;
+
+    if (create_info->capacity > 0 && !re_reserveHashMap(map, create_info->capacity)) {
+        allocator.free(allocator.user_data, map);
+        return RE_NULL_HANDLE;
+    }
+
+    return map;
+}
+
+// *=================================================
+// *
+// * re_destroyHashMap
+// *
+// *=================================================
+
+void re_destroyHashMap(re_HashMap* map) {
+    re_assert(map != RE_NULL_HANDLE, "Attempting to destroy NULL hash map!");
+
+    re_HashMap map_data = *map;
+    re_assert(map_data != RE_NULL_HANDLE, "Attempting to destroy NULL hash map!");
+
+    const re_Allocator allocator = map_data->allocator;
+
+    if (map_data->ctrl != RE_NULL_HANDLE) {
+        allocator.free(allocator.user_data, map_data->ctrl);
+    }
+
+    allocator.free(allocator.user_data, map_data);
+    *map = RE_NULL_HANDLE;
+}
+
+// *=================================================
+// *
+// * re_getHashMapCount
+// *
+// *=================================================
+
+uint32_t re_getHashMapCount(const re_HashMap map) {
+    re_assert(map != RE_NULL_HANDLE, "Attempting to get count of NULL hash map!");
+
+    return map->count;
+}
+
+// *=================================================
+// *
+// * re_reserveHashMap
+// *
+// *=================================================
+
+bool re_reserveHashMap(re_HashMap map, const uint32_t count) {
+    re_assert(map != RE_NULL_HANDLE, "Attempting to reserve NULL hash map!");
+
+    if (map->capacity > 0 && count <= map->count + map->growth_left) {
+        return true;
+    }
+
+    const uint64_t capacity = __re_getHashMapCapacity(count);
+    re_assert(capacity <= UINT32_MAX / 2u + 1u, "Hash map cannot hold %u entries!", count);
+
+    return __re_rehashHashMap(map, (uint32_t)capacity);
+}
+
+// *=================================================
+// *
+// * re_hashMapFind
+// *
+// *=================================================
+
+void* re_hashMapFind(const re_HashMap map, const void* key) {
+    re_assert(map != RE_NULL_HANDLE, "Attempting to search NULL hash map!");
+    re_assert(key != RE_NULL_HANDLE, "Cannot search hash map for NULL key!");
+
+    if (map->count == 0) {
+        return RE_NULL_HANDLE;
+    }
+
+    const uint32_t slot = __re_findHashMapSlot(map, key, map->hash_fn(key, map->key_size));
+
+    if (slot == UINT32_MAX) {
+        return RE_NULL_HANDLE;
+    }
+
+    return __re_getHashMapValue(map, slot);
+}
+
+// *=================================================
+// *
+// * re_hashMapFindOrInsert
+// *
+// *=================================================
+
+void* re_hashMapFindOrInsert(re_HashMap map, const void* key, bool* is_new) {
+    re_assert(map != RE_NULL_HANDLE, "Attempting to insert into NULL hash map!");
+    re_assert(key != RE_NULL_HANDLE, "Cannot insert NULL key into hash map!");
+
+    const uint64_t hash = map->hash_fn(key, map->key_size);
+
+    if (map->count > 0) {
+        const uint32_t slot = __re_findHashMapSlot(map, key, hash);
+
+        if (slot != UINT32_MAX) {
+            if (is_new != RE_NULL_HANDLE) {
+                *is_new = false;
+            }
+
+            return __re_getHashMapValue(map, slot);
+        }
+    }
+
+    uint32_t slot = map->capacity > 0 ? __re_findHashMapFreeSlot(map, hash) : UINT32_MAX;
+
+    // ? Reusing a tombstone costs no growth; only a fresh empty slot does.
+    if (slot == UINT32_MAX || (map->growth_left == 0 && map->ctrl[slot] == __RE_HASH_MAP_CTRL_EMPTY)) {
+        // ? A map mostly made of tombstones is rebuilt at the same size rather than doubled.
+        const uint64_t capacity = map->capacity > 0 && (uint64_t)(map->count + 1u) * 16u <= (uint64_t)map->capacity * 7u ?
+            map->capacity :
+            __re_getHashMapCapacity(map->count + 1u);
+
+        if (capacity > UINT32_MAX / 2u + 1u || !__re_rehashHashMap(map, (uint32_t)capacity)) {
+            return RE_NULL_HANDLE;
+        }
+
+        slot = __re_findHashMapFreeSlot(map, hash);
+    }
+
+    if (map->ctrl[slot] == __RE_HASH_MAP_CTRL_EMPTY) {
+        --map->growth_left;
+    }
+
+    map->ctrl[slot] = (int8_t)(hash & 0x7fu);
+    memcpy(map->keys + (size_t)slot * map->key_size, key, map->key_size);
+    ++map->count;
+
+    if (map->value_size > 0) {
+        memset(map->values + (size_t)slot * map->value_size, 0, map->value_size);
+    }
+
+    if (is_new != RE_NULL_HANDLE) {
+        *is_new = true;
+    }
+
+    return __re_getHashMapValue(map, slot);
+}
+
+// *=================================================
+// *
+// * re_hashMapInsert
+// *
+// *=================================================
+
+void* re_hashMapInsert(re_HashMap map, const void* key, const void* value) {
+    void* dst = re_hashMapFindOrInsert(map, key, RE_NULL_HANDLE);
+
+    if (dst != RE_NULL_HANDLE && map->value_size > 0 && value != RE_NULL_HANDLE) {
+        memcpy(dst, value, map->value_size);
+    }
+
+    return dst;
+}
+
+// *=================================================
+// *
+// * re_hashMapRemove
+// *
+// *=================================================
+
+bool re_hashMapRemove(re_HashMap map, const void* key) {
+    re_assert(map != RE_NULL_HANDLE, "Attempting to remove from NULL hash map!");
+    re_assert(key != RE_NULL_HANDLE, "Cannot remove NULL key from hash map!");
+
+    if (map->count == 0) {
+        return false;
+    }
+
+    const uint32_t slot = __re_findHashMapSlot(map, key, map->hash_fn(key, map->key_size));
+
+    if (slot == UINT32_MAX) {
+        return false;
+    }
+
+    // ? A group that still has an empty slot has never been full, so no probe
+    // ? ever passed through it and the slot can simply become empty again.
+    // ? Only a group that filled up needs a tombstone to keep later probes going.
+    const uint32_t base = slot & ~(__RE_HASH_MAP_GROUP_SIZE - 1u);
+
+    if (__re_matchHashMapGroupEmpty(__re_loadHashMapGroup(map->ctrl + base)) != 0) {
+        map->ctrl[slot] = __RE_HASH_MAP_CTRL_EMPTY;
+        ++map->growth_left;
+    }
+    else {
+        map->ctrl[slot] = __RE_HASH_MAP_CTRL_DELETED;
+    }
+
+    --map->count;
+
+    return true;
+}
+
+// *=================================================
+// *
+// * re_hashMapNext
+// *
+// *=================================================
+
+bool re_hashMapNext(const re_HashMap map, uint32_t* iterator, const void** key, void** value) {
+    re_assert(map != RE_NULL_HANDLE, "Attempting to iterate NULL hash map!");
+    re_assert(iterator != RE_NULL_HANDLE, "Cannot iterate hash map with NULL iterator!");
+
+    for (uint32_t slot = *iterator; slot < map->capacity; ++slot) {
+        if (map->ctrl[slot] < 0) {
+            continue;
+        }
+
+        if (key != RE_NULL_HANDLE) {
+            *key = map->keys + (size_t)slot * map->key_size;
+        }
+
+        if (value != RE_NULL_HANDLE) {
+            *value = __re_getHashMapValue(map, slot);
+        }
+
+        *iterator = slot + 1u;
+        return true;
+    }
+
+    *iterator = map->capacity;
+    return false;
+}
+
+// *=================================================
+// *
+// * re_clearHashMap
+// *
+// *=================================================
+
+void re_clearHashMap(re_HashMap map) {
+    re_assert(map != RE_NULL_HANDLE, "Attempting to clear NULL hash map!");
+
+    if (map->capacity == 0) {
+        return;
+    }
+
+    memset(map->ctrl, (uint8_t)__RE_HASH_MAP_CTRL_EMPTY, map->capacity);
+    map->count = 0;
+    map->growth_left = __re_getHashMapGrowth(map->capacity);
+}
\ No newline at end of file
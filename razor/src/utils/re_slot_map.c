@@ -0,0 +1,335 @@
+#include <re_containers.h>
+
+#include <re_debug.h>
+
+#include <string.h>
+
+#define __RE_SLOT_MAP_NO_FREE_SLOT UINT32_MAX
+
+// ? A slot's generation is odd while it holds a value and even while it is
+// ? free (each insert and removal bumps it), so neither a handle to a freed
+// ? slot nor RE_HANDLE_NULL can ever match. A free slot reuses dense_index as
+// ? the index of the next free slot.
+typedef struct __re_SlotMapSlot {
+    uint32_t dense_index;
+    uint32_t generation;
+} __re_SlotMapSlot;
+
+// ? Slots only ever outnumber live values by the ones freed, so slots, values
+// ? and the dense-to-slot back references all fit the same capacity and share
+// ? one block.
+typedef struct re_SlotMap_T {
+    uint8_t* values;
+    __re_SlotMapSlot* slots;
+    uint32_t* dense_slots;
+
+    size_t value_size;
+    size_t alignment;
+
+    uint32_t count;
+    uint32_t slot_count;
+    uint32_t capacity;
+    uint32_t free_slot;
+
+    re_Allocator allocator;
+} re_SlotMap_T;
+
+// *=================================================
+// *
+// * __re_getSlotMapSlot
+// *
+// *=================================================
+
+static inline const __re_SlotMapSlot* __re_getSlotMapSlot(const re_SlotMap map, const re_Handle handle) {
+    const uint32_t index = RE_HANDLE_INDEX(handle);
+
+    if (index >= map->slot_count) {
+        return RE_NULL_HANDLE;
+    }
+
+    const __re_SlotMapSlot* slot = &map->slots[index];
+
+    if (slot->generation != RE_HANDLE_GENERATION(handle)) {
+        return RE_NULL_HANDLE;
+    }
+
+    return slot;
+}
+
+// *=================================================
+// *
+// * __re_reallocateSlotMap
+// *
+// *=================================================
+
+static bool __re_reallocateSlotMap(re_SlotMap map, const uint32_t capacity) {
+    const size_t values_size = ((size_t)capacity * map->value_size + map->alignment - 1) & ~(map->alignment - 1);
+    const size_t slots_offset = values_size;
+    const size_t dense_slots_offset = slots_offset + (size_t)capacity * sizeof(__re_SlotMapSlot);
+    const size_t size = dense_slots_offset + (size_t)capacity * sizeof(uint32_t);
+
+    uint8_t* data = (uint8_t*)map->allocator.alloc(map->allocator.user_data, size, map->alignment);
+
+    if (data == RE_NULL_HANDLE) {
+        return false;
+    }
+
+    __re_SlotMapSlot* slots = (__re_SlotMapSlot*)(data + slots_offset);
+    uint32_t* dense_slots = (uint32_t*)(data + dense_slots_offset);
+
+    if (map->values != RE_NULL_HANDLE) {
+        if (map->count > 0) {
+            re_memcpy(data, map->values, (size_t)map->count * map->value_size);
+            re_memcpy(dense_slots, map->dense_slots, (size_t)map->count * sizeof(uint32_t));
+        }
+
+        if (map->slot_count > 0) {
+            re_memcpy(slots, map->slots, (size_t)map->slot_count * sizeof(__re_SlotMapSlot));
+        }
+
+        map->allocator.free(map->allocator.user_data, map->values);
+    }
+
+    map->values = data;
+    map->slots = slots;
+    map->dense_slots = dense_slots;
+    map->capacity = capacity;
+
+    return true;
+}
+
+// *=================================================
+// *
+// * re_createSlotMap
+// *
+// *=================================================
+
+re_SlotMap re_createSlotMap(const re_SlotMapCreateInfo* create_info) {
+    re_assert(create_info != RE_NULL_HANDLE, "Attempting to create slot map with NULL create info!");
+    re_assert(create_info->value_size > 0, "Cannot create a slot map of 0 byte values!");
+
+    // ? The slots follow the values in the same block, so the block is never
+    // ? aligned below what the slots need.
+    size_t alignment = create_info->alignment > 0 ? create_info->alignment : RE_CONTAINER_DEFAULT_ALIGNMENT;
+    re_assert((alignment & (alignment - 1)) == 0, "Alignment must be power-of-two!");
+    alignment = alignment > _Alignof(__re_SlotMapSlot) ? alignment : _Alignof(__re_SlotMapSlot);
+
+    const re_Allocator allocator = create_info->allocator != RE_NULL_HANDLE ? *create_info->allocator : re_getHeapAllocator();
+    re_SlotMap map = (re_SlotMap)allocator.alloc(allocator.user_data, sizeof(re_SlotMap_T), _Alignof(re_SlotMap_T));
+
+    if (map == RE_NULL_HANDLE) {
+        return RE_NULL_HANDLE;
+    }
+
+    re_memset(map, 0, sizeof(re_SlotMap_T));
+    map->value_size = create_info->value_size;
+    map->alignment = alignment;
+    map->free_slot = __RE_SLOT_MAP_NO_FREE_SLOT;
+    map->allocator = allocator;
+
+    if (create_info->capacity > 0 && !__re_reallocateSlotMap(map, create_info->capacity)) {
+        allocator.free(allocator.user_data, map);
+        return RE_NULL_HANDLE;
+    }
+
+    return map;
+}
+
+// *=================================================
+// *
+// * re_destroySlotMap
+// *
+// *=================================================
+
+void re_destroySlotMap(re_SlotMap* map) {
+    re_assert(map != RE_NULL_HANDLE, "Attempting to destroy NULL slot map!");
+
+    re_SlotMap map_data = *map;
+    re_assert(map_data != RE_NULL_HANDLE, "Attempting to destroy NULL slot map!");
+
+    const re_Allocator allocator = map_data->allocator;
+
+    if (map_data->values != RE_NULL_HANDLE) {
+        allocator.free(allocator.user_data, map_data->values);
+    }
+
+    allocator.free(allocator.user_data, map_data);
+    *map = RE_NULL_HANDLE;
+}
+
+// *=================================================
+// *
+// * re_slotMapInsert
+// *
+// *=================================================
+
+re_Handle re_slotMapInsert(re_SlotMap map, const void* value) {
+    re_assert(map != RE_NULL_HANDLE, "Attempting to insert into NULL slot map!");
+
+    uint32_t slot_index = map->free_slot;
+
+    if (slot_index == __RE_SLOT_MAP_NO_FREE_SLOT) {
+        re_assert(map->slot_count < UINT32_MAX - 1u, "Slot map cannot hold any more values!");
+
+        if (map->slot_count == map->capacity) {
+            const uint64_t doubled_capacity = map->capacity > 0 ? (uint64_t)map->capacity * 2u : 16u;
+            const uint32_t capacity = doubled_capacity < UINT32_MAX ? (uint32_t)doubled_capacity : UINT32_MAX - 1u;
+
+            if (!__re_reallocateSlotMap(map, capacity)) {
+                return RE_HANDLE_NULL;
+            }
+        }
+
+        slot_index = map->slot_count++;
+        map->slots[slot_index].generation = 1u;
+    }
+    else {
+        map->free_slot = map->slots[slot_index].dense_index;
+        ++map->slots[slot_index].generation;
+    }
+
+    __re_SlotMapSlot* slot = &map->slots[slot_index];
+    const uint32_t dense_index = map->count++;
+
+    slot->dense_index = dense_index;
+    map->dense_slots[dense_index] = slot_index;
+
+    uint8_t* dst = map->values + (size_t)dense_index * map->value_size;
+
+    if (value != RE_NULL_HANDLE) {
+        re_memcpy(dst, value, map->value_size);
+    }
+    else {
+        re_memset(dst, 0, map->value_size);
+    }
+
+    return ((re_Handle)slot->generation << 32) | slot_index;
+}
+
+// *=================================================
+// *
+// * re_slotMapRemove
+// *
+// *=================================================
+
+bool re_slotMapRemove(re_SlotMap map, const re_Handle handle) {
+    re_assert(map != RE_NULL_HANDLE, "Attempting to remove from NULL slot map!");
+
+    if (__re_getSlotMapSlot(map, handle) == RE_NULL_HANDLE) {
+        return false;
+    }
+
+    const uint32_t slot_index = RE_HANDLE_INDEX(handle);
+    __re_SlotMapSlot* slot = &map->slots[slot_index];
+
+    const uint32_t dense_index = slot->dense_index;
+    const uint32_t last_index = --map->count;
+
+    if (dense_index != last_index) {
+        const uint32_t moved_slot_index = map->dense_slots[last_index];
+
+        re_memcpy(
+            map->values + (size_t)dense_index * map->value_size,
+            map->values + (size_t)last_index * map->value_size,
+            map->value_size
+        );
+
+        map->dense_slots[dense_index] = moved_slot_index;
+        map->slots[moved_slot_index].dense_index = dense_index;
+    }
+
+    ++slot->generation;
+    slot->dense_index = map->free_slot;
+    map->free_slot = slot_index;
+
+    return true;
+}
+
+// *=================================================
+// *
+// * re_isSlotMapHandleValid
+// *
+// *=================================================
+
+bool re_isSlotMapHandleValid(const re_SlotMap map, const re_Handle handle) {
+    re_assert(map != RE_NULL_HANDLE, "Attempting to validate handle against NULL slot map!");
+
+    return __re_getSlotMapSlot(map, handle) != RE_NULL_HANDLE;
+}
+
+// *=================================================
+// *
+// * re_slotMapGet
+// *
+// *=================================================
+
+void* re_slotMapGet(const re_SlotMap map, const re_Handle handle) {
+    re_assert(map != RE_NULL_HANDLE, "Attempting to get value from NULL slot map!");
+
+    const __re_SlotMapSlot* slot = __re_getSlotMapSlot(map, handle);
+
+    if (slot == RE_NULL_HANDLE) {
+        return RE_NULL_HANDLE;
+    }
+
+    return map->values + (size_t)slot->dense_index * map->value_size;
+}
+
+// *=================================================
+// *
+// * re_getSlotMapData
+// *
+// *=================================================
+
+void* re_getSlotMapData(const re_SlotMap map) {
+    re_assert(map != RE_NULL_HANDLE, "Attempting to get data of NULL slot map!");
+
+    return map->values;
+}
+
+// *=================================================
+// *
+// * re_getSlotMapCount
+// *
+// *=================================================
+
+uint32_t re_getSlotMapCount(const re_SlotMap map) {
+    re_assert(map != RE_NULL_HANDLE, "Attempting to get count of NULL slot map!");
+
+    return map->count;
+}
+
+// *=================================================
+// *
+// * re_getSlotMapHandle
+// *
+// *=================================================
+
+re_Handle re_getSlotMapHandle(const re_SlotMap map, const uint32_t index) {
+    re_assert(map != RE_NULL_HANDLE, "Attempting to get handle from NULL slot map!");
+    re_assert(index < map->count, "Slot map index %u out of bounds (count %u)!", index, map->count);
+
+    const uint32_t slot_index = map->dense_slots[index];
+
+    return ((re_Handle)map->slots[slot_index].generation << 32) | slot_index;
+}
+
+// *=================================================
+// *
+// * re_clearSlotMap
+// *
+// *=================================================
+
+void re_clearSlotMap(re_SlotMap map) {
+    re_assert(map != RE_NULL_HANDLE, "Attempting to clear NULL slot map!");
+
+    for (uint32_t idx = 0; idx < map->count; ++idx) {
+        __re_SlotMapSlot* slot = &map->slots[map->dense_slots[idx]];
+
+        ++slot->generation;
+        slot->dense_index = map->free_slot;
+        map->free_slot = map->dense_slots[idx];
+    }
+
+    map->count = 0;
+}
\ No newline at end of file
@@ -0,0 +1,318 @@
+#include <re_containers.h>
+
+#include <re_debug.h>
+
+typedef struct re_Soa_T {
+    uint8_t* data;
+    size_t alignment;
+
+    uint32_t count;
+    uint32_t capacity;
+
+    uint32_t column_count;
+    size_t column_sizes[RE_SOA_MAX_COLUMNS];
+    size_t column_offsets[RE_SOA_MAX_COLUMNS];
+
+    re_Allocator allocator;
+} re_Soa_T;
+
+// *=================================================
+// *
+// * __re_getSoaColumnStride
+// *
+// *=================================================
+
+static inline size_t __re_getSoaColumnStride(const re_Soa soa, const uint32_t column, const uint32_t capacity) {
+    const size_t size = (size_t)capacity * soa->column_sizes[column];
+
+    return (size + soa->alignment - 1) & ~(soa->alignment - 1);
+}
+
+// *=================================================
+// *
+// * __re_reallocateSoa
+// *
+// *=================================================
+
+static bool __re_reallocateSoa(re_Soa soa, const uint32_t capacity) {
+    // ? Every column starts on an aligned boundary of the one block, so the
+    // ? whole container is a single allocation however many columns it has.
+    size_t column_offsets[RE_SOA_MAX_COLUMNS];
+    size_t size = 0;
+
+    for (uint32_t idx = 0; idx < soa->column_count; ++idx) {
+        column_offsets[idx] = size;
+        size += __re_getSoaColumnStride(soa, idx, capacity);
+    }
+
+    uint8_t* data = (uint8_t*)soa->allocator.alloc(soa->allocator.user_data, size, soa->alignment);
+
+    if (data == RE_NULL_HANDLE) {
+        return false;
+    }
+
+    if (soa->data != RE_NULL_HANDLE) {
+        if (soa->count > 0) {
+            for (uint32_t idx = 0; idx < soa->column_count; ++idx) {
+                re_memcpy(
+                    data + column_offsets[idx],
+                    soa->data + soa->column_offsets[idx],
+                    (size_t)soa->count * soa->column_sizes[idx]
+                );
+            }
+        }
+
+        soa->allocator.free(soa->allocator.user_data, soa->data);
+    }
+
+    soa->data = data;
+    soa->capacity = capacity;
+    re_memcpy(soa->column_offsets, column_offsets, soa->column_count * sizeof(size_t));
+
+    return true;
+}
+
+// *=================================================
+// *
+// * __re_growSoa
+// *
+// *=================================================
+
+static bool __re_growSoa(re_Soa soa, const uint64_t min_capacity) {
+    if (min_capacity <= soa->capacity) {
+        return true;
+    }
+
+    re_assert(min_capacity <= UINT32_MAX, "Structure-of-arrays cannot hold %llu rows!", (unsigned long long)min_capacity);
+
+    if (min_capacity > UINT32_MAX) {
+        return false;
+    }
+
+    // ? Unlike an array, the rounding slack differs per column, so capacity
+    // ? only ever grows by doubling from a cache line's worth of bytes.
+    const uint64_t doubled_capacity = soa->capacity > 0 ? (uint64_t)soa->capacity * 2u : RE_CONTAINER_DEFAULT_ALIGNMENT / 4u;
+    const uint64_t capacity = doubled_capacity > min_capacity ? doubled_capacity : min_capacity;
+
+    return __re_reallocateSoa(soa, capacity < UINT32_MAX ? (uint32_t)capacity : UINT32_MAX);
+}
+
+// *=================================================
+// *
+// * re_createSoa
+// *
+// *=================================================
+
+re_Soa re_createSoa(const re_SoaCreateInfo* create_info) {
+    re_assert(create_info != RE_NULL_HANDLE, "Attempting to create structure-of-arrays with NULL create info!");
+    re_assert(create_info->column_sizes != RE_NULL_HANDLE, "Attempting to create structure-of-arrays with NULL column sizes!");
+    re_assert(
+        create_info->column_count > 0 && create_info->column_count <= RE_SOA_MAX_COLUMNS,
+        "Structure-of-arrays column count must be within 1 and %u!",
+        RE_SOA_MAX_COLUMNS
+    );
+
+    const size_t alignment = create_info->alignment > 0 ? create_info->alignment : RE_CONTAINER_DEFAULT_ALIGNMENT;
+    re_assert((alignment & (alignment - 1)) == 0, "Alignment must be power-of-two!");
+
+    const re_Allocator allocator = create_info->allocator != RE_NULL_HANDLE ? *create_info->allocator : re_getHeapAllocator();
+    re_Soa soa = (re_Soa)allocator.alloc(allocator.user_data, sizeof(re_Soa_T), _Alignof(re_Soa_T));
+
+    if (soa == RE_NULL_HANDLE) {
+        return RE_NULL_HANDLE;
+    }
+
+    re_memset(soa, 0, sizeof(re_Soa_T));
+    soa->alignment = alignment;
+    soa->column_count = create_info->column_count;
+    soa->allocator = allocator;
+
+    for (uint32_t idx = 0; idx < create_info->column_count; ++idx) {
+        re_assert(create_info->column_sizes[idx] > 0, "Structure-of-arrays column %u has 0 byte values!", idx);
+        soa->column_sizes[idx] = create_info->column_sizes[idx];
+    }
+
+    if (create_info->capacity > 0 && !__re_reallocateSoa(soa, create_info->capacity)) {
+        allocator.free(allocator.user_data, soa);
+        return RE_NULL_HANDLE;
+    }
+
+    return soa;
+}
+
+// *=================================================
+// *
+// * re_destroySoa
+// *
+// *=================================================
+
+void re_destroySoa(re_Soa* soa) {
+    re_assert(soa != RE_NULL_HANDLE, "Attempting to destroy NULL structure-of-arrays!");
+
+    re_Soa soa_data = *soa;
+    re_assert(soa_data != RE_NULL_HANDLE, "Attempting to destroy NULL structure-of-arrays!");
+
+    const re_Allocator allocator = soa_data->allocator;
+
+    if (soa_data->data != RE_NULL_HANDLE) {
+        allocator.free(allocator.user_data, soa_data->data);
+    }
+
+    allocator.free(allocator.user_data, soa_data);
+    *soa = RE_NULL_HANDLE;
+}
+
+// *=================================================
+// *
+// * re_getSoaColumn
+// *
+// *=================================================
+
+void* re_getSoaColumn(const re_Soa soa, const uint32_t column) {
+    re_assert(soa != RE_NULL_HANDLE, "Attempting to get column of NULL structure-of-arrays!");
+    re_assert(column < soa->column_count, "Structure-of-arrays column %u out of bounds (count %u)!", column, soa->column_count);
+
+    if (soa->data == RE_NULL_HANDLE) {
+        return RE_NULL_HANDLE;
+    }
+
+    return soa->data + soa->column_offsets[column];
+}
+
+// *=================================================
+// *
+// * re_getSoaElement
+// *
+// *=================================================
+
+void* re_getSoaElement(const re_Soa soa, const uint32_t column, const uint32_t row) {
+    re_assert(soa != RE_NULL_HANDLE, "Attempting to get element of NULL structure-of-arrays!");
+    re_assert(column < soa->column_count, "Structure-of-arrays column %u out of bounds (count %u)!", column, soa->column_count);
+    re_assert(row < soa->count, "Structure-of-arrays row %u out of bounds (count %u)!", row, soa->count);
+
+    return soa->data + soa->column_offsets[column] + (size_t)row * soa->column_sizes[column];
+}
+
+// *=================================================
+// *
+// * re_getSoaCount
+// *
+// *=================================================
+
+uint32_t re_getSoaCount(const re_Soa soa) {
+    re_assert(soa != RE_NULL_HANDLE, "Attempting to get count of NULL structure-of-arrays!");
+
+    return soa->count;
+}
+
+// *=================================================
+// *
+// * re_getSoaCapacity
+// *
+// *=================================================
+
+uint32_t re_getSoaCapacity(const re_Soa soa) {
+    re_assert(soa != RE_NULL_HANDLE, "Attempting to get capacity of NULL structure-of-arrays!");
+
+    return soa->capacity;
+}
+
+// *=================================================
+// *
+// * re_reserveSoa
+// *
+// *=================================================
+
+bool re_reserveSoa(re_Soa soa, const uint32_t capacity) {
+    re_assert(soa != RE_NULL_HANDLE, "Attempting to reserve NULL structure-of-arrays!");
+
+    if (capacity <= soa->capacity) {
+        return true;
+    }
+
+    return __re_reallocateSoa(soa, capacity);
+}
+
+// *=================================================
+// *
+// * re_resizeSoa
+// *
+// *=================================================
+
+bool re_resizeSoa(re_Soa soa, const uint32_t count) {
+    re_assert(soa != RE_NULL_HANDLE, "Attempting to resize NULL structure-of-arrays!");
+
+    if (count > soa->count) {
+        if (!__re_growSoa(soa, count)) {
+            return false;
+        }
+
+        for (uint32_t idx = 0; idx < soa->column_count; ++idx) {
+            const size_t value_size = soa->column_sizes[idx];
+
+            re_memset(
+                soa->data + soa->column_offsets[idx] + (size_t)soa->count * value_size,
+                0,
+                (size_t)(count - soa->count) * value_size
+            );
+        }
+    }
+
+    soa->count = count;
+
+    return true;
+}
+
+// *=================================================
+// *
+// * re_soaPush
+// *
+// *=================================================
+
+uint32_t re_soaPush(re_Soa soa) {
+    re_assert(soa != RE_NULL_HANDLE, "Attempting to push onto NULL structure-of-arrays!");
+
+    const uint32_t row = soa->count;
+
+    if (!re_resizeSoa(soa, row + 1u)) {
+        return UINT32_MAX;
+    }
+
+    return row;
+}
+
+// *=================================================
+// *
+// * re_soaRemoveSwap
+// *
+// *=================================================
+
+void re_soaRemoveSwap(re_Soa soa, const uint32_t row) {
+    re_assert(soa != RE_NULL_HANDLE, "Attempting to remove from NULL structure-of-arrays!");
+    re_assert(row < soa->count, "Structure-of-arrays row %u out of bounds (count %u)!", row, soa->count);
+
+    const uint32_t last_row = soa->count - 1u;
+
+    if (row != last_row) {
+        for (uint32_t idx = 0; idx < soa->column_count; ++idx) {
+            uint8_t* column = soa->data + soa->column_offsets[idx];
+            const size_t value_size = soa->column_sizes[idx];
+
+            re_memcpy(column + (size_t)row * value_size, column + (size_t)last_row * value_size, value_size);
+        }
+    }
+
+    soa->count = last_row;
+}
+
+// *=================================================
+// *
+// * re_clearSoa
+// *
+// *=================================================
+
+void re_clearSoa(re_Soa soa) {
+    re_assert(soa != RE_NULL_HANDLE, "Attempting to clear NULL structure-of-arrays!");
+
+    soa->count = 0;
+}
\ No newline at end of file
@@ -0,0 +1,264 @@
+#include <re_utils.h>
+
+#include <re_debug.h>
+#include "../re_internals.h"
+#include "../core/re_threads.h"
+
+#include <string.h>
+
+// ? Both buffers only reserve address space up front; records and characters
+// ? are committed as strings are interned and never move, so resolving an ID
+// ? needs no lock.
+#define __RE_STR_INTERN_MAX_STRS (1u << 20)
+#define __RE_STR_INTERN_MAX_CHARS (64u * 1024u * 1024u)
+
+#define __RE_STR_INTERN_INITIAL_SLOT_COUNT 256u
+
+typedef struct __re_StrRecord {
+    const char* str;
+    uint32_t length;
+    uint32_t hash;
+} __re_StrRecord;
+
+// ? Slots keep the hash next to the ID so that probing only leaves the table
+// ? for a string compare once a hash matches.
+typedef struct __re_StrSlot {
+    uint32_t hash;
+    re_StrId id;
+} __re_StrSlot;
+
+static re_VirtualBuffer __re_str_records = RE_NULL_HANDLE;
+static re_VirtualBuffer __re_str_chars = RE_NULL_HANDLE;
+static __re_StrRecord* __re_str_record_data = RE_NULL_HANDLE;
+
+// ? Records are written before the count that publishes them.
+static atomic_uint __re_str_count = 0u;
+
+static __re_StrSlot* __re_str_slots = RE_NULL_HANDLE;
+static uint32_t __re_str_slot_count = 0u;
+static re_SpinLock __re_str_lock = RE_SPIN_LOCK_INIT;
+
+// *=================================================
+// *
+// * __re_initStrInternTable
+// *
+// *=================================================
+
+static void __re_initStrInternTable() {
+    RE_MEMORY_MODULE_BEGIN(RE_CORE_MODULE);
+
+    __re_str_records = re_createVirtualBuffer(__RE_STR_INTERN_MAX_STRS * sizeof(__re_StrRecord));
+    __re_str_chars = re_createVirtualBuffer(__RE_STR_INTERN_MAX_CHARS);
+    __re_str_record_data = (__re_StrRecord*)re_getVirtualBufferData(__re_str_records);
+
+    __re_str_slots = (__re_StrSlot*)re_calloc(__RE_STR_INTERN_INITIAL_SLOT_COUNT, sizeof(__re_StrSlot));
+    __re_str_slot_count = __RE_STR_INTERN_INITIAL_SLOT_COUNT;
+
+    RE_MEMORY_MODULE_END();
+}
+
+// *=================================================
+// *
+// * __re_findStrSlot
+// *
+// *=================================================
+
+static __re_StrSlot* __re_findStrSlot(const char* str, const size_t length, const uint32_t hash) {
+    const uint32_t slot_mask = __re_str_slot_count - 1u;
+
+    for (uint32_t idx = hash & slot_mask;; idx = (idx + 1u) & slot_mask) {
+        __re_StrSlot* slot = &__re_str_slots[idx];
+
+        if (slot->id == RE_STR_ID_NULL) {
+            return slot;
+        }
+
+        if (slot->hash != hash) {
+            continue;
+        }
+
+        const __re_StrRecord* record = &__re_str_record_data[slot->id - 1u];
+
+        if (record->length == length && memcmp(record->str, str, length) == 0) {
+            return slot;
+        }
+    }
+}
+
+// *=================================================
+// *
+// * __re_growStrInternTable
+// *
+// *=================================================
+
+static void __re_growStrInternTable() {
+    RE_MEMORY_MODULE_BEGIN(RE_CORE_MODULE);
+
+    const uint32_t slot_count = __re_str_slot_count * 2u;
+    const uint32_t slot_mask = slot_count - 1u;
+    __re_StrSlot* slots = (__re_StrSlot*)re_calloc(slot_count, sizeof(__re_StrSlot));
+
+    for (uint32_t idx = 0; idx < __re_str_slot_count; ++idx) {
+        const __re_StrSlot slot = __re_str_slots[idx];
+
+        if (slot.id == RE_STR_ID_NULL) {
+            continue;
+        }
+
+        uint32_t jdx = slot.hash & slot_mask;
+        while (slots[jdx].id != RE_STR_ID_NULL) {
+            jdx = (jdx + 1u) & slot_mask;
+        }
+
+        slots[jdx] = slot;
+    }
+
+    re_free(__re_str_slots);
+    __re_str_slots = slots;
+    __re_str_slot_count = slot_count;
+
+    RE_MEMORY_MODULE_END();
+}
+
+// *=================================================
+// *
+// * re_internSizedStr
+// *
+// *=================================================
+
+re_StrId re_internSizedStr(const char* str, const size_t length) {
+    if (str == RE_NULL_HANDLE) {
+        return RE_STR_ID_NULL;
+    }
+
+    re_assert(length < UINT32_MAX, "Cannot intern a string of %zu characters!", length);
+
+    const uint32_t hash = (uint32_t)re_hashStr(str, length);
+
+    __re_lockSpinLock(&__re_str_lock);
+
+    if (__re_str_slots == RE_NULL_HANDLE) {
+        __re_initStrInternTable();
+    }
+
+    __re_StrSlot* slot = __re_findStrSlot(str, length, hash);
+
+    if (slot->id != RE_STR_ID_NULL) {
+        const re_StrId id = slot->id;
+        __re_unlockSpinLock(&__re_str_lock);
+
+        return id;
+    }
+
+    const uint32_t str_count = atomic_load_explicit(&__re_str_count, memory_order_relaxed);
+    re_assert(str_count < __RE_STR_INTERN_MAX_STRS, "String intern table is full!");
+
+    // ? Kept at most half full so that probe sequences stay short.
+    if ((str_count + 1u) * 2u > __re_str_slot_count) {
+        __re_growStrInternTable();
+        slot = __re_findStrSlot(str, length, hash);
+    }
+
+    char* chars = (char*)re_virtualBufferPush(__re_str_chars, length + 1u);
+    __re_StrRecord* record = (__re_StrRecord*)re_virtualBufferPush(__re_str_records, sizeof(__re_StrRecord));
+    re_assert(chars != RE_NULL_HANDLE && record != RE_NULL_HANDLE, "String intern storage is full!");
+
+    re_memcpy(chars, str, length);
+    chars[length] = '\0';
+
+    record->str = chars;
+    record->length = (uint32_t)length;
+    record->hash = hash;
+
+    const re_StrId id = str_count + 1u;
+    slot->hash = hash;
+    slot->id = id;
+
+    atomic_store_explicit(&__re_str_count, str_count + 1u, memory_order_release);
+    __re_unlockSpinLock(&__re_str_lock);
+
+    return id;
+}
+
+// *=================================================
+// *
+// * re_internStr
+// *
+// *=================================================
+
+re_StrId re_internStr(const char* str) {
+    if (str == RE_NULL_HANDLE) {
+        return RE_STR_ID_NULL;
+    }
+
+    return re_internSizedStr(str, strlen(str));
+}
+
+// *=================================================
+// *
+// * re_findStrId
+// *
+// *=================================================
+
+re_StrId re_findStrId(const char* str) {
+    if (str == RE_NULL_HANDLE) {
+        return RE_STR_ID_NULL;
+    }
+
+    const size_t length = strlen(str);
+    const uint32_t hash = (uint32_t)re_hashStr(str, length);
+
+    __re_lockSpinLock(&__re_str_lock);
+
+    const re_StrId id = __re_str_slots != RE_NULL_HANDLE ?
+        __re_findStrSlot(str, length, hash)->id :
+        RE_STR_ID_NULL;
+
+    __re_unlockSpinLock(&__re_str_lock);
+
+    return id;
+}
+
+// *=================================================
+// *
+// * __re_getStrRecord
+// *
+// *=================================================
+
+static const __re_StrRecord* __re_getStrRecord(const re_StrId id) {
+    re_assert(
+        id <= atomic_load_explicit(&__re_str_count, memory_order_acquire),
+        "Invalid string ID: %u",
+        id
+    );
+
+    return &__re_str_record_data[id - 1u];
+}
+
+// *=================================================
+// *
+// * re_getInternedStr
+// *
+// *=================================================
+
+const char* re_getInternedStr(const re_StrId id) {
+    if (id == RE_STR_ID_NULL) {
+        return RE_NULL_HANDLE;
+    }
+
+    return __re_getStrRecord(id)->str;
+}
+
+// *=================================================
+// *
+// * re_getInternedStrLength
+// *
+// *=================================================
+
+size_t re_getInternedStrLength(const re_StrId id) {
+    if (id == RE_STR_ID_NULL) {
+        return 0;
+    }
+
+    return __re_getStrRecord(id)->length;
+}
\ No newline at end of file
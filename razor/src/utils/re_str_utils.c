@@ -1,5 +1,327 @@
 #include <re_utils.h>
 
+#include "../core/re_memory.h"
+
+#include <string.h>
+
+// ? Every vector path only ever loads whole vectors that cannot cross into
+// ? the next page: scans that start unaligned load from the aligned address
+// ? below and discard the leading bytes, and two-string compares (whose
+// ? pointers are misaligned against each other) step a byte at a time while
+// ? either one is within a vector of a page end. A read past the terminator
+// ? therefore never touches a page the string does not already occupy.
+#define __RE_STR_PAGE_SIZE 4096u
+
+#if defined(__SSE2__) || defined(_M_X64)
+    #include <emmintrin.h>
+    #define __RE_STR_SIMD_SSE2
+#elif defined(__ARM_NEON) || defined(_M_ARM64)
+    #include <arm_neon.h>
+    #define __RE_STR_SIMD_NEON
+#endif
+
+// ? SSE2 is the x86-64 baseline; AVX2 is picked at runtime through the same
+// ? CPU detection re_memcpy uses.
+#if defined(__RE_STR_SIMD_SSE2) && defined(__RE_CPU_X86)
+    #include <immintrin.h>
+    #define __RE_STR_SIMD_AVX2
+#endif
+
+#ifdef _MSC_VER
+    #include <intrin.h>
+#endif
+
+// ? The over-reads are page-safe but still touch bytes past the terminator,
+// ? which AddressSanitizer would otherwise report.
+#if defined(__clang__) || defined(__GNUC__)
+    #define __RE_STR_NO_SANITIZE_ADDRESS __attribute__((no_sanitize_address))
+#elif defined(_MSC_VER)
+    #define __RE_STR_NO_SANITIZE_ADDRESS __declspec(no_sanitize_address)
+#else
+    #define __RE_STR_NO_SANITIZE_ADDRESS
+#endif
+
+// *=================================================
+// *
+// * Vector Primitives
+// *
+// *=================================================
+
+// ? Masks hold __RE_STR_MASK_BITS bits per byte (NEON has no movemask, so its
+// ? narrowing trick yields a nibble per byte), byte 0 in the lowest bits.
+
+#if defined(__RE_STR_SIMD_SSE2)
+
+#define __RE_STR_VECTOR_SIZE 16u
+#define __RE_STR_MASK_BITS 1u
+
+typedef __m128i __re_StrVector;
+
+__RE_STR_NO_SANITIZE_ADDRESS static inline __re_StrVector __re_loadStrVector(const char* src) {
+    return _mm_loadu_si128((const __m128i*)src);
+}
+
+static inline uint64_t __re_getStrZeroMask(const __re_StrVector vec) {
+    return (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(vec, _mm_setzero_si128()));
+}
+
+static inline uint64_t __re_getStrNotEqualMask(const __re_StrVector vec_a, const __re_StrVector vec_b) {
+    return (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(vec_a, vec_b)) ^ 0xffffu;
+}
+
+static inline __re_StrVector __re_foldStrVector(const __re_StrVector vec) {
+    // ? Signed compares leave bytes >= 0x80 (negative) out of the A-Z range.
+    const __m128i is_upper = _mm_and_si128(
+        _mm_cmpgt_epi8(vec, _mm_set1_epi8('A' - 1)),
+        _mm_cmplt_epi8(vec, _mm_set1_epi8('Z' + 1))
+    );
+
+    return _mm_add_epi8(vec, _mm_and_si128(is_upper, _mm_set1_epi8(0x20)));
+}
+
+#elif defined(__RE_STR_SIMD_NEON)
+
+#define __RE_STR_VECTOR_SIZE 16u
+#define __RE_STR_MASK_BITS 4u
+
+typedef uint8x16_t __re_StrVector;
+
+__RE_STR_NO_SANITIZE_ADDRESS static inline __re_StrVector __re_loadStrVector(const char* src) {
+    return vld1q_u8((const uint8_t*)src);
+}
+
+static inline uint64_t __re_getStrByteMask(const uint8x16_t cmp) {
+    const uint8x8_t narrowed = vshrn_n_u16(vreinterpretq_u16_u8(cmp), 4);
+    return vget_lane_u64(vreinterpret_u64_u8(narrowed), 0);
+}
+
+static inline uint64_t __re_getStrZeroMask(const __re_StrVector vec) {
+    return __re_getStrByteMask(vceqq_u8(vec, vdupq_n_u8(0)));
+}
+
+static inline uint64_t __re_getStrNotEqualMask(const __re_StrVector vec_a, const __re_StrVector vec_b) {
+    return __re_getStrByteMask(vmvnq_u8(vceqq_u8(vec_a, vec_b)));
+}
+
+static inline __re_StrVector __re_foldStrVector(const __re_StrVector vec) {
+    const uint8x16_t is_upper = vandq_u8(vcgeq_u8(vec, vdupq_n_u8('A')), vcleq_u8(vec, vdupq_n_u8('Z')));
+    return vaddq_u8(vec, vandq_u8(is_upper, vdupq_n_u8(0x20)));
+}
+
+#endif
+
+#ifdef __RE_STR_SIMD_AVX2
+
+#define __RE_STR_AVX2_VECTOR_SIZE 32u
+
+__RE_STR_NO_SANITIZE_ADDRESS __RE_TARGET_AVX2 static inline __m256i __re_loadStrVectorAVX2(const char* src) {
+    return _mm256_loadu_si256((const __m256i*)src);
+}
+
+__RE_TARGET_AVX2 static inline uint64_t __re_getStrZeroMaskAVX2(const __m256i vec) {
+    return (uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(vec, _mm256_setzero_si256()));
+}
+
+__RE_TARGET_AVX2 static inline uint64_t __re_getStrNotEqualMaskAVX2(const __m256i vec_a, const __m256i vec_b) {
+    return (uint32_t)~_mm256_movemask_epi8(_mm256_cmpeq_epi8(vec_a, vec_b));
+}
+
+__RE_TARGET_AVX2 static inline __m256i __re_foldStrVectorAVX2(const __m256i vec) {
+    const __m256i is_upper = _mm256_and_si256(
+        _mm256_cmpgt_epi8(vec, _mm256_set1_epi8('A' - 1)),
+        _mm256_cmpgt_epi8(_mm256_set1_epi8('Z' + 1), vec)
+    );
+
+    return _mm256_add_epi8(vec, _mm256_and_si256(is_upper, _mm256_set1_epi8(0x20)));
+}
+
+#endif
+
+#ifdef __RE_STR_VECTOR_SIZE
+
+static inline uint32_t __re_countTrailingZeros(const uint64_t mask) {
+    #ifdef _MSC_VER
+    unsigned long idx = 0;
+    _BitScanForward64(&idx, mask);
+
+    return (uint32_t)idx;
+    #else
+    return (uint32_t)__builtin_ctzll(mask);
+    #endif
+}
+
+static inline size_t __re_getFirstMaskByte(const uint64_t mask) {
+    return __re_countTrailingZeros(mask) / __RE_STR_MASK_BITS;
+}
+
+// ? The number of whole vectors both strings can load before either one
+// ? reaches the end of its page.
+static inline size_t __re_getSafeStrVectorCount(const char* str_a, const char* str_b, const size_t vector_size) {
+    const size_t offset_a = (uintptr_t)str_a & (__RE_STR_PAGE_SIZE - 1u);
+    const size_t offset_b = (uintptr_t)str_b & (__RE_STR_PAGE_SIZE - 1u);
+    const size_t max_offset = offset_a > offset_b ? offset_a : offset_b;
+
+    return (__RE_STR_PAGE_SIZE - max_offset) / vector_size;
+}
+
+#endif
+
+static inline char __re_foldStrChar(const char value) {
+    return value >= 'A' && value <= 'Z' ? (char)(value + 0x20) : value;
+}
+
+// *=================================================
+// *
+// * __re_scanStrVectors
+// *
+// *=================================================
+
+typedef enum __re_StrCompareMode {
+    __RE_STR_COMPARE_EQUAL,
+    __RE_STR_COMPARE_EQUAL_NO_CASE,
+    __RE_STR_COMPARE_PREFIX
+} __re_StrCompareMode;
+
+typedef enum __re_StrScanResult {
+    __RE_STR_SCAN_MATCH,
+    __RE_STR_SCAN_MISMATCH,
+    __RE_STR_SCAN_CONTINUE
+} __re_StrScanResult;
+
+// ? Each vector finds the first byte that either differs or terminates str_b;
+// ? the compare succeeds if that byte is a terminator both strings share (or,
+// ? for prefixes, any terminator of str_b). Without a stop the pointers are
+// ? left at the first byte the caller has to step over by hand.
+
+#ifdef __RE_STR_VECTOR_SIZE
+
+__RE_STR_NO_SANITIZE_ADDRESS static inline __re_StrScanResult __re_scanStrVectors(const char** str_a, const char** str_b, const __re_StrCompareMode mode) {
+    size_t vector_count = __re_getSafeStrVectorCount(*str_a, *str_b, __RE_STR_VECTOR_SIZE);
+
+    for (; vector_count > 0; --vector_count) {
+        __re_StrVector vec_a = __re_loadStrVector(*str_a);
+        __re_StrVector vec_b = __re_loadStrVector(*str_b);
+
+        const uint64_t zero_mask = __re_getStrZeroMask(vec_b);
+
+        if (mode == __RE_STR_COMPARE_EQUAL_NO_CASE) {
+            vec_a = __re_foldStrVector(vec_a);
+            vec_b = __re_foldStrVector(vec_b);
+        }
+
+        const uint64_t not_equal_mask = __re_getStrNotEqualMask(vec_a, vec_b);
+        const uint64_t stop_mask = zero_mask | not_equal_mask;
+
+        if (stop_mask != 0) {
+            const uint64_t first_bit = stop_mask & (~stop_mask + 1u);
+            const bool is_match = mode == __RE_STR_COMPARE_PREFIX ?
+                (zero_mask & first_bit) != 0 :
+                (not_equal_mask & first_bit) == 0;
+
+            return is_match ? __RE_STR_SCAN_MATCH : __RE_STR_SCAN_MISMATCH;
+        }
+
+        *str_a += __RE_STR_VECTOR_SIZE;
+        *str_b += __RE_STR_VECTOR_SIZE;
+    }
+
+    return __RE_STR_SCAN_CONTINUE;
+}
+
+#endif
+
+#ifdef __RE_STR_SIMD_AVX2
+
+__RE_STR_NO_SANITIZE_ADDRESS __RE_TARGET_AVX2 static __re_StrScanResult __re_scanStrVectorsAVX2(const char** str_a, const char** str_b, const __re_StrCompareMode mode) {
+    size_t vector_count = __re_getSafeStrVectorCount(*str_a, *str_b, __RE_STR_AVX2_VECTOR_SIZE);
+
+    for (; vector_count > 0; --vector_count) {
+        __m256i vec_a = __re_loadStrVectorAVX2(*str_a);
+        __m256i vec_b = __re_loadStrVectorAVX2(*str_b);
+
+        const uint64_t zero_mask = __re_getStrZeroMaskAVX2(vec_b);
+
+        if (mode == __RE_STR_COMPARE_EQUAL_NO_CASE) {
+            vec_a = __re_foldStrVectorAVX2(vec_a);
+            vec_b = __re_foldStrVectorAVX2(vec_b);
+        }
+
+        const uint64_t not_equal_mask = __re_getStrNotEqualMaskAVX2(vec_a, vec_b);
+        const uint64_t stop_mask = zero_mask | not_equal_mask;
+
+        if (stop_mask != 0) {
+            const uint64_t first_bit = stop_mask & (~stop_mask + 1u);
+            const bool is_match = mode == __RE_STR_COMPARE_PREFIX ?
+                (zero_mask & first_bit) != 0 :
+                (not_equal_mask & first_bit) == 0;
+
+            return is_match ? __RE_STR_SCAN_MATCH : __RE_STR_SCAN_MISMATCH;
+        }
+
+        *str_a += __RE_STR_AVX2_VECTOR_SIZE;
+        *str_b += __RE_STR_AVX2_VECTOR_SIZE;
+    }
+
+    return __RE_STR_SCAN_CONTINUE;
+}
+
+#endif
+
+// *=================================================
+// *
+// * __re_compareStrs
+// *
+// *=================================================
+
+// ? One walk serves all three compares: whole vectors while both strings are
+// ? clear of a page end, then a single byte to step across it.
+static inline bool __re_compareStrs(const char* str_a, const char* str_b, const __re_StrCompareMode mode) {
+    #ifdef __RE_STR_SIMD_AVX2
+    const bool has_avx2 = __re_hasAVX2();
+    #endif
+
+    for (;;) {
+        #ifdef __RE_STR_VECTOR_SIZE
+        __re_StrScanResult scan_result = __RE_STR_SCAN_CONTINUE;
+
+        #ifdef __RE_STR_SIMD_AVX2
+        if (has_avx2) {
+            scan_result = __re_scanStrVectorsAVX2(&str_a, &str_b, mode);
+        }
+        else {
+            scan_result = __re_scanStrVectors(&str_a, &str_b, mode);
+        }
+        #else
+        scan_result = __re_scanStrVectors(&str_a, &str_b, mode);
+        #endif
+
+        if (scan_result != __RE_STR_SCAN_CONTINUE) {
+            return scan_result == __RE_STR_SCAN_MATCH;
+        }
+        #endif
+
+        const char char_a = mode == __RE_STR_COMPARE_EQUAL_NO_CASE ? __re_foldStrChar(*str_a) : *str_a;
+        const char char_b = mode == __RE_STR_COMPARE_EQUAL_NO_CASE ? __re_foldStrChar(*str_b) : *str_b;
+
+        if (char_b == '\0') {
+            return mode == __RE_STR_COMPARE_PREFIX || char_a == '\0';
+        }
+
+        if (char_a != char_b) {
+            return false;
+        }
+
+        ++str_a;
+        ++str_b;
+    }
+}
+
+// *=================================================
+// *
+// * re_isStrEqual
+// *
+// *=================================================
+
 bool re_isStrEqual(const char* str_a, const char* str_b) {
     if (str_a == str_b) {
         return true;
@@ -9,14 +331,201 @@ bool re_isStrEqual(const char* str_a, const char* str_b) {
         return false;
     }
 
-    while (*str_a != '\0' && *str_b != '\0') {
-        if (*str_a != *str_b) {
-            return false;
+    return __re_compareStrs(str_a, str_b, __RE_STR_COMPARE_EQUAL);
+}
+
+// *=================================================
+// *
+// * re_isStrEqualNoCase
+// *
+// *=================================================
+
+bool re_isStrEqualNoCase(const char* str_a, const char* str_b) {
+    if (str_a == str_b) {
+        return true;
+    }
+
+    if (str_a == RE_NULL_HANDLE || str_b == RE_NULL_HANDLE) {
+        return false;
+    }
+
+    return __re_compareStrs(str_a, str_b, __RE_STR_COMPARE_EQUAL_NO_CASE);
+}
+
+// *=================================================
+// *
+// * re_hasStrPrefix
+// *
+// *=================================================
+
+bool re_hasStrPrefix(const char* str, const char* prefix) {
+    if (str == RE_NULL_HANDLE || prefix == RE_NULL_HANDLE) {
+        return false;
+    }
+
+    return __re_compareStrs(str, prefix, __RE_STR_COMPARE_PREFIX);
+}
+
+// *=================================================
+// *
+// * __re_getStrLengthAVX2
+// *
+// *=================================================
+
+#ifdef __RE_STR_SIMD_AVX2
+
+__RE_STR_NO_SANITIZE_ADDRESS __RE_TARGET_AVX2 static size_t __re_getStrLengthAVX2(const char* str) {
+    const char* block = (const char*)((uintptr_t)str & ~(uintptr_t)(__RE_STR_AVX2_VECTOR_SIZE - 1u));
+    uint64_t zero_mask = __re_getStrZeroMaskAVX2(__re_loadStrVectorAVX2(block)) >> (size_t)(str - block);
+
+    if (zero_mask != 0) {
+        return __re_countTrailingZeros(zero_mask);
+    }
+
+    for (;;) {
+        block += __RE_STR_AVX2_VECTOR_SIZE;
+        zero_mask = __re_getStrZeroMaskAVX2(__re_loadStrVectorAVX2(block));
+
+        if (zero_mask != 0) {
+            return (size_t)(block - str) + __re_countTrailingZeros(zero_mask);
         }
+    }
+}
 
-        ++str_a;
-        ++str_b;
+#endif
+
+// *=================================================
+// *
+// * re_getStrLength
+// *
+// *=================================================
+
+__RE_STR_NO_SANITIZE_ADDRESS size_t re_getStrLength(const char* str) {
+    if (str == RE_NULL_HANDLE) {
+        return 0;
+    }
+
+    #ifdef __RE_STR_SIMD_AVX2
+    if (__re_hasAVX2()) {
+        return __re_getStrLengthAVX2(str);
+    }
+    #endif
+
+    #ifdef __RE_STR_VECTOR_SIZE
+    // ? Aligned loads never cross a page, so the first one starts below str
+    // ? and its leading bytes are shifted out of the mask.
+    const char* block = (const char*)((uintptr_t)str & ~(uintptr_t)(__RE_STR_VECTOR_SIZE - 1u));
+    uint64_t zero_mask = __re_getStrZeroMask(__re_loadStrVector(block)) >> ((size_t)(str - block) * __RE_STR_MASK_BITS);
+
+    if (zero_mask != 0) {
+        return __re_getFirstMaskByte(zero_mask);
+    }
+
+    for (;;) {
+        block += __RE_STR_VECTOR_SIZE;
+        zero_mask = __re_getStrZeroMask(__re_loadStrVector(block));
+
+        if (zero_mask != 0) {
+            return (size_t)(block - str) + __re_getFirstMaskByte(zero_mask);
+        }
+    }
+    #else
+    const char* end = str;
+    while (*end != '\0') {
+        ++end;
+    }
+
+    return (size_t)(end - str);
+    #endif
+}
+
+// *=================================================
+// *
+// * re_copyStr
+// *
+// *=================================================
+
+size_t re_copyStr(char* dst, const char* src, const size_t dst_size) {
+    const size_t src_length = re_getStrLength(src);
+
+    if (dst == RE_NULL_HANDLE || dst_size == 0) {
+        return src_length;
     }
 
-    return *str_a == *str_b;
+    // ? A NULL src copies as an empty string (re_memcpy rejects NULL even
+    // ? for zero bytes).
+    const size_t copy_length = src_length < dst_size ? src_length : dst_size - 1u;
+
+    if (copy_length > 0) {
+        re_memcpy(dst, src, copy_length);
+    }
+    dst[copy_length] = '\0';
+
+    return src_length;
+}
+
+// *=================================================
+// *
+// * re_hashStr
+// *
+// *=================================================
+
+#define __RE_STR_HASH_K0 0x87c37b91114253d5ull
+#define __RE_STR_HASH_K1 0x4cf5ad432745937full
+#define __RE_STR_HASH_SEED 0x9e3779b97f4a7c15ull
+
+static inline uint64_t __re_rotateLeft64(const uint64_t value, const uint32_t shift) {
+    return (value << shift) | (value >> (64u - shift));
+}
+
+static inline uint64_t __re_readStrWord(const char* src) {
+    uint64_t word = 0;
+    memcpy(&word, src, sizeof(word));
+
+    return word;
+}
+
+static inline uint64_t __re_mixStrWord(uint64_t word) {
+    word *= __RE_STR_HASH_K0;
+    word = __re_rotateLeft64(word, 31u);
+
+    return word * __RE_STR_HASH_K1;
+}
+
+// ? Two independent MurmurHash3-style lanes over 16-byte blocks (so the
+// ? multiplies pipeline), the tail read as one zero-padded word pair, and the
+// ? MurmurHash3 finalizer on the merged state. Not stable across builds with
+// ? different endianness, so never persist these.
+uint64_t re_hashStr(const char* data, const size_t length) {
+    uint64_t hash_a = __RE_STR_HASH_SEED ^ length;
+    uint64_t hash_b = __RE_STR_HASH_SEED + length * __RE_STR_HASH_K1;
+
+    const char* src = data;
+    size_t remaining = length;
+
+    for (; remaining >= 16u; src += 16u, remaining -= 16u) {
+        hash_a ^= __re_mixStrWord(__re_readStrWord(src));
+        hash_a = __re_rotateLeft64(hash_a, 27u) * 5u + 0x52dce729u;
+
+        hash_b ^= __re_mixStrWord(__re_readStrWord(src + 8u));
+        hash_b = __re_rotateLeft64(hash_b, 33u) * 5u + 0x38495ab5u;
+    }
+
+    if (remaining > 0) {
+        char tail[16] = {0};
+        memcpy(tail, src, remaining);
+
+        hash_a ^= __re_mixStrWord(__re_readStrWord(tail));
+        hash_b ^= __re_mixStrWord(__re_readStrWord(tail + 8u));
+    }
+
+    uint64_t hash = hash_a + __re_rotateLeft64(hash_b, 17u);
+
+    hash ^= hash >> 33u;
+    hash *= 0xff51afd7ed558ccdull;
+    hash ^= hash >> 33u;
+    hash *= 0xc4ceb9fe1a85ec53ull;
+    hash ^= hash >> 33u;
+
+    return hash;
 }
\ No newline at end of file
@@ -0,0 +1,100 @@
+// ? Binary call sites record their raw argument bytes in the flight
+// ? recorder, which is the path that cuts payloads mid-argument.
+#ifndef RE_LOG_BINARY_ENABLED
+    #define RE_LOG_BINARY_ENABLED
+#endif
+
+#include "./rt_test.h"
+
+#include <string.h>
+
+#if RE_PLATFORM == RE_PLATFORM_LINUX
+    #include <signal.h>
+    #include <sys/wait.h>
+    #include <unistd.h>
+#endif
+
+#define RT_DUMP_PATH "rt_flight_recorder.log"
+#define RT_CRASH_DUMP_PATH "rt_flight_recorder_crash.log"
+#define RT_LONG_STRING_LENGTH 300u
+#define RT_CHAINED_EXIT_CODE 42
+
+// *=================================================
+// *
+// * Tests
+// *
+// *=================================================
+
+static void rt_testDumpLongStringArg() {
+    // ? Far longer than a flight event's data, so the encoded string crosses
+    // ? the cut and must render as cut off rather than be read past it.
+    char long_string[RT_LONG_STRING_LENGTH + 1u];
+    memset(long_string, 'a', RT_LONG_STRING_LENGTH);
+    long_string[RT_LONG_STRING_LENGTH] = '\0';
+
+    re_logInfo("Short string: %s", "razor");
+    re_logInfo("Long string: %s", long_string);
+    re_recordFlightEvent(RE_FLIGHT_EVENT_USER, "After the long string");
+
+    rt_check(re_dumpFlightRecorder(RT_DUMP_PATH));
+
+    // ? The header and line prefixes are formatted by hand on the crash path.
+    char* text = rt_readFile(RT_DUMP_PATH);
+    rt_check(text != NULL && strncmp(text, "Razor flight recorder (1 threads)\n[+0.000000s] [thread 0] [LOG] ", 64u) == 0);
+    rt_check(text != NULL && strstr(text, "[INFO]: Short string: razor\n") != NULL);
+    rt_check(text != NULL && strstr(text, "[INFO]: Long string: ...\n") != NULL);
+    rt_check(text != NULL && strstr(text, "[USER] After the long string\n") != NULL);
+    free(text);
+}
+
+#if RE_PLATFORM == RE_PLATFORM_LINUX
+
+static void rt_handleChainedAbort(int signal_number) {
+    (void)signal_number;
+    _exit(RT_CHAINED_EXIT_CODE);
+}
+
+static void rt_testCrashChainsPreviousHandler() {
+    const pid_t child = fork();
+
+    if (child == 0) {
+        // ? Installed before the engine's handler, which has to dump first and
+        // ? then hand the signal on to this one.
+        struct sigaction action = {0};
+        action.sa_handler = rt_handleChainedAbort;
+        sigemptyset(&action.sa_mask);
+        sigaction(SIGABRT, &action, NULL);
+
+        re_debugInit();
+        re_setFlightRecorderPath(RT_CRASH_DUMP_PATH);
+        re_recordFlightEvent(RE_FLIGHT_EVENT_USER, "Before the crash");
+
+        abort();
+    }
+
+    int status = 0;
+    waitpid(child, &status, 0);
+    rt_check(WIFEXITED(status) && WEXITSTATUS(status) == RT_CHAINED_EXIT_CODE);
+
+    char* text = rt_readFile(RT_CRASH_DUMP_PATH);
+    rt_check(text != NULL && strstr(text, "[USER] Before the crash\n") != NULL);
+    free(text);
+
+    remove(RT_CRASH_DUMP_PATH);
+}
+
+#endif
+
+int main(void) {
+    // ? Runs first, while this process has no crash handler to pass on to
+    // ? the forked child.
+    #if RE_PLATFORM == RE_PLATFORM_LINUX
+    rt_testCrashChainsPreviousHandler();
+    #endif
+
+    rt_testDumpLongStringArg();
+
+    remove(RT_DUMP_PATH);
+
+    return rt_finish();
+}
\ No newline at end of file
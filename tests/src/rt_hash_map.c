@@ -0,0 +1,199 @@
+#include "./rt_test.h"
+
+// ? Far past the default capacity, so filling the map resizes it several times.
+#define RT_KEY_COUNT 5000u
+#define RT_COLLIDING_KEY_COUNT 100u
+
+static re_HashMap rt_createMap(const re_HashMapHashFn hash_fn) {
+    re_HashMapCreateInfo create_info = {0};
+    create_info.key_size = sizeof(uint64_t);
+    create_info.value_size = sizeof(uint64_t);
+    create_info.hash_fn = hash_fn;
+
+    return re_createHashMap(&create_info);
+}
+
+static bool rt_hasValue(const re_HashMap map, const uint64_t key, const uint64_t value) {
+    const uint64_t* found = (const uint64_t*)re_hashMapFind(map, &key);
+    return found != NULL && *found == value;
+}
+
+// ? Every key lands in the same group, so probes run across many groups and
+// ? over tombstones left by removals.
+static uint64_t rt_hashColliding(const void* key, const size_t key_size) {
+    (void)key;
+    (void)key_size;
+
+    return 0x1234u;
+}
+
+// *=================================================
+// *
+// * Tests
+// *
+// *=================================================
+
+static void rt_testInsertEraseReinsert() {
+    re_HashMap map = rt_createMap(NULL);
+
+    for (uint64_t key = 0; key < RT_KEY_COUNT; ++key) {
+        const uint64_t value = key * 3u;
+        rt_check(re_hashMapInsert(map, &key, &value) != NULL);
+    }
+
+    rt_check(re_getHashMapCount(map) == RT_KEY_COUNT);
+
+    bool all_found = true;
+    for (uint64_t key = 0; key < RT_KEY_COUNT; ++key) {
+        all_found = all_found && rt_hasValue(map, key, key * 3u);
+    }
+    rt_check(all_found);
+
+    for (uint64_t key = 0; key < RT_KEY_COUNT; key += 2u) {
+        rt_check(re_hashMapRemove(map, &key));
+    }
+
+    const uint64_t removed_key = 2u;
+    rt_check(!re_hashMapRemove(map, &removed_key));
+    rt_check(re_getHashMapCount(map) == RT_KEY_COUNT / 2u);
+
+    bool removed_absent = true;
+    bool kept_found = true;
+    for (uint64_t key = 0; key < RT_KEY_COUNT; ++key) {
+        if (key % 2u == 0) {
+            removed_absent = removed_absent && re_hashMapFind(map, &key) == NULL;
+        }
+        else {
+            kept_found = kept_found && rt_hasValue(map, key, key * 3u);
+        }
+    }
+    rt_check(removed_absent);
+    rt_check(kept_found);
+
+    // ? Reinserting past the original count forces another resize while the
+    // ? removed keys' tombstones are still in the table.
+    for (uint64_t key = 0; key < RT_KEY_COUNT * 2u; key += 2u) {
+        const uint64_t value = key * 5u;
+        bool is_new = false;
+
+        uint64_t* slot = (uint64_t*)re_hashMapFindOrInsert(map, &key, &is_new);
+        rt_check(slot != NULL && is_new);
+
+        if (slot != NULL) {
+            *slot = value;
+        }
+    }
+
+    rt_check(re_getHashMapCount(map) == RT_KEY_COUNT / 2u + RT_KEY_COUNT);
+
+    all_found = true;
+    for (uint64_t key = 0; key < RT_KEY_COUNT * 2u; ++key) {
+        if (key % 2u == 0) {
+            all_found = all_found && rt_hasValue(map, key, key * 5u);
+        }
+        else if (key < RT_KEY_COUNT) {
+            all_found = all_found && rt_hasValue(map, key, key * 3u);
+        }
+        else {
+            all_found = all_found && re_hashMapFind(map, &key) == NULL;
+        }
+    }
+    rt_check(all_found);
+
+    uint32_t iterator = 0;
+    uint32_t visited_count = 0;
+    const void* key = NULL;
+    void* value = NULL;
+
+    while (re_hashMapNext(map, &iterator, &key, &value)) {
+        ++visited_count;
+    }
+    rt_check(visited_count == re_getHashMapCount(map));
+
+    re_destroyHashMap(&map);
+    rt_check(map == NULL);
+}
+
+static void rt_testTombstoneChurn() {
+    re_HashMap map = rt_createMap(NULL);
+
+    // ? A steady-size map that keeps removing and adding keys fills up with
+    // ? tombstones, which have to be cleared without losing live keys.
+    const uint64_t anchor_key = UINT64_MAX;
+    const uint64_t anchor_value = 42u;
+    re_hashMapInsert(map, &anchor_key, &anchor_value);
+
+    bool churn_ok = true;
+    for (uint64_t key = 0; key < RT_KEY_COUNT * 4u; ++key) {
+        churn_ok = churn_ok && re_hashMapInsert(map, &key, &key) != NULL;
+
+        if (key >= 8u) {
+            const uint64_t old_key = key - 8u;
+            churn_ok = churn_ok && re_hashMapRemove(map, &old_key);
+        }
+    }
+
+    rt_check(churn_ok);
+    rt_check(re_getHashMapCount(map) == 9u);
+    rt_check(rt_hasValue(map, anchor_key, anchor_value));
+
+    bool window_found = true;
+    for (uint64_t key = RT_KEY_COUNT * 4u - 8u; key < RT_KEY_COUNT * 4u; ++key) {
+        window_found = window_found && rt_hasValue(map, key, key);
+    }
+    rt_check(window_found);
+
+    re_destroyHashMap(&map);
+}
+
+static void rt_testCollidingKeys() {
+    re_HashMap map = rt_createMap(rt_hashColliding);
+
+    for (uint64_t key = 0; key < RT_COLLIDING_KEY_COUNT; ++key) {
+        re_hashMapInsert(map, &key, &key);
+    }
+
+    // ? Removing from the middle of the probe chain must not cut off the keys
+    // ? placed after it.
+    for (uint64_t key = 0; key < RT_COLLIDING_KEY_COUNT; key += 3u) {
+        rt_check(re_hashMapRemove(map, &key));
+    }
+
+    bool chain_ok = true;
+    for (uint64_t key = 0; key < RT_COLLIDING_KEY_COUNT; ++key) {
+        if (key % 3u == 0) {
+            chain_ok = chain_ok && re_hashMapFind(map, &key) == NULL;
+        }
+        else {
+            chain_ok = chain_ok && rt_hasValue(map, key, key);
+        }
+    }
+    rt_check(chain_ok);
+
+    for (uint64_t key = 0; key < RT_COLLIDING_KEY_COUNT; key += 3u) {
+        const uint64_t value = key + 1000u;
+        re_hashMapInsert(map, &key, &value);
+    }
+
+    chain_ok = true;
+    for (uint64_t key = 0; key < RT_COLLIDING_KEY_COUNT; ++key) {
+        chain_ok = chain_ok && rt_hasValue(map, key, key % 3u == 0 ? key + 1000u : key);
+    }
+    rt_check(chain_ok);
+    rt_check(re_getHashMapCount(map) == RT_COLLIDING_KEY_COUNT);
+
+    re_clearHashMap(map);
+    const uint64_t cleared_key = 1u;
+    rt_check(re_getHashMapCount(map) == 0u);
+    rt_check(re_hashMapFind(map, &cleared_key) == NULL);
+
+    re_destroyHashMap(&map);
+}
+
+int main(void) {
+    rt_testInsertEraseReinsert();
+    rt_testTombstoneChurn();
+    rt_testCollidingKeys();
+
+    return rt_finish();
+}
\ No newline at end of file
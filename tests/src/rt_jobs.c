@@ -0,0 +1,191 @@
+#include "./rt_test.h"
+
+#include <stdatomic.h>
+
+#define RT_JOB_COUNT 4096u
+#define RT_NESTED_JOB_COUNT 64u
+
+// ? Long enough for a loaded CI machine, short enough that a starved job
+// ? fails the test instead of hanging it.
+#define RT_DETACHED_TIMEOUT_MS 5000u
+
+static atomic_uint rt_run_counts[RT_JOB_COUNT];
+static atomic_uint rt_total_run_count = 0u;
+static atomic_bool rt_dependency_seen_early = false;
+
+static re_JobCounter rt_nested_counter = NULL;
+
+static void rt_runCountedJob(void* user_data) {
+    atomic_fetch_add_explicit(&rt_run_counts[(uintptr_t)user_data], 1u, memory_order_relaxed);
+    atomic_fetch_add_explicit(&rt_total_run_count, 1u, memory_order_release);
+}
+
+static void rt_runDependentJob(void* user_data) {
+    // ? Runs after the first half of the jobs, which must all be done by now.
+    const uint32_t first_half_idx = (uint32_t)(uintptr_t)user_data - RT_JOB_COUNT / 2u;
+
+    if (atomic_load_explicit(&rt_run_counts[first_half_idx], memory_order_acquire) != 1u) {
+        atomic_store_explicit(&rt_dependency_seen_early, true, memory_order_relaxed);
+    }
+
+    rt_runCountedJob(user_data);
+}
+
+static void rt_runSpawningJob(void* user_data) {
+    const uint32_t base_idx = (uint32_t)(uintptr_t)user_data * RT_NESTED_JOB_COUNT;
+    re_JobDecl jobs[RT_NESTED_JOB_COUNT];
+
+    for (uint32_t idx = 0; idx < RT_NESTED_JOB_COUNT; ++idx) {
+        jobs[idx].job_fn = rt_runCountedJob;
+        jobs[idx].user_data = (void*)(uintptr_t)(base_idx + idx);
+    }
+
+    // ? Added to the counter before this job releases it, so a waiter can't
+    // ? see it done in between.
+    re_runJobs(jobs, RT_NESTED_JOB_COUNT, rt_nested_counter);
+}
+
+static void rt_resetRunCounts() {
+    for (uint32_t idx = 0; idx < RT_JOB_COUNT; ++idx) {
+        atomic_store_explicit(&rt_run_counts[idx], 0u, memory_order_relaxed);
+    }
+
+    atomic_store_explicit(&rt_total_run_count, 0u, memory_order_relaxed);
+}
+
+static bool rt_ranOnce(const uint32_t first_idx, const uint32_t count) {
+    for (uint32_t idx = first_idx; idx < first_idx + count; ++idx) {
+        if (atomic_load_explicit(&rt_run_counts[idx], memory_order_acquire) != 1u) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+// *=================================================
+// *
+// * Tests
+// *
+// *=================================================
+
+static void rt_testRunOnce() {
+    rt_resetRunCounts();
+
+    static re_JobDecl jobs[RT_JOB_COUNT];
+    for (uint32_t idx = 0; idx < RT_JOB_COUNT; ++idx) {
+        jobs[idx].job_fn = rt_runCountedJob;
+        jobs[idx].user_data = (void*)(uintptr_t)idx;
+    }
+
+    re_JobCounter counter = re_createJobCounter();
+    rt_check(re_isJobCounterDone(counter));
+
+    re_runJobs(jobs, RT_JOB_COUNT, counter);
+    re_waitForJobCounter(counter);
+
+    rt_check(re_isJobCounterDone(counter));
+    rt_check(rt_ranOnce(0u, RT_JOB_COUNT));
+    rt_check(atomic_load(&rt_total_run_count) == RT_JOB_COUNT);
+
+    re_destroyJobCounter(&counter);
+    rt_check(counter == NULL);
+}
+
+static void rt_testDependency() {
+    rt_resetRunCounts();
+    atomic_store(&rt_dependency_seen_early, false);
+
+    static re_JobDecl first_jobs[RT_JOB_COUNT / 2u];
+    static re_JobDecl second_jobs[RT_JOB_COUNT / 2u];
+
+    for (uint32_t idx = 0; idx < RT_JOB_COUNT / 2u; ++idx) {
+        first_jobs[idx].job_fn = rt_runCountedJob;
+        first_jobs[idx].user_data = (void*)(uintptr_t)idx;
+
+        second_jobs[idx].job_fn = rt_runDependentJob;
+        second_jobs[idx].user_data = (void*)(uintptr_t)(RT_JOB_COUNT / 2u + idx);
+    }
+
+    re_JobCounter first_counter = re_createJobCounter();
+    re_JobCounter second_counter = re_createJobCounter();
+
+    re_runJobs(first_jobs, RT_JOB_COUNT / 2u, first_counter);
+    re_runJobsAfter(second_jobs, RT_JOB_COUNT / 2u, first_counter, second_counter);
+    re_waitForJobCounter(second_counter);
+
+    rt_check(re_isJobCounterDone(first_counter));
+    rt_check(!atomic_load(&rt_dependency_seen_early));
+    rt_check(rt_ranOnce(0u, RT_JOB_COUNT));
+
+    // ? A finished dependency runs the jobs right away.
+    re_runJobsAfter(first_jobs, 1u, first_counter, second_counter);
+    re_waitForJobCounter(second_counter);
+    rt_check(atomic_load(&rt_run_counts[0]) == 2u);
+
+    re_destroyJobCounter(&first_counter);
+    re_destroyJobCounter(&second_counter);
+}
+
+static void rt_testNestedJobs() {
+    rt_resetRunCounts();
+
+    const uint32_t spawner_count = RT_JOB_COUNT / RT_NESTED_JOB_COUNT;
+    re_JobDecl spawners[RT_JOB_COUNT / RT_NESTED_JOB_COUNT];
+
+    for (uint32_t idx = 0; idx < spawner_count; ++idx) {
+        spawners[idx].job_fn = rt_runSpawningJob;
+        spawners[idx].user_data = (void*)(uintptr_t)idx;
+    }
+
+    rt_nested_counter = re_createJobCounter();
+
+    re_runJobs(spawners, spawner_count, rt_nested_counter);
+    re_waitForJobCounter(rt_nested_counter);
+
+    rt_check(rt_ranOnce(0u, RT_JOB_COUNT));
+
+    re_destroyJobCounter(&rt_nested_counter);
+}
+
+static void rt_testDetachedJobs() {
+    rt_resetRunCounts();
+
+    // ? Queued by worker 0 with no counter, and never waited on; another
+    // ? worker has to pick them up.
+    static re_JobDecl jobs[RT_JOB_COUNT];
+    for (uint32_t idx = 0; idx < RT_JOB_COUNT; ++idx) {
+        jobs[idx].job_fn = rt_runCountedJob;
+        jobs[idx].user_data = (void*)(uintptr_t)idx;
+    }
+
+    re_runJobs(jobs, RT_JOB_COUNT, NULL);
+
+    const uint64_t start_ns = re_getProfileTime();
+    while (
+        atomic_load_explicit(&rt_total_run_count, memory_order_acquire) < RT_JOB_COUNT &&
+        re_getProfileTime() - start_ns < RT_DETACHED_TIMEOUT_MS * 1000000ull
+    ) {
+        // ? Polls without re_waitForJobCounter, which would run the jobs here.
+    }
+
+    rt_check(rt_ranOnce(0u, RT_JOB_COUNT));
+}
+
+int main(void) {
+    // ? A single requested worker still gets a background worker, which the
+    // ? detached jobs rely on.
+    re_CoreInitParams params = {0};
+    params.app_name = "rt_jobs";
+    params.job_worker_count = 1u;
+
+    re_coreInit(&params);
+    rt_check(re_getJobWorkerCount() >= 2u);
+
+    rt_testRunOnce();
+    rt_testDependency();
+    rt_testNestedJobs();
+    rt_testDetachedJobs();
+
+    return rt_finish();
+}
\ No newline at end of file
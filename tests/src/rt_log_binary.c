@@ -0,0 +1,185 @@
+#include "./rt_test.h"
+
+#include <string.h>
+
+// ? Mirrors the on-disk layout written by the logger (see re_log_binary.h).
+#define RT_LOG_BINARY_MAGIC 0x474C4552u
+#define RT_LOG_BINARY_VERSION 2u
+
+#define RT_LOG_RECORD_SITE 1u
+#define RT_LOG_RECORD_MESSAGE 2u
+
+#define RT_LOG_LEVEL_INFO 1u
+
+#define RT_INPUT_PATH "rt_log_binary.rlog"
+#define RT_OUTPUT_PATH "rt_log_binary.txt"
+
+static void rt_writeBytes(FILE* file, const void* data, const size_t size) {
+    if (size > 0) {
+        fwrite(data, 1, size, file);
+    }
+}
+
+static FILE* rt_beginLog() {
+    FILE* file = fopen(RT_INPUT_PATH, "wb");
+
+    const uint32_t magic = RT_LOG_BINARY_MAGIC;
+    const uint32_t version = RT_LOG_BINARY_VERSION;
+    rt_writeBytes(file, &magic, sizeof(magic));
+    rt_writeBytes(file, &version, sizeof(version));
+
+    return file;
+}
+
+static void rt_writeSite(FILE* file, const uint32_t id, const char* format) {
+    const uint8_t kind = RT_LOG_RECORD_SITE;
+    const uint32_t line = 42u;
+    const uint8_t level = RT_LOG_LEVEL_INFO;
+    const uint16_t format_length = (uint16_t)strlen(format);
+    const uint16_t file_length = 6u;
+
+    rt_writeBytes(file, &kind, sizeof(kind));
+    rt_writeBytes(file, &id, sizeof(id));
+    rt_writeBytes(file, &line, sizeof(line));
+    rt_writeBytes(file, &level, sizeof(level));
+    rt_writeBytes(file, &format_length, sizeof(format_length));
+    rt_writeBytes(file, &file_length, sizeof(file_length));
+    rt_writeBytes(file, format, format_length);
+    rt_writeBytes(file, "test.c", file_length);
+}
+
+static void rt_writeMessage(FILE* file, const uint32_t id, const void* payload, const uint16_t length) {
+    const uint8_t kind = RT_LOG_RECORD_MESSAGE;
+    const uint64_t timestamp = 0u;
+
+    rt_writeBytes(file, &kind, sizeof(kind));
+    rt_writeBytes(file, &id, sizeof(id));
+    rt_writeBytes(file, &timestamp, sizeof(timestamp));
+    rt_writeBytes(file, &length, sizeof(length));
+    rt_writeBytes(file, payload, length);
+}
+
+// *=================================================
+// *
+// * Tests
+// *
+// *=================================================
+
+static void rt_testDecodeString() {
+    FILE* file = rt_beginLog();
+
+    // ? A string argument is its 16-bit length followed by its bytes.
+    uint8_t payload[16];
+    const uint16_t string_length = 5u;
+    memcpy(payload, &string_length, sizeof(string_length));
+    memcpy(payload + sizeof(string_length), "razor", string_length);
+
+    rt_writeSite(file, 1u, "Hello %s!");
+    rt_writeMessage(file, 1u, payload, (uint16_t)(sizeof(string_length) + string_length));
+    fclose(file);
+
+    rt_check(re_decodeBinaryLog(RT_INPUT_PATH, RT_OUTPUT_PATH));
+
+    char* text = rt_readFile(RT_OUTPUT_PATH);
+    rt_check(text != NULL && strstr(text, "[INFO]: Hello razor!\n") != NULL);
+    free(text);
+}
+
+static void rt_testDecodeMalformedString() {
+    FILE* file = rt_beginLog();
+
+    // ? Claims a string far longer than both the payload and the renderer's
+    // ? string buffer; it must render as cut off instead of being copied.
+    uint8_t payload[16];
+    const uint16_t string_length = UINT16_MAX;
+    memcpy(payload, &string_length, sizeof(string_length));
+    memcpy(payload + sizeof(string_length), "razor", 5u);
+
+    rt_writeSite(file, 1u, "Hello %s!");
+    rt_writeMessage(file, 1u, payload, (uint16_t)(sizeof(string_length) + 5u));
+
+    // ? Fits the payload but not the renderer's string buffer.
+    uint8_t long_payload[1024];
+    const uint16_t long_length = (uint16_t)(sizeof(long_payload) - sizeof(long_length));
+    memcpy(long_payload, &long_length, sizeof(long_length));
+    memset(long_payload + sizeof(long_length), 'a', long_length);
+
+    rt_writeMessage(file, 1u, long_payload, (uint16_t)sizeof(long_payload));
+    fclose(file);
+
+    rt_check(re_decodeBinaryLog(RT_INPUT_PATH, RT_OUTPUT_PATH));
+
+    char* text = rt_readFile(RT_OUTPUT_PATH);
+    const char* first = text != NULL ? strstr(text, "[INFO]: Hello ...\n") : NULL;
+    rt_check(first != NULL && strstr(first + 1, "[INFO]: Hello ...\n") != NULL);
+    rt_check(text != NULL && strstr(text, "aaaa") == NULL);
+    free(text);
+}
+
+static void rt_testDecodeOversizedSpec() {
+    FILE* file = rt_beginLog();
+
+    // ? Both '*' values print as 11 characters, which with the flags is too
+    // ? long for the renderer's rebuilt spec; it must print as unsupported
+    // ? and still consume its values so the next argument stays in place.
+    uint8_t payload[4 * sizeof(uint64_t)];
+    const uint64_t values[4] = { (uint64_t)(int64_t)INT32_MIN, (uint64_t)(int64_t)INT32_MIN, 7u, 9u };
+    memcpy(payload, values, sizeof(values));
+
+    rt_writeSite(file, 1u, "Spec %'''''''''''''''*.*d then %d!");
+    rt_writeMessage(file, 1u, payload, (uint16_t)sizeof(payload));
+    fclose(file);
+
+    rt_check(re_decodeBinaryLog(RT_INPUT_PATH, RT_OUTPUT_PATH));
+
+    char* text = rt_readFile(RT_OUTPUT_PATH);
+    rt_check(text != NULL && strstr(text, "[INFO]: Spec <?> then 9!\n") != NULL);
+    free(text);
+}
+
+static void rt_testDecodeUnsupportedFormat() {
+    FILE* file = rt_beginLog();
+
+    // ? Sites with unknown conversions or too many arguments capture nothing
+    // ? and render their format as is.
+    rt_writeSite(file, 1u, "Wide %ls %d");
+    rt_writeSite(file, 2u, "%d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d");
+    rt_writeMessage(file, 1u, NULL, 0u);
+    rt_writeMessage(file, 2u, NULL, 0u);
+    fclose(file);
+
+    rt_check(re_decodeBinaryLog(RT_INPUT_PATH, RT_OUTPUT_PATH));
+
+    char* text = rt_readFile(RT_OUTPUT_PATH);
+    rt_check(text != NULL && strstr(text, "[INFO]: <unsupported format> Wide %ls %d\n") != NULL);
+    rt_check(text != NULL && strstr(text, "[INFO]: <unsupported format> %d %d") != NULL);
+    free(text);
+}
+
+static void rt_testDecodeMalformedSiteId() {
+    // ? Ids this large used to wrap the dictionary's growth math and hang the
+    // ? decoder; they are rejected instead.
+    const uint32_t site_ids[] = { 0x80000000u, UINT32_MAX - 1u, (1u << 20) + 1u };
+
+    for (uint32_t idx = 0; idx < sizeof(site_ids) / sizeof(site_ids[0]); ++idx) {
+        FILE* file = rt_beginLog();
+        rt_writeSite(file, 1u, "first");
+        rt_writeSite(file, site_ids[idx], "second");
+        fclose(file);
+
+        rt_check(!re_decodeBinaryLog(RT_INPUT_PATH, RT_OUTPUT_PATH));
+    }
+}
+
+int main(void) {
+    rt_testDecodeString();
+    rt_testDecodeMalformedString();
+    rt_testDecodeOversizedSpec();
+    rt_testDecodeUnsupportedFormat();
+    rt_testDecodeMalformedSiteId();
+
+    remove(RT_INPUT_PATH);
+    remove(RT_OUTPUT_PATH);
+
+    return rt_finish();
+}
\ No newline at end of file
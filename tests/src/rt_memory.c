@@ -0,0 +1,82 @@
+#include "./rt_test.h"
+
+#include <stdint.h>
+
+// *=================================================
+// *
+// * Tests
+// *
+// *=================================================
+
+static void rt_testOversizedAllocations() {
+    // ? Sizes whose header or page rounding would wrap must fail cleanly
+    // ? instead of handing back a tiny block.
+    bool all_failed = true;
+    for (size_t offset = 0; offset <= 256u; ++offset) {
+        all_failed = all_failed && re_malloc(SIZE_MAX - offset) == NULL;
+    }
+    rt_check(all_failed);
+
+    rt_check(re_malloc((size_t)PTRDIFF_MAX + 1u) == NULL);
+    rt_check(re_calloc(SIZE_MAX / 2u + 1u, 2u) == NULL);
+    rt_check(re_calloc(2u, SIZE_MAX / 2u + 1u) == NULL);
+
+    void* ptr = re_malloc(1024u * 1024u);
+    rt_check(ptr != NULL);
+    rt_check(re_realloc(ptr, SIZE_MAX - 8u) == NULL);
+    re_free(ptr);
+}
+
+static void rt_testFullArena() {
+    re_Arena arena = re_createArena(256u);
+
+    rt_check(re_arenaPush(arena, 200u, 8u) != NULL);
+    rt_check(re_arenaPush(arena, 100u, 8u) == NULL);
+    rt_check(re_arenaPushZero(arena, 100u, 8u) == NULL);
+    rt_check(re_arenaPush(arena, SIZE_MAX, 8u) == NULL);
+
+    // ? A failed push leaves the top where it was.
+    rt_check(re_arenaPush(arena, 56u, 8u) != NULL);
+    rt_check(re_getArenaMark(arena) == 256u);
+
+    re_resetArena(arena);
+
+    // ? Containers on an arena see a full arena as an ordinary failed grow.
+    const re_Allocator allocator = re_getArenaAllocator(arena);
+
+    re_ArrayCreateInfo create_info = {0};
+    create_info.element_size = sizeof(uint64_t);
+    create_info.allocator = &allocator;
+
+    re_Array array = re_createArray(&create_info);
+    rt_check(array != NULL);
+    rt_check(!re_reserveArray(array, 1024u));
+
+    re_destroyArray(&array);
+    re_destroyArena(&arena);
+}
+
+static void rt_testPoolAllocatorMisfit() {
+    re_PoolCreateInfo create_info = {0};
+    create_info.slot_size = 32u;
+    create_info.slots_per_block = 16u;
+
+    re_Pool pool = re_createPool(&create_info);
+    const re_Allocator allocator = re_getPoolAllocator(pool);
+
+    void* slot = allocator.alloc(allocator.user_data, 32u, 8u);
+    rt_check(slot != NULL);
+    rt_check(allocator.alloc(allocator.user_data, 33u, 8u) == NULL);
+    rt_check(allocator.alloc(allocator.user_data, 16u, 4096u) == NULL);
+
+    allocator.free(allocator.user_data, slot);
+    re_destroyPool(&pool);
+}
+
+int main(void) {
+    rt_testOversizedAllocations();
+    rt_testFullArena();
+    rt_testPoolAllocatorMisfit();
+
+    return rt_finish();
+}
\ No newline at end of file
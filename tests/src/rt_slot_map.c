@@ -0,0 +1,129 @@
+#include "./rt_test.h"
+
+#define RT_VALUE_COUNT 1000u
+
+typedef struct rt_Value {
+    uint64_t id;
+    uint32_t payload[3];
+} rt_Value;
+
+static re_SlotMap rt_createSlotMap() {
+    re_SlotMapCreateInfo create_info = {0};
+    create_info.value_size = sizeof(rt_Value);
+
+    return re_createSlotMap(&create_info);
+}
+
+static bool rt_hasValue(const re_SlotMap map, const re_Handle handle, const uint64_t id) {
+    const rt_Value* value = (const rt_Value*)re_slotMapGet(map, handle);
+    return value != NULL && value->id == id;
+}
+
+// *=================================================
+// *
+// * Tests
+// *
+// *=================================================
+
+static void rt_testStaleHandle() {
+    re_SlotMap map = rt_createSlotMap();
+
+    const rt_Value first = { 1u, { 0u, 0u, 0u } };
+    const re_Handle first_handle = re_slotMapInsert(map, &first);
+    rt_check(first_handle != RE_HANDLE_NULL);
+    rt_check(rt_hasValue(map, first_handle, 1u));
+
+    rt_check(re_slotMapRemove(map, first_handle));
+    rt_check(!re_isSlotMapHandleValid(map, first_handle));
+    rt_check(re_slotMapGet(map, first_handle) == NULL);
+    rt_check(!re_slotMapRemove(map, first_handle));
+
+    // ? The freed slot is reused, but under a new generation, so the old
+    // ? handle must not reach the new value.
+    const rt_Value second = { 2u, { 0u, 0u, 0u } };
+    const re_Handle second_handle = re_slotMapInsert(map, &second);
+
+    rt_check(RE_HANDLE_INDEX(second_handle) == RE_HANDLE_INDEX(first_handle));
+    rt_check(RE_HANDLE_GENERATION(second_handle) != RE_HANDLE_GENERATION(first_handle));
+    rt_check(re_slotMapGet(map, first_handle) == NULL);
+    rt_check(!re_slotMapRemove(map, first_handle));
+    rt_check(rt_hasValue(map, second_handle, 2u));
+    rt_check(re_getSlotMapCount(map) == 1u);
+
+    rt_check(!re_isSlotMapHandleValid(map, RE_HANDLE_NULL));
+
+    re_clearSlotMap(map);
+    rt_check(!re_isSlotMapHandleValid(map, second_handle));
+    rt_check(re_getSlotMapCount(map) == 0u);
+
+    re_destroySlotMap(&map);
+    rt_check(map == NULL);
+}
+
+static void rt_testDenseValues() {
+    re_SlotMap map = rt_createSlotMap();
+    re_Handle handles[RT_VALUE_COUNT];
+
+    for (uint32_t idx = 0; idx < RT_VALUE_COUNT; ++idx) {
+        const rt_Value value = { idx, { idx, idx, idx } };
+        handles[idx] = re_slotMapInsert(map, &value);
+    }
+
+    // ? Removals move the last value into the hole; the remaining handles
+    // ? must follow their values.
+    for (uint32_t idx = 0; idx < RT_VALUE_COUNT; idx += 2u) {
+        rt_check(re_slotMapRemove(map, handles[idx]));
+    }
+
+    rt_check(re_getSlotMapCount(map) == RT_VALUE_COUNT / 2u);
+
+    bool handles_ok = true;
+    for (uint32_t idx = 0; idx < RT_VALUE_COUNT; ++idx) {
+        if (idx % 2u == 0) {
+            handles_ok = handles_ok && !re_isSlotMapHandleValid(map, handles[idx]);
+        }
+        else {
+            handles_ok = handles_ok && rt_hasValue(map, handles[idx], idx);
+        }
+    }
+    rt_check(handles_ok);
+
+    // ? The dense data holds exactly the live values, each reachable back
+    // ? through its handle.
+    const rt_Value* values = (const rt_Value*)re_getSlotMapData(map);
+    uint64_t id_sum = 0;
+    bool dense_ok = true;
+
+    for (uint32_t idx = 0; idx < re_getSlotMapCount(map); ++idx) {
+        id_sum += values[idx].id;
+        dense_ok = dense_ok && re_slotMapGet(map, re_getSlotMapHandle(map, idx)) == &values[idx];
+    }
+
+    rt_check(dense_ok);
+    rt_check(id_sum == (uint64_t)(RT_VALUE_COUNT / 2u) * (RT_VALUE_COUNT / 2u));
+
+    // ? Refilling reuses every freed slot, so none of the stale handles may
+    // ? come back to life.
+    for (uint32_t idx = 0; idx < RT_VALUE_COUNT; idx += 2u) {
+        const rt_Value value = { RT_VALUE_COUNT + idx, { 0u, 0u, 0u } };
+        const re_Handle handle = re_slotMapInsert(map, &value);
+
+        rt_check(handle != handles[idx]);
+    }
+
+    handles_ok = true;
+    for (uint32_t idx = 0; idx < RT_VALUE_COUNT; idx += 2u) {
+        handles_ok = handles_ok && re_slotMapGet(map, handles[idx]) == NULL;
+    }
+    rt_check(handles_ok);
+    rt_check(re_getSlotMapCount(map) == RT_VALUE_COUNT);
+
+    re_destroySlotMap(&map);
+}
+
+int main(void) {
+    rt_testStaleHandle();
+    rt_testDenseValues();
+
+    return rt_finish();
+}
\ No newline at end of file
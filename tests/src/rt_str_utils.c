@@ -0,0 +1,100 @@
+#include "./rt_test.h"
+
+#include <ctype.h>
+#include <string.h>
+
+#define RT_MAX_STR_LENGTH 200u
+
+// ? Fills a heap buffer sized exactly to the string, so a vector load past
+// ? the terminator lands outside the allocation.
+static char* rt_createStr(const size_t length, const char first_char) {
+    char* str = (char*)malloc(length + 1u);
+
+    for (size_t idx = 0; idx < length; ++idx) {
+        str[idx] = (char)(first_char + idx % 26u);
+    }
+    str[length] = '\0';
+
+    return str;
+}
+
+static bool rt_isStrEqualNoCase(const char* str_a, const char* str_b) {
+    for (; *str_a != '\0' && *str_b != '\0'; ++str_a, ++str_b) {
+        if (tolower((unsigned char)*str_a) != tolower((unsigned char)*str_b)) {
+            return false;
+        }
+    }
+
+    return *str_a == *str_b;
+}
+
+// *=================================================
+// *
+// * Tests
+// *
+// *=================================================
+
+static void rt_testMatchesLibc() {
+    bool lengths_ok = true;
+    bool compares_ok = true;
+
+    for (size_t length = 0; length <= RT_MAX_STR_LENGTH; ++length) {
+        char* lower = rt_createStr(length, 'a');
+        char* upper = rt_createStr(length, 'A');
+        char* same = rt_createStr(length, 'a');
+
+        lengths_ok = lengths_ok && re_getStrLength(lower) == strlen(lower);
+
+        // ? Every offset shifts the strings against the vector and page
+        // ? boundaries, and flips where the first difference falls.
+        for (size_t offset = 0; offset <= length; ++offset) {
+            lengths_ok = lengths_ok && re_getStrLength(lower + offset) == length - offset;
+
+            compares_ok = compares_ok && re_isStrEqual(lower + offset, same + offset);
+            compares_ok = compares_ok && re_isStrEqual(lower, same + offset) == (strcmp(lower, same + offset) == 0);
+            compares_ok = compares_ok && re_isStrEqualNoCase(lower + offset, upper + offset);
+            compares_ok = compares_ok &&
+                re_isStrEqualNoCase(lower, upper + offset) == rt_isStrEqualNoCase(lower, upper + offset);
+            compares_ok = compares_ok &&
+                re_hasStrPrefix(lower, same + offset) == (strncmp(lower, same + offset, length - offset) == 0);
+            compares_ok = compares_ok && re_hasStrPrefix(lower + offset, same + length);
+        }
+
+        if (length > 0) {
+            same[length - 1u] = '#';
+            compares_ok = compares_ok && !re_isStrEqual(lower, same);
+            compares_ok = compares_ok && !re_hasStrPrefix(lower, same);
+            compares_ok = compares_ok && !re_hasStrPrefix(same, lower);
+        }
+
+        free(lower);
+        free(upper);
+        free(same);
+    }
+
+    rt_check(lengths_ok);
+    rt_check(compares_ok);
+}
+
+static void rt_testCopyStr() {
+    char buffer[8];
+
+    rt_check(re_copyStr(buffer, "razor", sizeof(buffer)) == 5u);
+    rt_check(strcmp(buffer, "razor") == 0);
+
+    rt_check(re_copyStr(buffer, "razor engine", sizeof(buffer)) == 12u);
+    rt_check(strcmp(buffer, "razor e") == 0);
+
+    rt_check(re_copyStr(NULL, "razor", 0u) == 5u);
+
+    // ? NULL copies as an empty string instead of tripping re_memcpy's assert.
+    rt_check(re_copyStr(buffer, NULL, sizeof(buffer)) == 0u);
+    rt_check(buffer[0] == '\0');
+}
+
+int main(void) {
+    rt_testMatchesLibc();
+    rt_testCopyStr();
+
+    return rt_finish();
+}
\ No newline at end of file
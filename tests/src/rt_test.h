@@ -0,0 +1,44 @@
+#ifndef __RAZOR_TEST_HEADER_FILE
+#define __RAZOR_TEST_HEADER_FILE
+
+#include <razor.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+
+// ? Checks keep going after a failure so one run reports every broken case;
+// ? rt_finish turns the tally into the process exit code CTest reads.
+static uint32_t rt_failure_count = 0;
+
+#define rt_check(condition) do { \
+    if (!(condition)) { \
+        fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__, #condition); \
+        ++rt_failure_count; \
+    } \
+} while(0)
+
+#define rt_finish() (rt_failure_count == 0 ? EXIT_SUCCESS : EXIT_FAILURE)
+
+/// @brief Read a whole file into a NULL-terminated buffer (freed with free).
+/// @param path The path of the file to read.
+/// @return The file's contents, or NULL if it could not be read.
+static inline char* rt_readFile(const char* path) {
+    FILE* file = fopen(path, "rb");
+
+    if (file == NULL) {
+        return NULL;
+    }
+
+    fseek(file, 0, SEEK_END);
+    const long size = ftell(file);
+    fseek(file, 0, SEEK_SET);
+
+    char* data = (char*)malloc((size_t)size + 1u);
+    const size_t read_size = fread(data, 1, (size_t)size, file);
+    data[read_size] = '\0';
+
+    fclose(file);
+    return data;
+}
+
+#endif
\ No newline at end of file